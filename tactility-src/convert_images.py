@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Convert face images to compressed LVGL-native images for the app assets.
+
+Every PNG in the source directory becomes <name>.bin in the output directory
+(by default assets/faces, which tactility.py packages with the app). Pixels
+are stored in the color format the display draws directly, so loading is a
+run-length decode straight into the draw buffer, with no PNG inflate and no
+color conversion on the device.
+
+Images without transparency are stored as RGB565, images with transparency
+as RGB565A8 (an RGB565 plane followed by an alpha plane).
+
+Dial backgrounds and hands are authored for one dial diameter (--dial-size,
+defaulting to the width of dial.png). The app scales them when its dial is a
+different size, unless a variant for that size exists: --sizes 200,240
+additionally writes name_200.bin and name_240.bin, pre-scaled.
+
+Hands point to 12 o'clock, centered horizontally, and rotate around the point
+half their width above their bottom edge.
+
+Usage: python convert_images.py [--dial-size N] [--sizes A,B] [src] [dst]
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+from PIL import Image
+
+MAGIC = b"TCIM"
+VERSION = 1
+# lv_color_format_t values
+LV_COLOR_FORMAT_RGB565 = 0x12
+LV_COLOR_FORMAT_RGB565A8 = 0x14
+MAX_RUN = 127
+
+
+def rgb565_plane(pixels):
+    data = bytearray()
+    for i in range(0, len(pixels), 4):
+        r, g, b = pixels[i], pixels[i + 1], pixels[i + 2]
+        data += struct.pack("<H", ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return data
+
+
+def alpha_plane(pixels):
+    return bytearray(pixels[3::4])
+
+
+def rle_encode(data, unit):
+    """Control byte n < 0x80: the next unit repeats n times.
+    Control byte 0x80 | n: n literal units follow."""
+    units = [bytes(data[i:i + unit]) for i in range(0, len(data), unit)]
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(0x80 | len(chunk))
+            for value in chunk:
+                out.extend(value)
+
+    i = 0
+    while i < len(units):
+        run = 1
+        while i + run < len(units) and run < MAX_RUN and units[i + run] == units[i]:
+            run += 1
+        # A run of two costs as much as two literals
+        if run >= 3:
+            flush_literal()
+            out.append(run)
+            out += units[i]
+            i += run
+        else:
+            literal.append(units[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def convert(image, design_size):
+    image = image.convert("RGBA")
+    width, height = image.size
+    pixels = image.tobytes()
+    alpha = alpha_plane(pixels)
+    data = rgb565_plane(pixels)
+    color_format = LV_COLOR_FORMAT_RGB565
+    if any(a != 255 for a in alpha):
+        data += alpha
+        color_format = LV_COLOR_FORMAT_RGB565A8
+    unit = 2 if len(data) % 2 == 0 else 1
+    payload = rle_encode(data, unit)
+    header = struct.pack("<4sBBBxHHHHII", MAGIC, VERSION, color_format, unit,
+                         width, height, width * 2, design_size, len(data),
+                         len(payload))
+    return header + payload, len(data)
+
+
+def write_image(path, image, design_size):
+    blob, raw_size = convert(image, design_size)
+    with open(path, "wb") as file:
+        file.write(blob)
+    print(f"{path}: {image.size[0]}x{image.size[1]}, "
+          f"{raw_size} -> {len(blob)} bytes")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("src", nargs="?", default="images")
+    parser.add_argument("dst", nargs="?", default=os.path.join("assets", "faces"))
+    parser.add_argument("--dial-size", type=int, default=0)
+    parser.add_argument("--sizes", default="")
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.src):
+        print(f"No {args.src} directory, nothing to convert")
+        return 0
+    os.makedirs(args.dst, exist_ok=True)
+
+    dial_size = args.dial_size
+    dial_path = os.path.join(args.src, "dial.png")
+    if not dial_size and os.path.isfile(dial_path):
+        dial_size = Image.open(dial_path).size[0]
+    sizes = [int(size) for size in args.sizes.split(",") if size]
+    if sizes and not dial_size:
+        print("--sizes needs --dial-size or a dial.png")
+        return 1
+
+    for file_name in sorted(os.listdir(args.src)):
+        name, extension = os.path.splitext(file_name)
+        if extension.lower() != ".png":
+            continue
+        image = Image.open(os.path.join(args.src, file_name))
+        write_image(os.path.join(args.dst, f"{name}.bin"), image, dial_size)
+        for size in sizes:
+            scale = size / dial_size
+            scaled = image.convert("RGBA").resize(
+                (max(1, round(image.size[0] * scale)),
+                 max(1, round(image.size[1] * scale))),
+                Image.LANCZOS)
+            write_image(os.path.join(args.dst, f"{name}_{size}.bin"), scaled, size)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Generate main/LocaleData.cpp from the locale packs in locales/.
+
+Each locales/<code>.json holds day and month names (Sunday and January
+first), AM/PM markers, the locale's 12/24-hour default and date patterns
+using the strftime subset understood by locale_format() (see Locale.h).
+
+All strings go into one shared, de-duplicated pool; each locale is a table
+of 16-bit offsets into it. Only the locales passed with --locales are built
+in (default: all), and the size each one adds is reported.
+
+Usage: python generate_locales.py [--locales en,de,...]
+"""
+
+import argparse
+import json
+import os
+import sys
+
+LOCALE_DIR = "locales"
+OUTPUT = os.path.join("main", "LocaleData.cpp")
+# Order of LocaleString in Locale.h
+FIELDS = [("days", 7), ("days_short", 7), ("months", 12), ("months_short", 12),
+          ("am_pm", 2), ("date_long", 1), ("date_short", 1), ("day_month", 1),
+          ("weekday_day", 1)]
+STRING_COUNT = sum(count for _, count in FIELDS)
+# code and name pointers, is_24_hour plus padding, the offsets
+TABLE_ENTRY_SIZE = 4 + 4 + 4 + 2 * STRING_COUNT
+
+
+def load_locale(code):
+    with open(os.path.join(LOCALE_DIR, f"{code}.json"), encoding="utf-8") as file:
+        data = json.load(file)
+    strings = []
+    for field, count in FIELDS:
+        value = data[field]
+        values = value if isinstance(value, list) else [value]
+        if len(values) != count:
+            raise ValueError(f"{code}: {field} needs {count} entries")
+        strings += values
+    return data, strings
+
+
+def c_string(text):
+    """UTF-8 as a C literal; octal escapes cannot swallow following digits
+    the way \\x escapes do as long as they are three digits long."""
+    out = ""
+    for byte in text.encode("utf-8"):
+        char = chr(byte)
+        if char in "\"\\":
+            out += "\\" + char
+        elif 0x20 <= byte < 0x7F:
+            out += char
+        else:
+            out += f"\\{byte:03o}"
+    return f"\"{out}\""
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--locales", default="")
+    args = parser.parse_args()
+
+    available = sorted(name[:-5] for name in os.listdir(LOCALE_DIR)
+                       if name.endswith(".json"))
+    codes = [code for code in args.locales.split(",") if code] or available
+    # English first: it is the default
+    codes.sort(key=lambda code: (code != "en", code))
+    for code in codes:
+        if code not in available:
+            print(f"Unknown locale {code}; available: {', '.join(available)}")
+            return 1
+
+    pool = bytearray()
+    offsets = {}
+    entries = []
+    print(f"{'locale':8}{'strings':>10}{'table':>8}{'total':>8}")
+    total = 0
+    for code in codes:
+        data, strings = load_locale(code)
+        added = 0
+        indices = []
+        for text in strings:
+            if text not in offsets:
+                offsets[text] = len(pool)
+                encoded = text.encode("utf-8") + b"\0"
+                pool += encoded
+                added += len(encoded)
+            indices.append(offsets[text])
+        if len(pool) > 0xFFFF:
+            print("String pool exceeds 16-bit offsets")
+            return 1
+        entries.append((code, data, indices))
+        size = added + TABLE_ENTRY_SIZE + len(code) + 1 + len(data["name"].encode()) + 1
+        total += size
+        print(f"{code:8}{added:>10}{TABLE_ENTRY_SIZE:>8}{size:>8}")
+        if any(ord(char) > 0x7E for text in strings for char in text):
+            print(f"  note: {code} uses non-ASCII letters; the display font "
+                  f"needs those glyphs")
+    print(f"{'all':8}{len(pool):>10}{TABLE_ENTRY_SIZE * len(codes):>8}{total:>8}")
+
+    lines = [
+        "// Generated by generate_locales.py from locales/*.json; do not edit.",
+        f"// Locales: {', '.join(codes)}",
+        "",
+        "#include \"Locale.h\"",
+        "",
+        "const char locale_pool[] =",
+    ]
+    for text in offsets:
+        lines.append(f"    {c_string(text)} \"\\0\"")
+    lines[-1] += ";"
+    lines += ["", "const LocaleInfo locales[] = {"]
+    for code, data, indices in entries:
+        lines.append(f"    {{{c_string(code)}, {c_string(data['name'])}, "
+                     f"{'true' if data['is_24_hour'] else 'false'},")
+        rows = [indices[i:i + 8] for i in range(0, len(indices), 8)]
+        lines.append("     {" + ",\n      ".join(
+            ", ".join(str(index) for index in row) for row in rows) + "}},")
+    lines += [
+        "};",
+        "",
+        f"const int locale_count = {len(entries)};",
+        "",
+    ]
+    with open(OUTPUT, "w", encoding="utf-8") as file:
+        file.write("\n".join(lines))
+    print(f"Wrote {OUTPUT}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Generate main/TimezoneData.cpp, the zone table behind the timezone picker.
+
+Zone names come from zone.tab of the system tz database (plus UTC). Each
+zone is stored once in a shared string pool with its standard UTC offset,
+taken from Python's zoneinfo for --year, and the POSIX TZ rule from the
+footer of its TZif file, which the dashboard evaluates to follow daylight
+saving time. Rules are shared between zones in the same pool. The table is sorted by name, and a
+second order sorts it by city (the part after the last '/'), so a prefix
+search by either is a binary search over a contiguous range. Per-letter
+bucket starts narrow that search before it begins.
+
+Sorting uses the same key as the search on the device: ASCII lower case,
+with '_' read as a space.
+
+Usage: python generate_timezones.py [--zoneinfo DIR] [--year N]
+"""
+
+import argparse
+import datetime
+import os
+import sys
+import zoneinfo
+
+OUTPUT = os.path.join("main", "TimezoneData.cpp")
+
+
+def search_key(text):
+    return text.lower().replace("_", " ")
+
+
+def city_of(name):
+    return name[name.rfind("/") + 1:]
+
+
+def standard_offset(name, year):
+    zone = zoneinfo.ZoneInfo(name)
+    offsets = [datetime.datetime(year, month, 1, tzinfo=zone).utcoffset()
+               for month in (1, 7)]
+    return int(min(offsets).total_seconds() // 60)
+
+
+def posix_rule(zoneinfo_dir, name):
+    """The TZ string at the end of a version 2+ TZif file."""
+    with open(os.path.join(zoneinfo_dir, name), "rb") as file:
+        data = file.read()
+    if not data.startswith(b"TZif") or data[4:5] < b"2":
+        return None
+    footer = data.rstrip(b"\n")
+    rule = footer[footer.rfind(b"\n") + 1:].decode("ascii")
+    return rule or None
+
+
+def letter_index(keys):
+    """Start of each first letter a..z in the sorted keys, then the count."""
+    index = []
+    position = 0
+    for letter in "abcdefghijklmnopqrstuvwxyz":
+        while position < len(keys) and keys[position][:1] < letter:
+            position += 1
+        index.append(position)
+    index.append(len(keys))
+    return index
+
+
+def c_array(values, indent="    ", per_line=12):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--zoneinfo", default="/usr/share/zoneinfo")
+    parser.add_argument("--year", type=int, default=datetime.date.today().year)
+    args = parser.parse_args()
+
+    names = {"UTC"}
+    with open(os.path.join(args.zoneinfo, "zone.tab"), encoding="utf-8") as file:
+        for line in file:
+            if line.strip() and not line.startswith("#"):
+                names.add(line.split("\t")[2].strip())
+    names = sorted(names, key=search_key)
+    if any(not name.isascii() for name in names):
+        print("Zone names must be ASCII")
+        return 1
+
+    pool = bytearray()
+    rules = {}
+    zones = []
+    for name in names:
+        rule = posix_rule(args.zoneinfo, name)
+        if rule is None:
+            print(f"{name} has no POSIX TZ rule; needs TZif version 2 or later")
+            return 1
+        name_offset = len(pool)
+        pool += name.encode() + b"\0"
+        if rule not in rules:
+            rules[rule] = len(pool)
+            pool += rule.encode() + b"\0"
+        zones.append((name_offset, len(name) - len(city_of(name)),
+                      standard_offset(name, args.year), rules[rule]))
+    if len(pool) > 0xFFFF:
+        print("String pool exceeds 16-bit offsets")
+        return 1
+
+    city_order = sorted(range(len(names)),
+                        key=lambda i: (search_key(city_of(names[i])),
+                                       search_key(names[i])))
+    name_index = letter_index([search_key(name) for name in names])
+    city_index = letter_index([search_key(city_of(names[i])) for i in city_order])
+
+    lines = [
+        "// Generated by generate_timezones.py from zone.tab; do not edit.",
+        f"// Standard offsets as of {args.year}; rules from the TZif footers.",
+        "",
+        "#include \"Timezones.h\"",
+        "",
+        "const char timezone_pool[] =",
+    ]
+    written = set()
+    for name in names:
+        lines.append(f"    \"{name}\\0\"")
+        rule = posix_rule(args.zoneinfo, name)
+        if rule not in written:
+            written.add(rule)
+            lines.append(f"    \"{rule}\\0\"")
+    lines[-1] += ";"
+    lines += ["", "const TimezoneInfo timezones[] = {"]
+    for name_offset, city_offset, minutes, rule_offset in zones:
+        lines.append(f"    {{{name_offset}, {city_offset}, {minutes}, {rule_offset}}},")
+    lines += ["};", "", f"const uint16_t timezone_count = {len(names)};", "",
+              "const uint16_t timezone_city_order[] = {"]
+    lines += c_array(city_order)
+    lines += ["};", "", "const uint16_t timezone_name_index[27] = {"]
+    lines += c_array(name_index, per_line=9)
+    lines += ["};", "", "const uint16_t timezone_city_index[27] = {"]
+    lines += c_array(city_index, per_line=9)
+    lines += ["};", ""]
+    with open(OUTPUT, "w", encoding="utf-8") as file:
+        file.write("\n".join(lines))
+
+    size = len(pool) + len(names) * (8 + 2) + 2 * 27 * 2
+    print(f"Wrote {OUTPUT}: {len(names)} zones, {len(rules)} rules, "
+          f"{size} bytes of flash")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
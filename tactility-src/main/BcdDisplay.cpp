@@ -0,0 +1,78 @@
+#include "BcdDisplay.h"
+
+// Bits needed by each digit: hour tens <= 2, minute and second tens <= 5
+static const int column_bits[BCD_COLUMN_COUNT] = {2, 4, 3, 4, 3, 4};
+
+void bcd_display_create(BcdDisplay *display, lv_obj_t *parent,
+                        lv_color_t on_color, lv_color_t off_color,
+                        bool show_seconds) {
+  *display = {};
+  display->column_count =
+      show_seconds ? BCD_COLUMN_COUNT : BCD_COLUMN_COUNT - 2;
+
+  lv_obj_t *panel = lv_obj_create(parent);
+  display->panel = panel;
+  lv_obj_remove_style_all(panel);
+  lv_obj_clear_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+  // Let presses reach the container so the carousel can be swiped
+  lv_obj_clear_flag(panel, LV_OBJ_FLAG_CLICKABLE);
+
+  for (int column = 0; column < display->column_count; column++) {
+    for (int bit = 0; bit < column_bits[column]; bit++) {
+      lv_obj_t *cell = lv_obj_create(panel);
+      display->cells[column][bit] = cell;
+      lv_obj_remove_style_all(cell);
+      lv_obj_set_style_bg_opa(cell, LV_OPA_COVER, 0);
+      lv_obj_set_style_bg_color(cell, off_color, 0);
+      lv_obj_set_style_bg_color(cell, on_color, LV_STATE_CHECKED);
+      lv_obj_clear_flag(cell, LV_OBJ_FLAG_CLICKABLE);
+    }
+  }
+}
+
+void bcd_display_apply_layout(BcdDisplay *display, const ClockLayout *layout) {
+  lv_coord_t size = layout->bcd_cell_size;
+  lv_coord_t step = size + layout->bcd_cell_gap;
+
+  lv_coord_t x = 0;
+  for (int column = 0; column < display->column_count; column++) {
+    for (int bit = 0; bit < column_bits[column]; bit++) {
+      lv_obj_t *cell = display->cells[column][bit];
+      // Bit 0 sits on the bottom row
+      lv_obj_set_pos(cell, x, (BCD_ROW_COUNT - 1 - bit) * step);
+      lv_obj_set_size(cell, size, size);
+      lv_obj_set_style_radius(cell, size / 5, 0);
+    }
+    x += size + (column % 2 == 1 ? layout->bcd_pair_gap : layout->bcd_cell_gap);
+  }
+
+  lv_obj_set_size(display->panel, x - layout->bcd_pair_gap,
+                  BCD_ROW_COUNT * step - layout->bcd_cell_gap);
+}
+
+void bcd_display_set_time(BcdDisplay *display, int hour, int minute,
+                          int second) {
+  const int digits[BCD_COLUMN_COUNT] = {
+      hour / 10, hour % 10, minute / 10, minute % 10, second / 10, second % 10,
+  };
+
+  for (int column = 0; column < display->column_count; column++) {
+    auto bits = (uint8_t)digits[column];
+    uint8_t toggled = bits ^ display->lit[column];
+    if (!toggled) {
+      continue;
+    }
+    display->lit[column] = bits;
+
+    for (int bit = 0; bit < column_bits[column]; bit++) {
+      if (!(toggled & (1 << bit))) {
+        continue;
+      }
+      if (bits & (1 << bit)) {
+        lv_obj_add_state(display->cells[column][bit], LV_STATE_CHECKED);
+      } else {
+        lv_obj_clear_state(display->cells[column][bit], LV_STATE_CHECKED);
+      }
+    }
+  }
+}
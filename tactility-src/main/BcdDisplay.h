@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ClockLayout.h"
+
+#include <lvgl.h>
+
+#include <cstdint>
+
+constexpr int BCD_COLUMN_COUNT = 6;
+constexpr int BCD_ROW_COUNT = 4;
+
+// Binary coded decimal clock: one column per digit of HH MM SS, with the
+// most significant bit on top. Cells are unstyled rectangles whose lit color
+// is a CHECKED state style, so a tick only adds or clears the state on the
+// cells whose bit toggled (usually one or two per second).
+struct BcdDisplay {
+  lv_obj_t *panel;
+  int column_count; // 4 without the seconds columns
+  // nullptr for bits a column never uses, e.g. the top two of the hour tens
+  lv_obj_t *cells[BCD_COLUMN_COUNT][BCD_ROW_COUNT];
+  uint8_t lit[BCD_COLUMN_COUNT];
+};
+
+// Without `show_seconds` only HH MM get columns
+void bcd_display_create(BcdDisplay *display, lv_obj_t *parent,
+                        lv_color_t on_color, lv_color_t off_color,
+                        bool show_seconds);
+
+void bcd_display_apply_layout(BcdDisplay *display, const ClockLayout *layout);
+
+// `second` is ignored without the seconds columns
+void bcd_display_set_time(BcdDisplay *display, int hour, int minute,
+                          int second);
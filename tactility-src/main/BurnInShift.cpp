@@ -0,0 +1,68 @@
+#include "BurnInShift.h"
+
+#include <esp_log.h>
+
+constexpr auto *TAG = "BurnInShift";
+
+static bool enabled = false;
+static int32_t max_offset = 2;
+static uint32_t interval_seconds = 60;
+static int64_t current_step = -1;
+static int32_t offset_x = 0;
+static int32_t offset_y = 0;
+
+void burn_in_shift_configure(bool is_enabled, int32_t max_offset_px,
+                             uint32_t interval_s) {
+  enabled = is_enabled;
+  max_offset = LV_MAX(max_offset_px, 0);
+  interval_seconds = LV_MAX(interval_s, 1u);
+  current_step = -1;
+  offset_x = 0;
+  offset_y = 0;
+}
+
+bool burn_in_shift_is_enabled() { return enabled && max_offset > 0; }
+
+// Snake through the grid and back again, so every step moves a single pixel
+static void offset_for_step(int64_t step, int32_t *x, int32_t *y) {
+  int32_t side = 2 * max_offset + 1;
+  int32_t cells = side * side;
+  int32_t period = 2 * cells - 2;
+  auto position = (int32_t)(step % period);
+  if (position >= cells) {
+    position = period - position;
+  }
+
+  int32_t row = position / side;
+  int32_t column = position % side;
+  if (row % 2 == 1) {
+    column = side - 1 - column;
+  }
+  *x = column - max_offset;
+  *y = row - max_offset;
+}
+
+void burn_in_shift_apply(lv_obj_t *container) {
+  uint32_t count = lv_obj_get_child_count(container);
+  for (uint32_t i = 0; i < count; i++) {
+    lv_obj_t *child = lv_obj_get_child(container, (int32_t)i);
+    lv_obj_set_style_translate_x(child, offset_x, 0);
+    lv_obj_set_style_translate_y(child, offset_y, 0);
+  }
+}
+
+void burn_in_shift_tick(lv_obj_t *container, time_t now) {
+  if (!burn_in_shift_is_enabled()) {
+    return;
+  }
+
+  int64_t step = (int64_t)now / interval_seconds;
+  if (step == current_step) {
+    return;
+  }
+  current_step = step;
+
+  offset_for_step(step, &offset_x, &offset_y);
+  ESP_LOGD(TAG, "Shifting face to (%d, %d)", (int)offset_x, (int)offset_y);
+  burn_in_shift_apply(container);
+}
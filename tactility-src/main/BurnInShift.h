@@ -0,0 +1,23 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <cstdint>
+#include <time.h>
+
+// Anti-burn-in drift for always-on OLED panels.
+// The face is moved around a (2 * max_offset + 1)^2 pixel grid in a
+// back-and-forth snake pattern, one pixel per step, using the translate style
+// on the face's root objects. Translation does not re-run layout; LVGL only
+// re-flushes the old and new areas of the moved objects.
+
+void burn_in_shift_configure(bool enabled, int32_t max_offset,
+                             uint32_t interval_seconds);
+
+bool burn_in_shift_is_enabled();
+
+// Call from the clock tick; moves the face only when the step changes
+void burn_in_shift_tick(lv_obj_t *container, time_t now);
+
+// Apply the current offset to freshly created face objects
+void burn_in_shift_apply(lv_obj_t *container);
@@ -0,0 +1,154 @@
+#include "CalendarService.h"
+
+#include "FetchSchedule.h"
+#include "HttpFetch.h"
+#include "ServiceTask.h"
+
+#include <esp_log.h>
+
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+constexpr auto *TAG = "Calendar";
+
+constexpr int HTTP_TIMEOUT_MS = 10000;
+constexpr int READ_CHUNK_SIZE = 512;
+
+// Owned by the refresh task and freed when it exits. The parser and the
+// index it builds live here rather than on the task stack.
+struct CalendarTask {
+  CalendarConfig config;
+  IcsParser parser;
+  CalendarIndex index;
+  char chunk[READ_CHUNK_SIZE];
+};
+
+static SemaphoreHandle_t index_mutex;
+static CalendarIndex shared_index;
+static uint32_t shared_version;
+static ServiceTask worker;
+
+static bool read_url(CalendarTask *task) {
+  esp_http_client_config_t http_config;
+  http_config_init(&http_config, task->config.url, HTTP_TIMEOUT_MS);
+  esp_http_client_handle_t client = esp_http_client_init(&http_config);
+  if (!client) {
+    return false;
+  }
+
+  bool ok = false;
+  int status = http_open(client, TAG);
+  if (status == 200) {
+    ok = true;
+    while (!worker.stop) {
+      int length = esp_http_client_read(client, task->chunk, READ_CHUNK_SIZE);
+      if (length < 0) {
+        ESP_LOGW(TAG, "Read failed");
+        ok = false;
+        break;
+      }
+      if (length == 0) {
+        break;
+      }
+      ics_parser_feed(&task->parser, task->chunk, (size_t)length);
+    }
+  } else if (status > 0) {
+    ESP_LOGW(TAG, "HTTP status %d", status);
+  }
+  esp_http_client_close(client);
+  esp_http_client_cleanup(client);
+  return ok && !worker.stop;
+}
+
+static bool read_file(CalendarTask *task) {
+  FILE *file = fopen(task->config.path, "r");
+  if (!file) {
+    ESP_LOGW(TAG, "Cannot open %s", task->config.path);
+    return false;
+  }
+  size_t length;
+  while (!worker.stop &&
+         (length = fread(task->chunk, 1, READ_CHUNK_SIZE, file)) > 0) {
+    ics_parser_feed(&task->parser, task->chunk, length);
+  }
+  bool ok = !ferror(file) && !worker.stop;
+  fclose(file);
+  return ok;
+}
+
+static bool refresh(CalendarTask *task) {
+  time_t now = time(nullptr);
+  calendar_index_clear(&task->index);
+  ics_parser_init(&task->parser, &task->index, now,
+                  now + (time_t)task->config.window_days * 24 * 60 * 60);
+  bool ok = task->config.url[0] ? read_url(task) : read_file(task);
+  if (!ok) {
+    return false;
+  }
+  ics_parser_finish(&task->parser);
+  ESP_LOGI(TAG, "Indexed %d occurrences from %u events", task->index.count,
+           (unsigned)task->parser.events_read);
+
+  xSemaphoreTake(index_mutex, portMAX_DELAY);
+  shared_index = task->index;
+  shared_version++;
+  xSemaphoreGive(index_mutex);
+  return true;
+}
+
+static void calendar_task(void *param) {
+  auto *task = static_cast<CalendarTask *>(param);
+  FetchSchedule schedule;
+  fetch_schedule_init(&schedule);
+  while (!worker.stop) {
+    FetchResult result = refresh(task) ? FetchUpdated : FetchFailed;
+    uint32_t delay_s =
+        fetch_schedule_next(&schedule, result, task->config.interval_s);
+    // Woken early by calendar_service_stop()
+    service_task_sleep(&worker, delay_s * 1000);
+  }
+  delete task;
+  service_task_exit(&worker);
+}
+
+bool calendar_service_start(const CalendarConfig &config) {
+  calendar_service_stop();
+  if (!config.url[0] && !config.path[0]) {
+    return false;
+  }
+  if (!index_mutex) {
+    index_mutex = xSemaphoreCreateMutex();
+    if (!index_mutex) {
+      return false;
+    }
+  }
+
+  auto *task = new (std::nothrow) CalendarTask();
+  if (!task) {
+    return false;
+  }
+  task->config = config;
+  if (!service_task_start(&worker, calendar_task, "calendar", 6144,
+                          tskIDLE_PRIORITY + 1, tskNO_AFFINITY, task)) {
+    delete task;
+    return false;
+  }
+  return true;
+}
+
+void calendar_service_stop() { service_task_stop(&worker); }
+
+bool calendar_service_get(CalendarIndex *index, uint32_t *version) {
+  if (!index_mutex) {
+    return false;
+  }
+  xSemaphoreTake(index_mutex, portMAX_DELAY);
+  bool changed = shared_version != *version;
+  if (changed) {
+    *index = shared_index;
+    *version = shared_version;
+  }
+  xSemaphoreGive(index_mutex);
+  return changed;
+}
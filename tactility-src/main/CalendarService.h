@@ -0,0 +1,27 @@
+#pragma once
+
+#include "IcsParser.h"
+
+#include <cstdint>
+
+constexpr int CALENDAR_SOURCE_SIZE = 160;
+
+// Reads an ICS calendar from a URL or, when the URL is empty, from a file
+// (e.g. one shipped in the app's assets)
+struct CalendarConfig {
+  char url[CALENDAR_SOURCE_SIZE];
+  char path[CALENDAR_SOURCE_SIZE];
+  uint32_t interval_s;
+  uint32_t window_days; // How far ahead occurrences are indexed
+};
+
+// Rebuilds the index in a background task on every refresh. Failed fetches
+// are retried with exponential backoff, keeping the previous index.
+bool calendar_service_start(const CalendarConfig &config);
+
+// Returns once the refresh task has exited
+void calendar_service_stop();
+
+// Copies the index if its version differs from `*version`; safe from any
+// task. Returns false when nothing changed.
+bool calendar_service_get(CalendarIndex *index, uint32_t *version);
@@ -12,9 +12,34 @@
 #include <tt_time.h>
 #include <tt_timer.h>
 
+#include <esp_heap_caps.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include "esp_sntp.h"
-#include <cmath>
+#include "BurnInShift.h"
+#include "CalendarService.h"
+#include "ClockFaces.h"
+#include "ClockFrame.h"
+#include "ClockLayout.h"
+#include "ClockTick.h"
+#include "ClockWidget.h"
+#include "FaceAssets.h"
+#include "FaceCarousel.h"
+#include "FaceTransition.h"
+#include "Metrics.h"
+#include "PowerBudget.h"
+#include "QualityGovernor.h"
+#include "ScreenSleep.h"
+#include "SnapshotCache.h"
+#include "SyncChart.h"
+#include "SyncLog.h"
+#include "SyncMonitor.h"
+#include "TimezonePicker.h"
+#include "Timezones.h"
+#include "WeatherService.h"
+#include "WifiPrompt.h"
+#include "ZoneRule.h"
+#include <math.h>
 #include <time.h>
 
 constexpr auto *TAG = "ClockApp";
@@ -31,25 +56,54 @@ static int getToolbarHeight(UiScale uiScale) {
 // Global state variables
 static lv_obj_t *toolbar;
 static lv_obj_t *clock_container;
-static lv_obj_t *time_label; // Digital
-static lv_obj_t *clock_face; // Analog
-static lv_obj_t *hour_hand;
-static lv_obj_t *minute_hand;
-static lv_obj_t *second_hand;
-static lv_point_precise_t hour_points[2];
-static lv_point_precise_t minute_points[2];
-static lv_point_precise_t second_points[2];
-static lv_timer_t *update_timer = nullptr;
+static lv_obj_t *live_clock;
 static lv_obj_t *wifi_label;
 static lv_obj_t *wifi_button;
 static lv_obj_t *toggle_btn;
-static lv_obj_t *date_label;
+static lv_obj_t *weather_label;
+static uint32_t weather_version; // Report version shown in weather_label
+static lv_obj_t *event_label;
+static CalendarIndex calendar_index;
+static uint32_t calendar_version;
+static time_t event_label_expiry; // When the shown event is no longer next
 static TimerHandle_t sync_check_timer = nullptr;
 static bool last_sync_status;
-static bool is_analog;
+static int current_face = ClockFaceDigital;
+static UiScale ui_scale;
+static FaceTransitionStyle transition_style = FaceTransitionSlide;
+static ClockTickMode tick_mode = ClockTickImmediate;
 static AppHandle app_handle;
 static LockHandle lvgl_mutex;
 static bool needs_redraw = false; // Flag for deferred redraws
+static ClockFaceSettings face_settings = {
+  .ui_scale = UiScaleDefault,
+  .dashboard_zones = {{"UTC", {}}, {"Tokyo", {}}}, // Rules set by load_mode()
+  .locale = nullptr, // Set by load_mode()
+  .locale_hours = false,
+  .hide_seconds = false,
+};
+static WeatherConfig weather_config = {
+  .url = "",
+  .temperature_path = "current.temperature_2m",
+  .code_path = "current.weather_code",
+  .interval_s = 30 * 60,
+};
+static MetricsConfig metrics_config = {
+  .url = "",
+  .device_id = "clock",
+  .window_s = 60,
+  .push_s = 5 * 60,
+};
+static int64_t render_start_us;
+static uint32_t screen_off_ms = 0; // Pausing while blanked is opt-in
+static bool display_antialiasing = true; // As found in onShow
+static time_t fixed_time = 0; // Debug: frozen clock for reference frames
+static CalendarConfig calendar_config = {
+  .url = "",
+  .path = "",
+  .interval_s = 60 * 60,
+  .window_days = 7,
+};
 
 struct AppWrapper {
   void *app;
@@ -57,50 +111,279 @@ struct AppWrapper {
 };
 
 // Forward declarations
-static void update_time_display();
+static void update_time_display(time_t now);
+static void apply_quality(QualityLevel level);
 static void check_sync_status();
-static void toggle_mode();
+static void cycle_face();
 static void redraw_clock();
+static bool is_time_synced();
 
 // Static callback functions
-static void update_timer_cb(lv_timer_t *timer) { 
-  update_time_display(); 
+static void clock_tick_cb(time_t now, const struct tm &timeinfo,
+                          void *user_data) {
+  update_time_display(now);
+}
+
+// Nothing is drawn while the panel is off; waking redraws the current time in
+// one tick
+static void screen_sleep_cb(bool asleep) {
+  clock_tick_set_paused(asleep);
+  power_budget_set_screen_off(asleep);
+  if (asleep) {
+    clock_frames_stop();
+  } else {
+    clock_frames_start(face_settings.locale);
+  }
 }
 
 static void sync_check_callback(void *context) { 
   check_sync_status(); 
 }
 
-static void toggle_mode_cb(lv_event_t *e) { 
-  toggle_mode(); 
+static void cycle_face_cb(lv_event_t *e) { 
+  cycle_face(); 
 }
 
 static void wifi_connect_cb(lv_event_t *e) { 
   tt_app_start("WifiManage"); 
 }
 
+// The daylight saving rule of the IANA zone `name`; UTC when the table
+// does not have it
+static void load_zone_rule(DashboardZone *zone, const char *name) {
+  int index = timezone_find(name);
+  if (index < 0 || !zone_rule_parse(timezone_rule(index), &zone->rule)) {
+    ESP_LOGW(TAG, "Unknown zone %s", name);
+    zone_rule_fixed(&zone->rule, 0);
+  }
+}
+
 static void load_mode() {
   PreferencesHandle prefs = tt_preferences_alloc("clock_settings");
+  int32_t face;
   bool temp;
-  if (tt_preferences_opt_bool(prefs, "is_analog", &temp)) {
-    is_analog = temp;
+  if (tt_preferences_opt_int32(prefs, "face", &face) && face >= 0 &&
+      face < ClockFaceCount) {
+    current_face = face;
+  } else if (tt_preferences_opt_bool(prefs, "is_analog", &temp)) {
+    // Settings written before the carousel existed
+    current_face = temp ? ClockFaceAnalog : ClockFaceDigital;
+  } else {
+    current_face = ClockFaceDigital;
+  }
+  int32_t style;
+  if (tt_preferences_opt_int32(prefs, "transition", &style) &&
+      style >= FaceTransitionNone && style <= FaceTransitionCrossfade) {
+    transition_style = (FaceTransitionStyle)style;
+  } else {
+    transition_style = FaceTransitionSlide;
+  }
+  // How each second reaches the panel: 0 renders at once, 1 on refresh
+  int32_t mode;
+  if (tt_preferences_opt_int32(prefs, "tick_mode", &mode) &&
+      mode >= ClockTickImmediate && mode <= ClockTickOnRefresh) {
+    tick_mode = (ClockTickMode)mode;
+  } else {
+    tick_mode = ClockTickImmediate;
+  }
+  int32_t budget_kb;
+  if (tt_preferences_opt_int32(prefs, "snapshot_budget_kb", &budget_kb) &&
+      budget_kb >= 0) {
+    snapshot_cache_set_budget((size_t)budget_kb * 1024);
   } else {
-    is_analog = false;
+    snapshot_cache_set_budget(snapshot_cache_default_budget());
   }
+  // Pixel shift for OLED panels, off by default
+  bool shift_enabled = false;
+  int32_t shift_pixels = 2;
+  int32_t shift_interval = 60;
+  tt_preferences_opt_bool(prefs, "burn_in_shift", &shift_enabled);
+  tt_preferences_opt_int32(prefs, "burn_in_pixels", &shift_pixels);
+  tt_preferences_opt_int32(prefs, "burn_in_interval_s", &shift_interval);
+  burn_in_shift_configure(shift_enabled, LV_CLAMP(0, shift_pixels, 8),
+                          (uint32_t)LV_MAX(shift_interval, 1));
+  // Day and month names and date patterns, e.g. locale = "de"; locale_hours
+  // also takes 12/24-hour from the locale instead of the system setting
+  char locale_code[8] = "";
+  tt_preferences_opt_string(prefs, "locale", locale_code, sizeof(locale_code));
+  face_settings.locale = locale_find(locale_code);
+  if (!face_settings.locale) {
+    if (locale_code[0]) {
+      ESP_LOGW(TAG, "Locale %s is not built in", locale_code);
+    }
+    face_settings.locale = locale_default();
+  }
+  face_settings.locale_hours = false;
+  tt_preferences_opt_bool(prefs, "locale_hours", &face_settings.locale_hours);
+  // Dashboard zones, e.g. dash_zone1_name = "New York",
+  // dash_zone1_tz = "America/New_York". A fixed dash_zone1_min = -300 from
+  // before zones had rules still applies when no dash_zone1_tz is set.
+  static const char *const default_zones[DASHBOARD_ZONE_COUNT] = {
+      "UTC", "Asia/Tokyo"};
+  for (int i = 0; i < DASHBOARD_ZONE_COUNT; i++) {
+    char name_key[16];
+    char tz_key[16];
+    char offset_key[16];
+    snprintf(name_key, sizeof(name_key), "dash_zone%d_name", i + 1);
+    snprintf(tz_key, sizeof(tz_key), "dash_zone%d_tz", i + 1);
+    snprintf(offset_key, sizeof(offset_key), "dash_zone%d_min", i + 1);
+    DashboardZone &zone = face_settings.dashboard_zones[i];
+    tt_preferences_opt_string(prefs, name_key, zone.name, sizeof(zone.name));
+    char tz_name[48];
+    int32_t offset_minutes;
+    if (tt_preferences_opt_string(prefs, tz_key, tz_name, sizeof(tz_name))) {
+      load_zone_rule(&zone, tz_name);
+    } else if (tt_preferences_opt_int32(prefs, offset_key, &offset_minutes)) {
+      zone_rule_fixed(&zone.rule, offset_minutes * 60);
+    } else {
+      load_zone_rule(&zone, default_zones[i]);
+    }
+  }
+  // Weather complication, disabled while weather_url is empty
+  int32_t weather_minutes = 30;
+  tt_preferences_opt_string(prefs, "weather_url", weather_config.url,
+                            sizeof(weather_config.url));
+  tt_preferences_opt_string(prefs, "weather_temp",
+                            weather_config.temperature_path,
+                            sizeof(weather_config.temperature_path));
+  tt_preferences_opt_string(prefs, "weather_code", weather_config.code_path,
+                            sizeof(weather_config.code_path));
+  tt_preferences_opt_int32(prefs, "weather_min", &weather_minutes);
+  weather_config.interval_s =
+      (uint32_t)LV_CLAMP(5, weather_minutes, 24 * 60) * 60;
+  // Next calendar event from calendar_url, or calendar_file in the assets
+  char calendar_file[64] = "";
+  int32_t calendar_minutes = 60;
+  int32_t calendar_days = 7;
+  tt_preferences_opt_string(prefs, "calendar_url", calendar_config.url,
+                            sizeof(calendar_config.url));
+  tt_preferences_opt_string(prefs, "calendar_file", calendar_file,
+                            sizeof(calendar_file));
+  tt_preferences_opt_int32(prefs, "calendar_min", &calendar_minutes);
+  tt_preferences_opt_int32(prefs, "calendar_days", &calendar_days);
+  calendar_config.path[0] = '\0';
+  if (calendar_file[0]) {
+    char assets[CALENDAR_SOURCE_SIZE];
+    size_t assets_size = sizeof(assets);
+    tt_app_get_assets_path(app_handle, assets, &assets_size);
+    snprintf(calendar_config.path, sizeof(calendar_config.path), "%s/%s",
+             assets, calendar_file);
+  }
+  calendar_config.interval_s =
+      (uint32_t)LV_CLAMP(5, calendar_minutes, 24 * 60) * 60;
+  calendar_config.window_days = (uint32_t)LV_CLAMP(1, calendar_days, 31);
+  // Fleet metrics, disabled while metrics_url is empty
+  int32_t metrics_window = 60;
+  int32_t metrics_push = 5 * 60;
+  tt_preferences_opt_string(prefs, "metrics_url", metrics_config.url,
+                            sizeof(metrics_config.url));
+  tt_preferences_opt_string(prefs, "metrics_id", metrics_config.device_id,
+                            sizeof(metrics_config.device_id));
+  tt_preferences_opt_int32(prefs, "metrics_window_s", &metrics_window);
+  tt_preferences_opt_int32(prefs, "metrics_push_s", &metrics_push);
+  metrics_config.window_s = (uint32_t)LV_CLAMP(10, metrics_window, 60 * 60);
+  metrics_config.push_s = (uint32_t)LV_CLAMP(30, metrics_push, 24 * 60 * 60);
+  // Device power model for the estimates, e.g. power_disp_ua = 30000
+  PowerModel power_model = power_model_default();
+  tt_preferences_opt_int32(prefs, "power_active_ua", &power_model.active_ua);
+  tt_preferences_opt_int32(prefs, "power_idle_ua", &power_model.idle_ua);
+  tt_preferences_opt_int32(prefs, "power_disp_ua", &power_model.display_ua);
+  tt_preferences_opt_int32(prefs, "power_wake_nc", &power_model.wakeup_nc);
+  tt_preferences_opt_int32(prefs, "power_flush_nc", &power_model.flush_nc_kb);
+  power_budget_configure(power_model);
+  // Pause while the panel is blanked, e.g. screen_off_s = 60. It must match
+  // the system display timeout, which apps cannot read: a shorter one would
+  // freeze a clock still on screen, so 0 (always update) is the default.
+  int32_t screen_off_s = 0;
+  tt_preferences_opt_int32(prefs, "screen_off_s", &screen_off_s);
+  screen_off_ms = (uint32_t)LV_CLAMP(0, screen_off_s, 24 * 60 * 60) * 1000;
+  // Quality governor thresholds, e.g. gov_render_hi = 40000 (us)
+  GovernorConfig governor = governor_config_default();
+  int32_t render_high = (int32_t)governor.render_high_us;
+  int32_t render_low = (int32_t)governor.render_low_us;
+  int32_t idle_low = (int32_t)governor.idle_low_pct;
+  int32_t idle_high = (int32_t)governor.idle_high_pct;
+  tt_preferences_opt_bool(prefs, "governor", &governor.enabled);
+  tt_preferences_opt_int32(prefs, "gov_render_hi", &render_high);
+  tt_preferences_opt_int32(prefs, "gov_render_lo", &render_low);
+  tt_preferences_opt_int32(prefs, "gov_idle_lo", &idle_low);
+  tt_preferences_opt_int32(prefs, "gov_idle_hi", &idle_high);
+  governor.render_high_us = (uint32_t)LV_CLAMP(1000, render_high, 1000000);
+  governor.render_low_us =
+      (uint32_t)LV_CLAMP(0, render_low, (int32_t)governor.render_high_us);
+  governor.idle_low_pct = (uint32_t)LV_CLAMP(0, idle_low, 100);
+  governor.idle_high_pct =
+      (uint32_t)LV_CLAMP((int32_t)governor.idle_low_pct, idle_high, 100);
+  quality_governor_configure(governor);
+  // Frozen time for repeatable frames, e.g. fixed_time = 1700000000 (UTC);
+  // render times are then logged per frame
+  int32_t fixed = 0;
+  tt_preferences_opt_int32(prefs, "fixed_time", &fixed);
+  fixed_time = LV_MAX(fixed, 0);
   tt_preferences_free(prefs);
 }
 
 static void save_mode() {
   PreferencesHandle prefs = tt_preferences_alloc("clock_settings");
-  tt_preferences_put_bool(prefs, "is_analog", is_analog);
+  tt_preferences_put_int32(prefs, "face", current_face);
   tt_preferences_free(prefs);
 }
 
-static void toggle_mode() {
-  is_analog = !is_analog;
+static void cycle_face() {
+  current_face = (current_face + 1) % ClockFaceCount;
   save_mode();
-  ESP_LOGI("Clock", "Toggling mode to: %s", is_analog ? "analog" : "digital");
+  ESP_LOGI("Clock", "Switching face to: %s", clock_faces[current_face].name);
+  face_transition_start(clock_container, transition_style, 1, redraw_clock);
+  face_carousel_prewarm();
+}
+
+// A zone picked for a dashboard cell replaces that cell's zone
+static void dashboard_zone_chosen(int zone, void *user_data) {
+  auto slot = (int)(intptr_t)user_data;
+  DashboardZone &target = face_settings.dashboard_zones[slot];
+  size_t length = 0;
+  for (const char *c = timezone_city(zone);
+       *c && length + 1 < sizeof(target.name); c++) {
+    target.name[length++] = *c == '_' ? ' ' : *c;
+  }
+  target.name[length] = '\0';
+  load_zone_rule(&target, timezone_name(zone));
+
+  char name_key[16];
+  char tz_key[16];
+  snprintf(name_key, sizeof(name_key), "dash_zone%d_name", slot + 1);
+  snprintf(tz_key, sizeof(tz_key), "dash_zone%d_tz", slot + 1);
+  PreferencesHandle prefs = tt_preferences_alloc("clock_settings");
+  tt_preferences_put_string(prefs, name_key, target.name);
+  tt_preferences_put_string(prefs, tz_key, timezone_name(zone));
+  tt_preferences_free(prefs);
+  ESP_LOGI(TAG, "Dashboard zone %d set to %s", slot + 1, timezone_name(zone));
+
+  snapshot_cache_clear();
   redraw_clock();
+  face_carousel_prewarm();
+}
+
+// Long press on a dashboard zone cell opens the zone picker for it,
+// anywhere else the sync history
+static void clock_long_pressed_cb(lv_event_t *e) {
+  if (!live_clock || face_carousel_is_dragging()) {
+    return;
+  }
+  lv_obj_t *parent = lv_obj_get_parent(clock_container);
+  lv_indev_t *indev = lv_indev_active();
+  if (indev && current_face == ClockFaceDashboard) {
+    lv_point_t point;
+    lv_indev_get_point(indev, &point);
+    int slot = dashboard_zone_at(
+        &clock_widget_get_view(live_clock)->dashboard, &point);
+    if (slot >= 0) {
+      timezone_picker_open(parent, dashboard_zone_chosen,
+                           (void *)(intptr_t)slot);
+      return;
+    }
+  }
+  sync_chart_open(parent);
 }
 
 // Check time sync by verifying year > 1970
@@ -127,81 +410,154 @@ static void check_sync_status() {
 static void check_and_redraw() {
   if (needs_redraw) {
     needs_redraw = false;
+    // Cached snapshots may show the Wi-Fi prompt or a stale face
+    snapshot_cache_clear();
     redraw_clock();
+    face_carousel_prewarm();
+  }
+}
+
+// Show the cached weather report once a newer one arrives
+static void update_weather_label() {
+  if (!weather_label) {
+    return;
+  }
+  WeatherReport report;
+  weather_service_get(&report);
+  if (report.version == weather_version) {
+    return;
+  }
+  weather_version = report.version;
+  if (!report.valid) {
+    lv_label_set_text(weather_label, "");
+    return;
+  }
+  // LVGL's printf has no float support by default
+  lv_label_set_text_fmt(weather_label, "%d\xC2\xB0 %s",
+                        (int)lroundf(report.temperature),
+                        weather_code_text(report.code));
+  lv_obj_align_to(weather_label, toggle_btn, LV_ALIGN_OUT_LEFT_MID, -8, 0);
+}
+
+// Show the next calendar event under the clock. The text only changes when
+// the index is refreshed or the shown event starts.
+static void update_event_label(time_t now) {
+  bool changed = calendar_service_get(&calendar_index, &calendar_version);
+  if (!event_label || (!changed && now < event_label_expiry)) {
+    return;
+  }
+  const CalendarEvent *event = calendar_index_next(&calendar_index, now);
+  if (!event) {
+    lv_label_set_text(event_label, "");
+    event_label_expiry = now + 60 * 60;
+    return;
+  }
+
+  struct tm start;
+  struct tm today;
+  localtime_r(&event->start, &start);
+  localtime_r(&now, &today);
+  bool is_today =
+      start.tm_yday == today.tm_yday && start.tm_year == today.tm_year;
+  char when[24];
+  if (event->all_day) {
+    locale_format(when, sizeof(when), is_today ? "Today" : "%a",
+                  face_settings.locale, start);
+    event_label_expiry = event->start + 24 * 60 * 60 + 1;
+  } else {
+    const char *format = clock_face_is_24_hour(face_settings)
+                             ? (is_today ? "%H:%M" : "%a %H:%M")
+                             : (is_today ? "%I:%M %p" : "%a %I:%M %p");
+    locale_format(when, sizeof(when), format, face_settings.locale, start);
+    event_label_expiry = event->start + 1;
+  }
+  lv_label_set_text_fmt(event_label, "%s  %s", when, event->summary);
+}
+
+// Once per tick; frame render cost is recorded by the display callbacks
+static void sample_metrics(time_t now) {
+  if (sync_monitor_sample()) {
+    const SyncStatus &sync = sync_monitor_status();
+    if (sync.has_drift) {
+      metrics_record(MetricDrift, (int32_t)sync.drift_ppm);
+    }
+    SyncRecord record = {};
+    record.time = now;
+    record.offset_us = sync.last_step_us;
+    record.drift_ppb = sync.has_drift ? (int32_t)(sync.drift_ppm * 1000) : 0;
+    record.source = sync.last_source;
+    sync_log_append(record);
+    sync_chart_add(record);
+  }
+  if (!metrics_is_enabled()) {
+    return;
+  }
+  int32_t sync_age = sync_monitor_age_s();
+  if (sync_age >= 0) {
+    metrics_record(MetricSyncAge, sync_age);
+  }
+  metrics_record(MetricHeapFree,
+                 (int32_t)heap_caps_get_free_size(MALLOC_CAP_8BIT));
+  metrics_record(MetricHeapLowWater,
+                 (int32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
+  metrics_record(MetricQuality, quality_governor_level());
+  metrics_tick(now);
+}
+
+static void render_start_cb(lv_event_t *e) {
+  render_start_us = esp_timer_get_time();
+}
+
+static void render_ready_cb(lv_event_t *e) {
+  int64_t end_us = esp_timer_get_time();
+  metrics_record(MetricRenderCost, (int32_t)(end_us - render_start_us));
+  power_budget_add_busy(render_start_us, end_us);
+  quality_governor_add_render(end_us - render_start_us);
+}
+
+static void flush_start_cb(lv_event_t *e) {
+  auto *area = static_cast<const lv_area_t *>(lv_event_get_param(e));
+  auto *display = static_cast<lv_display_t *>(lv_event_get_target(e));
+  if (area) {
+    power_budget_add_flush(
+        lv_area_get_size(area) *
+        lv_color_format_get_size(lv_display_get_color_format(display)));
   }
 }
 
-// Update time display
-static void update_time_display() {
+// Update time display; runs before the clock widgets on the shared tick
+static void update_time_display(time_t now) {
   // First check if we need to redraw due to sync status change
   check_and_redraw();
 
-  time_t now;
-  struct tm timeinfo;
-  ::time(&now);
-  localtime_r(&now, &timeinfo);
+  burn_in_shift_tick(clock_container, now);
 
   // If not synced, update wifi label
   if (!is_time_synced()) {
     if (wifi_label && lv_obj_is_valid(wifi_label)) {
       lv_label_set_text(wifi_label, "No Wi-Fi - Time not synced");
     }
-    return;
   }
 
-  if (is_analog && clock_face && lv_obj_is_valid(clock_face)) {
-    lv_coord_t clock_size = lv_obj_get_width(clock_face);
-    lv_coord_t center_x = clock_size / 2;
-    lv_coord_t center_y = clock_size / 2;
-
-    // Scale hand lengths based on clock size
-    lv_coord_t hour_length = clock_size * 0.25;
-    lv_coord_t minute_length = clock_size * 0.35;
-    lv_coord_t second_length = clock_size * 0.4;
-
-    float hour_angle =
-        (timeinfo.tm_hour % 12 + timeinfo.tm_min / 60.0f) * 30.0f - 90;
-    float minute_angle = timeinfo.tm_min * 6.0f - 90;
-    float second_angle = timeinfo.tm_sec * 6.0f - 90;
+  update_weather_label();
+  update_event_label(now);
+  sample_metrics(now);
+  power_budget_tick();
+  if (quality_governor_tick(now)) {
+    apply_quality(quality_governor_level());
+  }
+}
 
-    if (hour_hand && lv_obj_is_valid(hour_hand)) {
-      hour_points[1].x =
-          center_x + (lv_coord_t)(hour_length * cos(hour_angle * M_PI / 180));
-      hour_points[1].y =
-          center_y + (lv_coord_t)(hour_length * sin(hour_angle * M_PI / 180));
-      lv_line_set_points(hour_hand, hour_points, 2);
-    }
-    if (minute_hand && lv_obj_is_valid(minute_hand)) {
-      minute_points[1].x =
-          center_x +
-          (lv_coord_t)(minute_length * cos(minute_angle * M_PI / 180));
-      minute_points[1].y =
-          center_y +
-          (lv_coord_t)(minute_length * sin(minute_angle * M_PI / 180));
-      lv_line_set_points(minute_hand, minute_points, 2);
-    }
-    if (second_hand && lv_obj_is_valid(second_hand)) {
-      second_points[1].x =
-          center_x +
-          (lv_coord_t)(second_length * cos(second_angle * M_PI / 180));
-      second_points[1].y =
-          center_y +
-          (lv_coord_t)(second_length * sin(second_angle * M_PI / 180));
-      lv_line_set_points(second_hand, second_points, 2);
-    }
-    if (date_label && lv_obj_is_valid(date_label)) {
-      char date_str[16];
-      strftime(date_str, sizeof(date_str), "%m/%d", &timeinfo);
-      lv_label_set_text(date_label, date_str);
-    }
-  } else if (!is_analog && time_label && lv_obj_is_valid(time_label)) {
-    char time_str[16];
-    if (tt_timezone_is_format_24_hour()) {
-      strftime(time_str, sizeof(time_str), "%H:%M:%S", &timeinfo);
-    } else {
-      strftime(time_str, sizeof(time_str), "%I:%M:%S %p", &timeinfo);
-    }
-    lv_label_set_text(time_label, time_str);
+// Levels are cumulative; dropping seconds rebuilds the face without them
+static void apply_quality(QualityLevel level) {
+  lv_display_t *display = lv_obj_get_display(clock_container);
+  lv_display_set_antialiasing(display, display_antialiasing &&
+                                           level < QualityNoAntialias);
+  clock_tick_set_interval(level >= QualityMinutes ? 60 : 1);
+  bool hide_seconds = level >= QualityNoSeconds;
+  if (hide_seconds != face_settings.hide_seconds) {
+    face_settings.hide_seconds = hide_seconds;
+    redraw_clock();
   }
 }
 
@@ -217,255 +573,177 @@ static void update_toggle_button_visibility() {
   }
 }
 
-static void get_display_metrics(lv_coord_t *width, lv_coord_t *height,
-                                bool *is_small) {
-  *width = lv_obj_get_width(clock_container);
-  *height = lv_obj_get_height(clock_container);
-  *is_small = (*width < 240 || *height < 180);
+static const ClockLayout *get_layout(lv_obj_t *container) {
+  return clock_layout_get(lv_obj_get_width(container),
+                          lv_obj_get_height(container), ui_scale);
 }
 
 static void create_wifi_prompt() {
-  lv_coord_t width, height;
-  bool is_small;
-  get_display_metrics(&width, &height, &is_small);
-
-  // Create a card-style container for the WiFi prompt
-  lv_obj_t *card = lv_obj_create(clock_container);
-  lv_obj_set_size(card, LV_PCT(90), LV_SIZE_CONTENT);
-  lv_obj_set_style_radius(card, is_small ? 8 : 16, 0);
-  lv_obj_set_layout(card, LV_LAYOUT_FLEX);
-  lv_obj_set_flex_flow(card, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_flex_align(card, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-  lv_obj_set_style_bg_color(card, lv_color_hex(0x333333), 0);
-  lv_obj_set_style_bg_opa(card, LV_OPA_10, 0);
-  lv_obj_set_style_border_width(card, 1, 0);
-  lv_obj_set_style_border_color(card, lv_color_hex(0x666666), 0);
-  lv_obj_set_style_border_opa(card, LV_OPA_30, 0);
-  lv_obj_set_style_pad_all(card, is_small ? 12 : 20, 0);
-  lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
-
-  // WiFi icon
-  lv_obj_t *icon = lv_label_create(card);
-  lv_label_set_text(icon, LV_SYMBOL_WIFI);
-  lv_obj_align(icon, LV_ALIGN_TOP_MID, 0, 0);
-  lv_obj_set_style_text_font(icon, lv_font_get_default(), 0);
-  lv_obj_set_style_text_color(icon, lv_color_hex(0xFF9500), 0);
-
-  // Title
-  wifi_label = lv_label_create(card);
-  lv_label_set_text(wifi_label, "Time Not Synced");
-  lv_obj_align_to(wifi_label, icon, LV_ALIGN_OUT_BOTTOM_MID, 0,
-                  is_small ? 8 : 12);
-  lv_obj_set_style_text_font(wifi_label, lv_font_get_default(), 0);
-  lv_obj_set_style_text_align(wifi_label, LV_TEXT_ALIGN_CENTER, 0);
-
-  // Subtitle
-  lv_obj_t *subtitle = lv_label_create(card);
-  lv_label_set_text(subtitle, "Connect to Wi-Fi to sync time");
-  lv_obj_align_to(subtitle, wifi_label, LV_ALIGN_OUT_BOTTOM_MID, 0, 4);
-  lv_obj_set_style_text_font(subtitle, lv_font_get_default(), 0);
-  lv_obj_set_style_text_color(subtitle, lv_color_hex(0x888888), 0);
-  lv_obj_set_style_text_align(subtitle, LV_TEXT_ALIGN_CENTER, 0);
-
-  // Connect button
-  wifi_button = lv_btn_create(card);
-  lv_obj_set_size(wifi_button, LV_PCT(80), is_small ? 28 : 36);
-  lv_obj_align_to(wifi_button, subtitle, LV_ALIGN_OUT_BOTTOM_MID, 0,
-                  is_small ? 12 : 16);
-  lv_obj_set_style_radius(wifi_button, is_small ? 6 : 8, 0);
-  lv_obj_set_style_bg_color(wifi_button, lv_color_hex(0x007BFF), 0);
-
-  lv_obj_t *btn_label = lv_label_create(wifi_button);
-  lv_label_set_text(btn_label, "Connect to Wi-Fi");
-  lv_obj_center(btn_label);
-  lv_obj_set_style_text_font(btn_label, lv_font_get_default(), 0);
-  lv_obj_set_style_text_color(btn_label, lv_color_hex(0xFFFFFF), 0);
-
-  lv_obj_add_event_cb(wifi_button, wifi_connect_cb, LV_EVENT_CLICKED,
-                      app_handle);
-}
-
-static void create_analog_clock() {
-  lv_coord_t width, height;
-  bool is_small;
-  get_display_metrics(&width, &height, &is_small);
-
-  // Calculate optimal clock size
-  lv_coord_t max_size = LV_MIN(width * 0.85, height * 0.75);
-  lv_coord_t clock_size = LV_MAX(max_size, is_small ? 120 : 200);
-
-  // Create clock face background
-  clock_face = lv_obj_create(clock_container);
-  lv_obj_set_size(clock_face, clock_size, clock_size);
-  lv_obj_center(clock_face);
-  lv_obj_set_style_radius(clock_face, LV_RADIUS_CIRCLE, 0);
-  lv_obj_set_style_bg_color(clock_face, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_bg_opa(clock_face, LV_OPA_10, 0);
-  lv_obj_set_style_border_width(clock_face, is_small ? 2 : 3, 0);
-  lv_obj_set_style_border_color(clock_face, lv_palette_main(LV_PALETTE_GREY), 0);
-  lv_obj_set_style_border_opa(clock_face, LV_OPA_50, 0);
-  lv_obj_set_style_pad_all(clock_face, 0, 0);
-  lv_obj_clear_flag(clock_face, LV_OBJ_FLAG_SCROLLABLE);
-
-  lv_coord_t center_x = clock_size / 2;
-  lv_coord_t center_y = clock_size / 2;
-
-  // Add hour markers
-  for (int i = 0; i < 12; i++) {
-    float angle = i * 30.0f * M_PI / 180.0f;
-    lv_coord_t marker_length =
-        (i % 3 == 0) ? (clock_size / 8) : (clock_size / 14);
-    lv_coord_t marker_width =
-        (i % 3 == 0) ? (is_small ? 3 : 4) : (is_small ? 1 : 2);
-    lv_coord_t r_outer = clock_size / 2 - 4;
-    lv_coord_t r_inner = r_outer - marker_length;
-    float x0 = center_x + r_inner * cos(angle - M_PI / 2);
-    float y0 = center_y + r_inner * sin(angle - M_PI / 2);
-    float x1 = center_x + r_outer * cos(angle - M_PI / 2);
-    float y1 = center_y + r_outer * sin(angle - M_PI / 2);
-    lv_point_precise_t marker_points[2];
-    marker_points[0].x = x0;
-    marker_points[0].y = y0;
-    marker_points[1].x = x1;
-    marker_points[1].y = y1;
-    lv_obj_t *marker = lv_line_create(clock_face);
-    lv_line_set_points(marker, marker_points, 2);
-    lv_obj_set_style_line_width(marker, marker_width, 0);
-    lv_obj_set_style_line_color(marker, lv_color_hex(0x999999), 0);
-    lv_obj_set_style_line_rounded(marker, true, 0);
-  }
-
-  // Calculate hand lengths
-  lv_coord_t hour_length = clock_size * 0.25;
-  lv_coord_t minute_length = clock_size * 0.35;
-  lv_coord_t second_length = clock_size * 0.4;
-
-  // Initialize hour hand pointing up (12 o'clock position)
-  hour_points[0].x = center_x;
-  hour_points[0].y = center_y;
-  hour_points[1].x = center_x;
-  hour_points[1].y = center_y - hour_length;
-  hour_hand = lv_line_create(clock_face);
-  lv_line_set_points(hour_hand, hour_points, 2);
-  lv_obj_set_style_line_width(hour_hand, is_small ? 4 : 6, 0);
-  lv_obj_set_style_line_color(hour_hand, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_line_opa(hour_hand, LV_OPA_COVER, 0);
-  lv_obj_set_style_line_rounded(hour_hand, true, 0);
-
-  // Initialize minute hand pointing up
-  minute_points[0].x = center_x;
-  minute_points[0].y = center_y;
-  minute_points[1].x = center_x;
-  minute_points[1].y = center_y - minute_length;
-  minute_hand = lv_line_create(clock_face);
-  lv_line_set_points(minute_hand, minute_points, 2);
-  lv_obj_set_style_line_width(minute_hand, is_small ? 3 : 4, 0);
-  lv_obj_set_style_line_color(minute_hand, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_line_opa(minute_hand, LV_OPA_COVER, 0);
-  lv_obj_set_style_line_rounded(minute_hand, true, 0);
-
-  // Initialize second hand pointing up
-  second_points[0].x = center_x;
-  second_points[0].y = center_y;
-  second_points[1].x = center_x;
-  second_points[1].y = center_y - second_length;
-  second_hand = lv_line_create(clock_face);
-  lv_line_set_points(second_hand, second_points, 2);
-  lv_obj_set_style_line_width(second_hand, 2, 0);
-  lv_obj_set_style_line_color(second_hand, lv_color_hex(0xFF0000), 0);
-  lv_obj_set_style_line_opa(second_hand, LV_OPA_COVER, 0);
-  lv_obj_set_style_line_rounded(second_hand, true, 0);
-
-  // Center dot
-  lv_obj_t *center = lv_obj_create(clock_face);
-  lv_obj_set_size(center, is_small ? 8 : 12, is_small ? 8 : 12);
-  lv_obj_center(center);
-  lv_obj_set_style_radius(center, LV_RADIUS_CIRCLE, 0);
-  lv_obj_set_style_bg_color(center, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_border_width(center, 0, 0);
-
-  // Date label
-  date_label = lv_label_create(clock_face);
-  lv_obj_align(date_label, LV_ALIGN_BOTTOM_MID, 0, -15);
-  lv_obj_set_style_text_font(date_label, lv_font_get_default(), 0);
-  lv_obj_set_style_text_color(date_label, lv_color_hex(0xAAAAAA), 0);
-
-  // Now update hands to actual time
-  update_time_display();
-}
-
-static void create_digital_clock() {
-  lv_coord_t width, height;
-  bool is_small;
-  get_display_metrics(&width, &height, &is_small);
-
-  // Create main time display
-  time_label = lv_label_create(clock_container);
-  lv_obj_align(time_label, LV_ALIGN_CENTER, 0, is_small ? -25 : -35);
-  lv_obj_set_style_text_align(time_label, LV_TEXT_ALIGN_CENTER, 0);
-
-  const lv_font_t *time_font = lv_font_get_default();
-  lv_obj_set_style_text_font(time_label, time_font, 0);
-
-  lv_obj_set_style_text_color(time_label, lv_color_hex(0xFFFFFF), 0);
-  lv_obj_set_style_bg_color(time_label, lv_color_hex(0x000000), 0);
-  lv_obj_set_style_bg_opa(time_label, LV_OPA_30, 0);
-  lv_obj_set_style_radius(time_label, is_small ? 12 : 16, 0);
-  lv_obj_set_style_pad_all(time_label, is_small ? 20 : 28, 0);
-  lv_obj_set_style_border_width(time_label, 2, 0);
-  lv_obj_set_style_border_color(time_label, lv_color_hex(0x444444), 0);
-  lv_obj_set_style_border_opa(time_label, LV_OPA_50, 0);
-
-  // Create date display
-  date_label = lv_label_create(clock_container);
-  lv_obj_align_to(date_label, time_label, LV_ALIGN_OUT_BOTTOM_MID, 0,
-                  is_small ? 12 : 16);
-  lv_obj_set_style_text_align(date_label, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(date_label, lv_font_get_default(), 0);
-  lv_obj_set_style_text_color(date_label, lv_color_hex(0xaaaaaa), 0);
-  lv_obj_set_style_pad_all(date_label, is_small ? 8 : 10, 0);
-
-  // Update date
-  time_t now;
-  struct tm timeinfo;
-  ::time(&now);
-  localtime_r(&now, &timeinfo);
+  WifiPrompt prompt;
+  wifi_prompt_create(&prompt, clock_container, get_layout(clock_container),
+                     wifi_connect_cb, app_handle);
+  wifi_label = prompt.title;
+  wifi_button = prompt.button;
+}
 
-  char date_str[64];
-  if (is_small) {
-    strftime(date_str, sizeof(date_str), "%m/%d/%Y", &timeinfo);
-  } else {
-    strftime(date_str, sizeof(date_str), "%A, %B %d, %Y", &timeinfo);
-  }
-  lv_label_set_text(date_label, date_str);
+// Heap health after a face rebuild. Over a long uptime the largest free block
+// shrinking relative to total free memory is the sign of fragmentation.
+static void log_heap_fragmentation() {
+  size_t free_size = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  unsigned fragmented =
+      free_size ? (unsigned)(100 - largest * 100 / free_size) : 0;
+  ESP_LOGI(TAG, "Heap: %u free, %u largest block, %u minimum, %u%% fragmented",
+           (unsigned)free_size, (unsigned)largest,
+           (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT),
+           fragmented);
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+  lv_mem_monitor_t monitor;
+  lv_mem_monitor(&monitor);
+  ESP_LOGI(TAG, "LVGL pool: %u free, %u largest block, %u%% fragmented",
+           (unsigned)monitor.free_size, (unsigned)monitor.free_biggest_size,
+           (unsigned)monitor.frag_pct);
+#endif
+}
 
-  update_time_display();
+// Floats over the bottom of the face, outside the container's flex layout
+static void create_event_label() {
+  event_label = lv_label_create(clock_container);
+  lv_obj_add_flag(event_label, LV_OBJ_FLAG_FLOATING);
+  lv_label_set_text(event_label, "");
+  lv_obj_set_style_text_color(event_label, lv_color_hex(0x888888), 0);
+  lv_obj_align(event_label, LV_ALIGN_BOTTOM_MID, 0, -4);
+  event_label_expiry = 0;
+  update_event_label(time(nullptr));
 }
 
 static void redraw_clock() {
   // Clear the clock container
   lv_obj_clean(clock_container);
-  time_label = nullptr;
-  clock_face = hour_hand = minute_hand = second_hand = nullptr;
+  live_clock = nullptr;
+  event_label = nullptr;
   wifi_label = nullptr;
   wifi_button = nullptr;
-  date_label = nullptr;
 
   // Update toggle button visibility
   update_toggle_button_visibility();
 
   if (!is_time_synced()) {
     create_wifi_prompt();
-  } else if (is_analog) {
-    create_analog_clock();
+    power_budget_set_face(-1);
   } else {
-    create_digital_clock();
+    live_clock = clock_widget_create(clock_container, current_face,
+                                     face_settings);
+    create_event_label();
+    power_budget_set_face(current_face);
   }
+  burn_in_shift_apply(clock_container);
 
   // Force invalidation
   lv_obj_invalidate(clock_container);
+  log_heap_fragmentation();
+}
+
+static void style_clock_container(lv_obj_t *container) {
+  lv_obj_set_style_border_width(container, 0, 0);
+  // Clock widgets fill the container and carry their own padding
+  lv_obj_set_style_pad_all(container, 0, 0);
+  lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
+
+  lv_obj_set_layout(container, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(container, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_flex_align(container, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+}
+
+// The live clock widget re-applies its own layout; cached snapshots and the
+// Wi-Fi prompt have to be rebuilt for the new size
+static void apply_clock_layout() {
+  face_transition_finish();
+  snapshot_cache_clear();
+
+  if (!live_clock) {
+    redraw_clock();
+  }
+  face_carousel_prewarm();
+}
+
+static void resize_clock_container() {
+  lv_obj_t *parent = lv_obj_get_parent(clock_container);
+  lv_obj_update_layout(parent);
+  lv_coord_t container_height =
+      lv_obj_get_height(parent) - getToolbarHeight(ui_scale);
+  lv_obj_set_size(clock_container, lv_obj_get_width(parent), container_height);
+}
+
+static void container_size_changed_cb(lv_event_t *e) {
+  apply_clock_layout();
+}
+
+static void parent_size_changed_cb(lv_event_t *e) {
+  resize_clock_container();
 }
 
+// Display rotation; the parent may not be resized for us
+static void resolution_changed_cb(lv_event_t *e) {
+  if (clock_container) {
+    resize_clock_container();
+  }
+}
+
+// Instantiate a face in a scratch container outside the visible area and
+// capture it. Used by the carousel to fill its snapshot cache.
+static lv_draw_buf_t *render_face_offscreen(int face) {
+  lv_coord_t width = lv_obj_get_width(clock_container);
+  lv_coord_t height = lv_obj_get_height(clock_container);
+
+  lv_obj_t *scratch = lv_obj_create(lv_obj_get_parent(clock_container));
+  lv_obj_add_flag(scratch, LV_OBJ_FLAG_IGNORE_LAYOUT);
+  style_clock_container(scratch);
+  lv_obj_set_size(scratch, width, height);
+  lv_obj_set_pos(scratch, -2 * width, 0);
+  lv_obj_update_layout(scratch);
+
+  clock_widget_create(scratch, face, face_settings);
+  // Match the live face so the carousel does not jump on settle
+  burn_in_shift_apply(scratch);
+  lv_obj_update_layout(scratch);
+
+  lv_draw_buf_t *snapshot = lv_snapshot_take(scratch, LV_COLOR_FORMAT_NATIVE);
+  lv_obj_delete(scratch);
+  return snapshot;
+}
+
+static int get_face_count() { return ClockFaceCount; }
+
+static int get_current_face() { return current_face; }
+
+static void settle_face(int face) {
+  if (face == current_face) {
+    return;
+  }
+  current_face = face;
+  save_mode();
+  ESP_LOGI("Clock", "Swiped to face: %s", clock_faces[current_face].name);
+  redraw_clock();
+}
+
+// Snapshots are reused within the same minute; the live face replaces them
+// as soon as the carousel settles
+static uint32_t get_snapshot_stamp() {
+  time_t now;
+  ::time(&now);
+  return (uint32_t)(now / 60);
+}
+
+static const FaceCarouselOps carousel_ops = {
+  .get_face_count = get_face_count,
+  .get_current_face = get_current_face,
+  .is_enabled = is_time_synced,
+  .render_face = render_face_offscreen,
+  .settle = settle_face,
+  .get_stamp = get_snapshot_stamp,
+};
+
 // C callback functions
 extern "C" void onShow(void *app, void *data, lv_obj_t *parent) {
   app_handle = app;
@@ -486,7 +764,37 @@ extern "C" void onShow(void *app, void *data, lv_obj_t *parent) {
   lv_obj_center(toggle_label);
 
   lv_obj_align(toggle_btn, LV_ALIGN_RIGHT_MID, -8, 0);
-  lv_obj_add_event_cb(toggle_btn, toggle_mode_cb, LV_EVENT_CLICKED, app_handle);
+  lv_obj_add_event_cb(toggle_btn, cycle_face_cb, LV_EVENT_CLICKED, app_handle);
+
+  // Weather goes left of the toggle button, filled in from the cache
+  weather_label = lv_label_create(toolbar);
+  lv_label_set_text(weather_label, "");
+  weather_version = 0;
+
+  // Face images are decoded from the assets when a face first needs them
+  char assets[128];
+  size_t assets_size = sizeof(assets);
+  tt_app_get_assets_path(app_handle, assets, &assets_size);
+  char faces_directory[sizeof(assets) + 8];
+  snprintf(faces_directory, sizeof(faces_directory), "%s/faces", assets);
+  face_assets_set_directory(faces_directory);
+
+  // Correction history; sync_log_export = true writes a CSV copy once
+  char data_dir[128];
+  size_t data_dir_size = sizeof(data_dir);
+  tt_app_get_user_data_path(app_handle, data_dir, &data_dir_size);
+  char log_path[sizeof(data_dir) + 16];
+  snprintf(log_path, sizeof(log_path), "%s/sync_log.bin", data_dir);
+  sync_log_open(log_path);
+  PreferencesHandle prefs = tt_preferences_alloc("clock_settings");
+  bool export_log = false;
+  if (tt_preferences_opt_bool(prefs, "sync_log_export", &export_log) &&
+      export_log) {
+    snprintf(log_path, sizeof(log_path), "%s/sync_log.csv", data_dir);
+    sync_log_export_csv(log_path);
+    tt_preferences_put_bool(prefs, "sync_log_export", false);
+  }
+  tt_preferences_free(prefs);
 
   // Load settings
   load_mode();
@@ -497,8 +805,9 @@ extern "C" void onShow(void *app, void *data, lv_obj_t *parent) {
   lvgl_mutex = tt_lock_alloc_mutex(MutexTypeRecursive);
   
   // Get UI scale and calculate layout
-  UiScale uiScale = tt_hal_configuration_get_ui_scale();
-  int toolbar_height = getToolbarHeight(uiScale);
+  ui_scale = tt_hal_configuration_get_ui_scale();
+  face_settings.ui_scale = ui_scale;
+  int toolbar_height = getToolbarHeight(ui_scale);
   
   // Create clock container
   clock_container = lv_obj_create(parent);
@@ -509,18 +818,41 @@ extern "C" void onShow(void *app, void *data, lv_obj_t *parent) {
   
   lv_obj_set_size(clock_container, parent_width, container_height);
   lv_obj_align_to(clock_container, toolbar, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 0);
-  lv_obj_set_style_border_width(clock_container, 0, 0);
-  lv_obj_set_style_pad_all(clock_container, 10, 0);
-  lv_obj_clear_flag(clock_container, LV_OBJ_FLAG_SCROLLABLE);
-  
-  lv_obj_set_layout(clock_container, LV_LAYOUT_FLEX);
-  lv_obj_set_flex_flow(clock_container, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_flex_align(clock_container, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+  style_clock_container(clock_container);
+  lv_obj_update_layout(clock_container);
+
+  // UI updates run on the shared LVGL tick, ahead of the clock widgets
+  clock_tick_subscribe(clock_tick_cb, nullptr);
+  weather_service_start(weather_config);
+  calendar_service_start(calendar_config);
+  metrics_start(metrics_config);
+  clock_frames_start(face_settings.locale);
+  // Render cost feeds the metrics and the power budget
+  lv_display_t *display = lv_obj_get_display(parent);
+  lv_display_add_event_cb(display, render_start_cb, LV_EVENT_RENDER_START,
+                          nullptr);
+  lv_display_add_event_cb(display, render_ready_cb, LV_EVENT_RENDER_READY,
+                          nullptr);
+  lv_display_add_event_cb(display, flush_start_cb, LV_EVENT_FLUSH_START,
+                          nullptr);
+  screen_sleep_start(display, screen_off_ms, screen_sleep_cb);
+  display_antialiasing = lv_display_get_antialiasing(display);
+  clock_tick_set_fixed_time(fixed_time);
+  clock_tick_attach(display, tick_mode);
 
   redraw_clock();
+  face_carousel_attach(clock_container, &carousel_ops);
+  lv_obj_add_event_cb(clock_container, clock_long_pressed_cb,
+                      LV_EVENT_LONG_PRESSED, nullptr);
+
+  // Follow size changes and display rotation without rebuilding the face
+  lv_obj_add_event_cb(clock_container, container_size_changed_cb,
+                      LV_EVENT_SIZE_CHANGED, nullptr);
+  lv_obj_add_event_cb(parent, parent_size_changed_cb, LV_EVENT_SIZE_CHANGED,
+                      nullptr);
+  lv_display_add_event_cb(lv_obj_get_display(parent), resolution_changed_cb,
+                          LV_EVENT_RESOLUTION_CHANGED, nullptr);
 
-  // Start LVGL timer for UI updates (runs in LVGL context)
-  update_timer = lv_timer_create(update_timer_cb, 1000, nullptr);
   
   // Start FreeRTOS timer for sync checking (lightweight, runs every 5 seconds)
   sync_check_timer = (TimerHandle_t)tt_timer_alloc(TimerTypePeriodic, sync_check_callback, nullptr);
@@ -530,11 +862,44 @@ extern "C" void onShow(void *app, void *data, lv_obj_t *parent) {
 }
 
 extern "C" void onHide(void *app, void *data) {
-  // Stop timers first
-  if (update_timer) {
-    lv_timer_delete(update_timer);
-    update_timer = nullptr;
+  // Drop any in-flight transition and its snapshot buffers
+  face_transition_finish();
+  face_carousel_detach();
+
+  if (clock_container && lv_obj_is_valid(clock_container)) {
+    lv_obj_t *parent = lv_obj_get_parent(clock_container);
+    lv_obj_remove_event_cb(parent, parent_size_changed_cb);
+    lv_display_remove_event_cb_with_user_data(lv_obj_get_display(parent),
+                                              resolution_changed_cb, nullptr);
+    lv_display_remove_event_cb_with_user_data(lv_obj_get_display(parent),
+                                              render_start_cb, nullptr);
+    lv_display_remove_event_cb_with_user_data(lv_obj_get_display(parent),
+                                              render_ready_cb, nullptr);
+    lv_display_remove_event_cb_with_user_data(lv_obj_get_display(parent),
+                                              flush_start_cb, nullptr);
   }
+
+  // Leave the display and tick as they were before the governor
+  if (clock_container && lv_obj_is_valid(clock_container)) {
+    lv_display_set_antialiasing(lv_obj_get_display(clock_container),
+                                display_antialiasing);
+  }
+  clock_tick_set_interval(1);
+  clock_tick_set_fixed_time(0);
+  face_settings.hide_seconds = false;
+  quality_governor_reset();
+
+  // Stop timers first
+  screen_sleep_stop();
+  clock_tick_detach();
+  clock_tick_unsubscribe(clock_tick_cb, nullptr);
+  weather_service_stop();
+  calendar_service_stop();
+  metrics_stop();
+  clock_frames_stop();
+  face_assets_clear();
+  power_budget_set_face(-1);
+  power_budget_report();
   
   if (sync_check_timer) {
     tt_timer_stop(sync_check_timer);
@@ -550,14 +915,14 @@ extern "C" void onHide(void *app, void *data) {
   }
 
   // Clear object pointers
-  time_label = nullptr;
-  clock_face = hour_hand = minute_hand = second_hand = nullptr;
+  live_clock = nullptr;
   wifi_label = nullptr;
   wifi_button = nullptr;
   toggle_btn = nullptr;
+  weather_label = nullptr;
+  event_label = nullptr;
   clock_container = nullptr;
   toolbar = nullptr;
-  date_label = nullptr;
 }
 
 AppRegistration manifest = {
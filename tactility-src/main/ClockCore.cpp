@@ -0,0 +1,83 @@
+#include "ClockCore.h"
+
+#include <cmath>
+
+constexpr float DEGREES_TO_RADIANS = 3.14159265f / 180;
+
+static int32_t min_size(float a, float b) { return (int32_t)(a < b ? a : b); }
+
+void clock_core_hands(ClockHands *hands, const struct tm &timeinfo) {
+  hands->angle[ClockHandHour] = (float)(timeinfo.tm_hour % 12) * 30.0f +
+                                (float)timeinfo.tm_min * 0.5f - 90;
+  hands->angle[ClockHandMinute] = (float)timeinfo.tm_min * 6.0f - 90;
+  hands->angle[ClockHandSecond] = (float)timeinfo.tm_sec * 6.0f - 90;
+  for (int hand = 0; hand < 3; hand++) {
+    float radians = hands->angle[hand] * DEGREES_TO_RADIANS;
+    hands->cosine[hand] = cosf(radians);
+    hands->sine[hand] = sinf(radians);
+  }
+}
+
+ClockPoint clock_core_hand_end(const ClockHands &hands, ClockHand hand,
+                               int32_t center_x, int32_t center_y,
+                               int32_t length) {
+  return {center_x + (int32_t)((float)length * hands.cosine[hand]),
+          center_y + (int32_t)((float)length * hands.sine[hand])};
+}
+
+void clock_core_texts(ClockTexts *texts, const struct tm &timeinfo,
+                      const LocaleInfo *locale) {
+  locale_format(texts->time_24, sizeof(texts->time_24), "%H:%M:%S", locale,
+                timeinfo);
+  locale_format(texts->time_12, sizeof(texts->time_12), "%I:%M:%S %p", locale,
+                timeinfo);
+  locale_format_pattern(texts->date_long, sizeof(texts->date_long), locale,
+                        LocaleDateLong, timeinfo);
+  locale_format_pattern(texts->date_short, sizeof(texts->date_short), locale,
+                        LocaleDateShort, timeinfo);
+  locale_format_pattern(texts->day_month, sizeof(texts->day_month), locale,
+                        LocaleDayMonth, timeinfo);
+}
+
+void clock_core_sizes(ClockSizes *sizes, int32_t width, int32_t height) {
+  bool is_small = (width < 240 || height < 180);
+  sizes->is_small = is_small;
+
+  // Analog: fit the dial, but never below a legible minimum
+  int32_t max_size = min_size((float)width * 0.85f, (float)height * 0.75f);
+  int32_t minimum = is_small ? 120 : 200;
+  int32_t clock_size = max_size > minimum ? max_size : minimum;
+  sizes->clock_size = clock_size;
+  sizes->hour_length = (int32_t)((float)clock_size * 0.25f);
+  sizes->minute_length = (int32_t)((float)clock_size * 0.35f);
+  sizes->second_length = (int32_t)((float)clock_size * 0.4f);
+
+  auto center = (float)(clock_size / 2);
+  for (int i = 0; i < CLOCK_MARKER_COUNT; i++) {
+    float angle = ((float)i * 30.0f - 90) * DEGREES_TO_RADIANS;
+    int32_t marker_length = (i % 3 == 0) ? (clock_size / 8) : (clock_size / 14);
+    int32_t r_outer = clock_size / 2 - 4;
+    int32_t r_inner = r_outer - marker_length;
+    sizes->marker_points[i][0][0] = center + (float)r_inner * cosf(angle);
+    sizes->marker_points[i][0][1] = center + (float)r_inner * sinf(angle);
+    sizes->marker_points[i][1][0] = center + (float)r_outer * cosf(angle);
+    sizes->marker_points[i][1][1] = center + (float)r_outer * sinf(angle);
+  }
+
+  // Night-stand: four 5:9 digits, three gaps and a colon across 92% of the
+  // width, limited by 70% of the height
+  sizes->segment_digit_width =
+      min_size((float)width * 0.92f / 5.25f, (float)height * 0.7f / 1.8f);
+
+  // BCD: six columns of four cells with a wider gap between HH, MM and SS
+  sizes->bcd_cell_size =
+      min_size((float)width * 0.9f / 8.6f, (float)height * 0.7f / 4.6f);
+
+  // Word clock: 11 x 10 letters
+  sizes->word_cell_width = (int32_t)((float)width * 0.92f / 11.0f);
+  sizes->word_cell_height = min_size((float)height * 0.85f / 10.0f,
+                                     (float)sizes->word_cell_width * 1.2f);
+
+  sizes->dash_width = (int32_t)((float)width * 0.95f);
+  sizes->dash_height = (int32_t)((float)height * 0.85f);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Locale.h"
+
+#include <cstdint>
+#include <time.h>
+
+// Time math, text formatting and geometry behind the faces, with no LVGL or
+// ESP-IDF dependency, so the hot paths can be built and timed on a host.
+// Everything here is pure: results depend on the arguments only.
+
+constexpr int CLOCK_MARKER_COUNT = 12;
+
+enum ClockHand { ClockHandHour = 0, ClockHandMinute, ClockHandSecond };
+
+struct ClockHands {
+  float angle[3]; // Degrees clockwise from 3 o'clock, as lv_line draws
+  float cosine[3];
+  float sine[3];
+};
+
+struct ClockTexts {
+  char time_24[16];
+  char time_12[20];
+  char date_long[48];
+  char date_short[24];
+  char day_month[16];
+};
+
+struct ClockPoint {
+  int32_t x;
+  int32_t y;
+};
+
+// The parts of a layout that scale with the container; fixed per-size
+// values (radii, paddings) stay with the layout itself
+struct ClockSizes {
+  bool is_small;
+  int32_t clock_size;
+  int32_t hour_length;
+  int32_t minute_length;
+  int32_t second_length;
+  float marker_points[CLOCK_MARKER_COUNT][2][2]; // Inner and outer x, y
+  int32_t segment_digit_width;
+  int32_t bcd_cell_size;
+  int32_t word_cell_width;
+  int32_t word_cell_height;
+  int32_t dash_width;
+  int32_t dash_height;
+};
+
+void clock_core_hands(ClockHands *hands, const struct tm &timeinfo);
+
+// Tip of `hand` for a hand `length` pixels long, truncated toward the center
+ClockPoint clock_core_hand_end(const ClockHands &hands, ClockHand hand,
+                               int32_t center_x, int32_t center_y,
+                               int32_t length);
+
+void clock_core_texts(ClockTexts *texts, const struct tm &timeinfo,
+                      const LocaleInfo *locale);
+
+void clock_core_sizes(ClockSizes *sizes, int32_t width, int32_t height);
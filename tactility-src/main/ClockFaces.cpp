@@ -0,0 +1,556 @@
+#include "ClockFaces.h"
+#include "ClockFrame.h"
+#include "ClockTick.h"
+#include "FaceAssets.h"
+
+#include <tt_time.h>
+
+#include <cmath>
+#include <cstdio>
+
+static void create_digital_clock(lv_obj_t *container, FaceView *view);
+static void create_analog_clock(lv_obj_t *container, FaceView *view);
+static void create_tapered_clock(lv_obj_t *container, FaceView *view);
+static void create_night_clock(lv_obj_t *container, FaceView *view);
+static void create_binary_clock(lv_obj_t *container, FaceView *view);
+static void create_word_clock(lv_obj_t *container, FaceView *view);
+static void create_dashboard_clock(lv_obj_t *container, FaceView *view);
+static void apply_digital_layout(FaceView *view, const ClockLayout *layout);
+static void apply_analog_layout(FaceView *view, const ClockLayout *layout);
+static void apply_tapered_layout(FaceView *view, const ClockLayout *layout);
+static void apply_night_layout(FaceView *view, const ClockLayout *layout);
+static void apply_binary_layout(FaceView *view, const ClockLayout *layout);
+static void apply_word_layout(FaceView *view, const ClockLayout *layout);
+static void apply_dashboard_layout(FaceView *view, const ClockLayout *layout);
+
+static size_t tapered_arena_size(const ClockLayout *layout) {
+  return raster_hands_arena_size(layout);
+}
+
+const FaceInfo clock_faces[ClockFaceCount] = {
+  {"digital", create_digital_clock, apply_digital_layout, nullptr},
+  {"analog", create_analog_clock, apply_analog_layout, nullptr},
+  {"analog_tapered", create_tapered_clock, apply_tapered_layout,
+   tapered_arena_size},
+  {"night", create_night_clock, apply_night_layout, nullptr},
+  {"binary", create_binary_clock, apply_binary_layout, nullptr},
+  {"words", create_word_clock, apply_word_layout, nullptr},
+  {"dashboard", create_dashboard_clock, apply_dashboard_layout, nullptr},
+};
+
+void get_local_time(struct tm *timeinfo) {
+  time_t now = clock_tick_time();
+  localtime_r(&now, timeinfo);
+}
+
+bool clock_face_is_24_hour(const ClockFaceSettings &settings) {
+  return settings.locale_hours ? settings.locale->is_24_hour
+                               : tt_timezone_is_format_24_hour();
+}
+
+// Labels show text buffers from the face arena, so per-second updates do not
+// reallocate label strings on the heap
+static void set_label_time_text(lv_obj_t *label, char *buffer,
+                                const char *format, const LocaleInfo *locale,
+                                const struct tm &timeinfo) {
+  if (buffer) {
+    locale_format(buffer, FACE_TEXT_SIZE, format, locale, timeinfo);
+    lv_label_set_text_static(label, buffer);
+  } else {
+    char text[FACE_TEXT_SIZE];
+    locale_format(text, sizeof(text), format, locale, timeinfo);
+    lv_label_set_text(label, text);
+  }
+}
+
+static char *allocate_text(FaceView *view) {
+  auto *text =
+      static_cast<char *>(face_arena_alloc(&view->arena, FACE_TEXT_SIZE, 1));
+  if (text) {
+    text[0] = '\0';
+  }
+  return text;
+}
+
+// Puts already formatted text in the label the same way
+static void set_label_frame_text(lv_obj_t *label, char *buffer,
+                                 const char *text) {
+  if (buffer) {
+    snprintf(buffer, FACE_TEXT_SIZE, "%s", text);
+    lv_label_set_text_static(label, buffer);
+  } else {
+    lv_label_set_text(label, text);
+  }
+}
+
+static void set_hand_end(lv_point_precise_t *points, const ClockHands &hands,
+                         ClockHand hand, const ClockLayout *layout,
+                         lv_coord_t length) {
+  ClockPoint end = clock_core_hand_end(hands, hand, layout->center_x,
+                                       layout->center_y, length);
+  points[1].x = (lv_value_precise_t)end.x;
+  points[1].y = (lv_value_precise_t)end.y;
+}
+
+void clock_face_update(FaceView *view, const struct tm &timeinfo) {
+  const LocaleInfo *locale = view->settings.locale;
+  bool is_24_hour = clock_face_is_24_hour(view->settings);
+  // Precomputed on the other core when the tick found one for this second
+  const ClockFrame *frame = clock_frame_matching(timeinfo);
+  if (frame && frame->locale != locale) {
+    frame = nullptr;
+  }
+
+  if (view->clock_face && lv_obj_is_valid(view->clock_face)) {
+    const ClockLayout *layout = view->layout;
+
+    ClockHands computed;
+    const ClockHands *hands = frame ? &frame->hands : &computed;
+    if (!frame) {
+      clock_core_hands(&computed, timeinfo);
+    }
+
+    if (view->raster_hands.hands.image) {
+      raster_hands_update(&view->raster_hands, layout, timeinfo, *hands);
+    }
+    if (view->hour_image) {
+      // Image hands point to 12 o'clock unrotated
+      lv_image_set_rotation(
+          view->hour_image,
+          (int32_t)((hands->angle[ClockHandHour] + 90) * 10));
+      lv_image_set_rotation(
+          view->minute_image,
+          (int32_t)((hands->angle[ClockHandMinute] + 90) * 10));
+    }
+    if (view->hour_hand && lv_obj_is_valid(view->hour_hand)) {
+      set_hand_end(view->hour_points, *hands, ClockHandHour, layout,
+                   layout->hour_length);
+      lv_line_set_points(view->hour_hand, view->hour_points, 2);
+    }
+    if (view->minute_hand && lv_obj_is_valid(view->minute_hand)) {
+      set_hand_end(view->minute_points, *hands, ClockHandMinute, layout,
+                   layout->minute_length);
+      lv_line_set_points(view->minute_hand, view->minute_points, 2);
+    }
+    if (view->second_hand && lv_obj_is_valid(view->second_hand)) {
+      set_hand_end(view->second_points, *hands, ClockHandSecond, layout,
+                   layout->second_length);
+      lv_line_set_points(view->second_hand, view->second_points, 2);
+    }
+    int date_key = timeinfo.tm_yday + 1;
+    if (view->date_label && date_key != view->date_key) {
+      view->date_key = date_key;
+      if (frame) {
+        set_label_frame_text(view->date_label, view->date_text,
+                             frame->texts.day_month);
+      } else {
+        set_label_time_text(view->date_label, view->date_text,
+                            locale_string(locale, LocaleDayMonth), locale,
+                            timeinfo);
+      }
+    }
+  } else if (view->segments.panel && lv_obj_is_valid(view->segments.panel)) {
+    // Only does work when the minute changes
+    if (is_24_hour) {
+      segment_display_set_time(&view->segments, timeinfo.tm_hour,
+                               timeinfo.tm_min, false);
+    } else {
+      int hour = timeinfo.tm_hour % 12;
+      segment_display_set_time(&view->segments, hour == 0 ? 12 : hour,
+                               timeinfo.tm_min, true);
+    }
+  } else if (view->bcd.panel && lv_obj_is_valid(view->bcd.panel)) {
+    int hour = timeinfo.tm_hour;
+    if (!is_24_hour) {
+      hour = hour % 12 == 0 ? 12 : hour % 12;
+    }
+    bcd_display_set_time(&view->bcd, hour, timeinfo.tm_min, timeinfo.tm_sec);
+  } else if (view->words.grid && lv_obj_is_valid(view->words.grid)) {
+    word_clock_set_time(&view->words, timeinfo.tm_hour, timeinfo.tm_min);
+  } else if (view->dashboard.surface &&
+             lv_obj_is_valid(view->dashboard.surface)) {
+    dashboard_update(&view->dashboard, timeinfo, is_24_hour, locale);
+  } else if (view->time_label && lv_obj_is_valid(view->time_label)) {
+    if (view->settings.hide_seconds) {
+      set_label_time_text(view->time_label, view->time_text,
+                          is_24_hour ? "%H:%M" : "%I:%M %p", locale, timeinfo);
+    } else if (frame) {
+      set_label_frame_text(view->time_label, view->time_text,
+                           is_24_hour ? frame->texts.time_24
+                                      : frame->texts.time_12);
+    } else {
+      set_label_time_text(view->time_label, view->time_text,
+                          is_24_hour ? "%H:%M:%S" : "%I:%M:%S %p", locale,
+                          timeinfo);
+    }
+
+    // The date only changes at midnight or when the layout switches format
+    int date_key = (timeinfo.tm_yday + 1) * 2 + (view->layout->is_small ? 1 : 0);
+    if (view->date_label && date_key != view->date_key) {
+      view->date_key = date_key;
+      if (frame) {
+        set_label_frame_text(view->date_label, view->date_text,
+                             view->layout->is_small
+                                 ? frame->texts.date_short
+                                 : frame->texts.date_long);
+      } else {
+        set_label_time_text(view->date_label, view->date_text,
+                            locale_string(locale, view->layout->is_small
+                                                      ? LocaleDateShort
+                                                      : LocaleDateLong),
+                            locale, timeinfo);
+      }
+    }
+  }
+}
+
+const ClockLayout *face_view_adopt_layout(FaceView *view,
+                                         const ClockLayout *layout) {
+  view->own_layout = *layout;
+  return &view->own_layout;
+}
+
+static const ClockLayout *get_layout(lv_obj_t *container, FaceView *view) {
+  return face_view_adopt_layout(
+      view, clock_layout_get(lv_obj_get_width(container),
+                             lv_obj_get_height(container),
+                             view->settings.ui_scale));
+}
+
+// Scale for images drawn for another dial size
+static uint32_t asset_scale(const FaceView *view, const ClockLayout *layout) {
+  if (view->asset_design_size == 0) {
+    return LV_SCALE_NONE;
+  }
+  return (uint32_t)(LV_SCALE_NONE * layout->clock_size /
+                    view->asset_design_size);
+}
+
+// Size and position the dial widgets; no widgets are created or deleted
+static void apply_dial_layout(FaceView *view, const ClockLayout *layout) {
+  view->layout = layout;
+
+  lv_obj_set_size(view->clock_face, layout->clock_size, layout->clock_size);
+  lv_obj_center(view->clock_face);
+  lv_obj_set_style_border_width(view->clock_face, layout->border_width, 0);
+
+  for (int i = 0; i < CLOCK_MARKER_COUNT; i++) {
+    lv_line_set_points(view->markers[i], layout->marker_points[i], 2);
+    lv_obj_set_style_line_width(view->markers[i], layout->marker_widths[i], 0);
+  }
+
+  lv_obj_set_size(view->center_dot, layout->center_dot_size,
+                  layout->center_dot_size);
+  lv_obj_center(view->center_dot);
+
+  if (view->dial_image) {
+    lv_image_set_scale(view->dial_image, asset_scale(view, layout));
+    lv_obj_center(view->dial_image);
+  }
+}
+
+// Hands rotate around the point half their width above their bottom edge
+static void apply_image_hand_layout(lv_obj_t *hand, uint32_t scale,
+                                    const ClockLayout *layout) {
+  auto *source = static_cast<const lv_image_dsc_t *>(lv_image_get_src(hand));
+  int32_t pivot_x = (int32_t)source->header.w / 2;
+  int32_t pivot_y = (int32_t)source->header.h - pivot_x;
+  lv_image_set_pivot(hand, pivot_x, pivot_y);
+  lv_image_set_scale(hand, scale);
+  lv_obj_set_pos(hand, layout->center_x - pivot_x, layout->center_y - pivot_y);
+}
+
+static void apply_line_hands_layout(FaceView *view, const ClockLayout *layout) {
+  // Hands start at the center; clock_face_update() sets their tips
+  lv_point_precise_t center = {(float)layout->center_x, (float)layout->center_y};
+  view->hour_points[0] = view->hour_points[1] = center;
+  view->minute_points[0] = view->minute_points[1] = center;
+  view->second_points[0] = view->second_points[1] = center;
+  if (view->hour_image) {
+    uint32_t scale = asset_scale(view, layout);
+    apply_image_hand_layout(view->hour_image, scale, layout);
+    apply_image_hand_layout(view->minute_image, scale, layout);
+  } else {
+    lv_obj_set_style_line_width(view->hour_hand, layout->hour_width, 0);
+    lv_obj_set_style_line_width(view->minute_hand, layout->minute_width, 0);
+  }
+}
+
+static void apply_analog_layout(FaceView *view, const ClockLayout *layout) {
+  apply_dial_layout(view, layout);
+  apply_line_hands_layout(view, layout);
+}
+
+static void apply_tapered_layout(FaceView *view, const ClockLayout *layout) {
+  apply_dial_layout(view, layout);
+  if (view->hour_hand) {
+    // Hand layers could not be allocated, line hands are in use
+    apply_line_hands_layout(view, layout);
+  } else {
+    raster_hands_resize(&view->raster_hands, layout);
+  }
+}
+
+static void release_asset_cb(lv_event_t *e) {
+  face_asset_release(static_cast<lv_draw_buf_t *>(lv_event_get_user_data(e)));
+}
+
+// Image on the dial from the face assets, or nullptr when there is none.
+// Decoded lazily on first use and shared through the asset cache.
+static lv_obj_t *create_asset_image(FaceView *view, const char *name,
+                                    const ClockLayout *layout) {
+  FaceAsset asset = face_asset_acquire(name, layout->clock_size);
+  if (!asset.buffer) {
+    return nullptr;
+  }
+  lv_obj_t *image = lv_image_create(view->clock_face);
+  lv_image_set_src(image, asset.buffer);
+  lv_obj_clear_flag(image, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_event_cb(image, release_asset_cb, LV_EVENT_DELETE, asset.buffer);
+  view->asset_design_size = asset.design_size;
+  return image;
+}
+
+// Dial background and hour markers
+static void create_analog_dial(lv_obj_t *container, FaceView *view) {
+  // Create clock face background
+  lv_obj_t *clock_face = lv_obj_create(container);
+  view->clock_face = clock_face;
+  lv_obj_set_style_radius(clock_face, LV_RADIUS_CIRCLE, 0);
+  lv_obj_set_style_bg_color(clock_face, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_bg_opa(clock_face, LV_OPA_10, 0);
+  lv_obj_set_style_border_color(clock_face, lv_palette_main(LV_PALETTE_GREY), 0);
+  lv_obj_set_style_border_opa(clock_face, LV_OPA_50, 0);
+  lv_obj_set_style_pad_all(clock_face, 0, 0);
+  lv_obj_clear_flag(clock_face, LV_OBJ_FLAG_SCROLLABLE);
+  // Let presses reach the container so the carousel can be swiped
+  lv_obj_clear_flag(clock_face, LV_OBJ_FLAG_CLICKABLE);
+
+  // Add hour markers
+  for (int i = 0; i < CLOCK_MARKER_COUNT; i++) {
+    lv_obj_t *marker = lv_line_create(clock_face);
+    view->markers[i] = marker;
+    lv_obj_set_style_line_color(marker, lv_color_hex(0x999999), 0);
+    lv_obj_set_style_line_rounded(marker, true, 0);
+  }
+
+  // A dial image from the assets replaces the markers
+  view->dial_image = create_asset_image(view, "dial",
+                                        get_layout(container, view));
+  if (view->dial_image) {
+    lv_obj_move_background(view->dial_image);
+    for (lv_obj_t *marker : view->markers) {
+      lv_obj_add_flag(marker, LV_OBJ_FLAG_HIDDEN);
+    }
+  }
+}
+
+// Hour and minute hands from the assets; both or neither
+static void create_image_hands(FaceView *view, const ClockLayout *layout) {
+  view->hour_image = create_asset_image(view, "hour_hand", layout);
+  view->minute_image = create_asset_image(view, "minute_hand", layout);
+  if (!view->hour_image || !view->minute_image) {
+    if (view->hour_image) {
+      lv_obj_delete(view->hour_image);
+    }
+    if (view->minute_image) {
+      lv_obj_delete(view->minute_image);
+    }
+    view->hour_image = nullptr;
+    view->minute_image = nullptr;
+  }
+}
+
+static void create_second_hand(FaceView *view);
+
+static void create_line_hands(FaceView *view) {
+  if (view->hour_image) {
+    // Only the second hand is drawn as a line
+    create_second_hand(view);
+    return;
+  }
+  lv_obj_t *hour_hand = lv_line_create(view->clock_face);
+  view->hour_hand = hour_hand;
+  lv_line_set_points(hour_hand, view->hour_points, 2);
+  lv_obj_set_style_line_color(hour_hand, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_line_opa(hour_hand, LV_OPA_COVER, 0);
+  lv_obj_set_style_line_rounded(hour_hand, true, 0);
+
+  lv_obj_t *minute_hand = lv_line_create(view->clock_face);
+  view->minute_hand = minute_hand;
+  lv_line_set_points(minute_hand, view->minute_points, 2);
+  lv_obj_set_style_line_color(minute_hand, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_line_opa(minute_hand, LV_OPA_COVER, 0);
+  lv_obj_set_style_line_rounded(minute_hand, true, 0);
+
+  create_second_hand(view);
+}
+
+static void create_second_hand(FaceView *view) {
+  if (view->settings.hide_seconds) {
+    return;
+  }
+  lv_obj_t *second_hand = lv_line_create(view->clock_face);
+  view->second_hand = second_hand;
+  lv_line_set_points(second_hand, view->second_points, 2);
+  lv_obj_set_style_line_width(second_hand, 2, 0);
+  lv_obj_set_style_line_color(second_hand, lv_color_hex(0xFF0000), 0);
+  lv_obj_set_style_line_opa(second_hand, LV_OPA_COVER, 0);
+  lv_obj_set_style_line_rounded(second_hand, true, 0);
+}
+
+// Center dot and date, drawn above the hands
+static void create_analog_center(FaceView *view) {
+  lv_obj_t *center = lv_obj_create(view->clock_face);
+  view->center_dot = center;
+  lv_obj_set_style_radius(center, LV_RADIUS_CIRCLE, 0);
+  lv_obj_set_style_bg_color(center, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_border_width(center, 0, 0);
+  lv_obj_clear_flag(center, LV_OBJ_FLAG_CLICKABLE);
+
+  // Date label
+  lv_obj_t *date_label = lv_label_create(view->clock_face);
+  view->date_label = date_label;
+  view->date_text = allocate_text(view);
+  lv_obj_align(date_label, LV_ALIGN_BOTTOM_MID, 0, -15);
+  lv_obj_set_style_text_font(date_label, lv_font_get_default(), 0);
+  lv_obj_set_style_text_color(date_label, lv_color_hex(0xAAAAAA), 0);
+}
+
+static void create_analog_clock(lv_obj_t *container, FaceView *view) {
+  const ClockLayout *layout = get_layout(container, view);
+  create_analog_dial(container, view);
+  create_image_hands(view, layout);
+  create_line_hands(view);
+  create_analog_center(view);
+  apply_analog_layout(view, layout);
+
+  // Now update hands to actual time
+  struct tm timeinfo;
+  get_local_time(&timeinfo);
+  clock_face_update(view, timeinfo);
+}
+
+// Analog dial with tapered polygon hands from the scanline rasterizer
+static void create_tapered_clock(lv_obj_t *container, FaceView *view) {
+  const ClockLayout *layout = get_layout(container, view);
+  create_analog_dial(container, view);
+  if (!raster_hands_create(&view->raster_hands, view->clock_face, layout,
+                           &view->arena)) {
+    create_line_hands(view);
+  } else if (view->settings.hide_seconds) {
+    lv_obj_add_flag(view->raster_hands.seconds.image, LV_OBJ_FLAG_HIDDEN);
+  }
+  create_analog_center(view);
+  apply_tapered_layout(view, layout);
+
+  struct tm timeinfo;
+  get_local_time(&timeinfo);
+  clock_face_update(view, timeinfo);
+}
+
+static void apply_digital_layout(FaceView *view, const ClockLayout *layout) {
+  view->layout = layout;
+
+  lv_obj_align(view->time_label, LV_ALIGN_CENTER, 0, layout->time_offset_y);
+  lv_obj_set_style_radius(view->time_label, layout->time_radius, 0);
+  lv_obj_set_style_pad_all(view->time_label, layout->time_padding, 0);
+
+  lv_obj_align_to(view->date_label, view->time_label, LV_ALIGN_OUT_BOTTOM_MID,
+                  0, layout->date_gap);
+  lv_obj_set_style_pad_all(view->date_label, layout->date_padding, 0);
+}
+
+static void create_digital_clock(lv_obj_t *container, FaceView *view) {
+  // Create main time display
+  lv_obj_t *time_label = lv_label_create(container);
+  view->time_label = time_label;
+  view->time_text = allocate_text(view);
+  lv_obj_set_style_text_align(time_label, LV_TEXT_ALIGN_CENTER, 0);
+
+  const lv_font_t *time_font = lv_font_get_default();
+  lv_obj_set_style_text_font(time_label, time_font, 0);
+
+  lv_obj_set_style_text_color(time_label, lv_color_hex(0xFFFFFF), 0);
+  lv_obj_set_style_bg_color(time_label, lv_color_hex(0x000000), 0);
+  lv_obj_set_style_bg_opa(time_label, LV_OPA_30, 0);
+  lv_obj_set_style_border_width(time_label, 2, 0);
+  lv_obj_set_style_border_color(time_label, lv_color_hex(0x444444), 0);
+  lv_obj_set_style_border_opa(time_label, LV_OPA_50, 0);
+
+  // Create date display
+  lv_obj_t *date_label = lv_label_create(container);
+  view->date_label = date_label;
+  view->date_text = allocate_text(view);
+  lv_obj_set_style_text_align(date_label, LV_TEXT_ALIGN_CENTER, 0);
+  lv_obj_set_style_text_font(date_label, lv_font_get_default(), 0);
+  lv_obj_set_style_text_color(date_label, lv_color_hex(0xaaaaaa), 0);
+
+  apply_digital_layout(view, get_layout(container, view));
+
+  struct tm timeinfo;
+  get_local_time(&timeinfo);
+  clock_face_update(view, timeinfo);
+}
+
+static void apply_night_layout(FaceView *view, const ClockLayout *layout) {
+  view->layout = layout;
+  segment_display_apply_layout(&view->segments, layout);
+}
+
+// Bedside face: large dim red segment digits that change once a minute
+static void create_night_clock(lv_obj_t *container, FaceView *view) {
+  segment_display_create(&view->segments, container, lv_color_hex(0x6A0000));
+  apply_night_layout(view, get_layout(container, view));
+
+  struct tm timeinfo;
+  get_local_time(&timeinfo);
+  clock_face_update(view, timeinfo);
+}
+
+static void apply_binary_layout(FaceView *view, const ClockLayout *layout) {
+  view->layout = layout;
+  bcd_display_apply_layout(&view->bcd, layout);
+}
+
+// Binary coded decimal HH MM SS, HH MM while seconds are hidden
+static void create_binary_clock(lv_obj_t *container, FaceView *view) {
+  bcd_display_create(&view->bcd, container, lv_color_hex(0x00C8FF),
+                     lv_color_hex(0x1A2A30), !view->settings.hide_seconds);
+  apply_binary_layout(view, get_layout(container, view));
+
+  struct tm timeinfo;
+  get_local_time(&timeinfo);
+  clock_face_update(view, timeinfo);
+}
+
+static void apply_word_layout(FaceView *view, const ClockLayout *layout) {
+  view->layout = layout;
+  word_clock_apply_layout(&view->words, layout);
+}
+
+// Time spelled out in words, to the nearest five minutes below
+static void create_word_clock(lv_obj_t *container, FaceView *view) {
+  word_clock_create(&view->words, container);
+  apply_word_layout(view, get_layout(container, view));
+
+  struct tm timeinfo;
+  get_local_time(&timeinfo);
+  clock_face_update(view, timeinfo);
+}
+
+static void apply_dashboard_layout(FaceView *view, const ClockLayout *layout) {
+  view->layout = layout;
+  dashboard_apply_layout(&view->dashboard, layout);
+}
+
+// Several small clocks drawn by one object
+static void create_dashboard_clock(lv_obj_t *container, FaceView *view) {
+  dashboard_create(&view->dashboard, container, view->settings.dashboard_zones,
+                   !view->settings.hide_seconds);
+  apply_dashboard_layout(view, get_layout(container, view));
+
+  struct tm timeinfo;
+  get_local_time(&timeinfo);
+  clock_face_update(view, timeinfo);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "BcdDisplay.h"
+#include "ClockLayout.h"
+#include "Dashboard.h"
+#include "FaceArena.h"
+#include "Locale.h"
+#include "RasterHands.h"
+#include "SegmentDisplay.h"
+#include "WordClock.h"
+
+#include <lvgl.h>
+#include <tt_hal.h>
+
+#include <time.h>
+
+// Available faces, in carousel order
+enum ClockFace {
+  ClockFaceDigital = 0,
+  ClockFaceAnalog,
+  ClockFaceAnalogTapered,
+  ClockFaceNight,
+  ClockFaceBinary,
+  ClockFaceWords,
+  ClockFaceDashboard,
+  ClockFaceCount
+};
+
+// Size of each label text buffer a face takes from its arena
+constexpr size_t FACE_TEXT_SIZE = 64;
+// Arena bytes every face gets: room for a time and a date text
+constexpr size_t FACE_ARENA_BASE_SIZE = 2 * FACE_TEXT_SIZE;
+
+// Options a face is created with
+struct ClockFaceSettings {
+  UiScale ui_scale;
+  DashboardZone dashboard_zones[DASHBOARD_ZONE_COUNT];
+  const LocaleInfo *locale; // Names and date patterns
+  bool locale_hours; // 12/24-hour from the locale instead of the system
+  bool hide_seconds; // Set by the quality governor under load
+};
+
+// Widgets and state of one instantiated face. Each clock widget owns exactly
+// one view (see ClockWidget.h), so any number of faces can exist at once.
+struct FaceView {
+  ClockFaceSettings settings;
+  FaceArena arena; // Face-scoped memory, freed with the view
+  const ClockLayout *layout; // &own_layout once laid out
+  // The view's copy of its cached layout. Widgets keep pointers into it (the
+  // markers use its points in place), and the cache may evict its own copy.
+  ClockLayout own_layout;
+  lv_obj_t *time_label; // Digital
+  lv_obj_t *clock_face; // Analog
+  lv_obj_t *markers[CLOCK_MARKER_COUNT];
+  lv_obj_t *center_dot;
+  lv_obj_t *hour_hand;
+  lv_obj_t *minute_hand;
+  lv_obj_t *second_hand;
+  lv_obj_t *date_label;
+  lv_obj_t *dial_image; // Analog faces with images from the assets
+  lv_obj_t *hour_image;
+  lv_obj_t *minute_image;
+  uint16_t asset_design_size; // Dial size the images were drawn for
+  char *time_text; // Arena-backed label texts; nullptr falls back to the heap
+  char *date_text;
+  lv_point_precise_t hour_points[2];
+  lv_point_precise_t minute_points[2];
+  lv_point_precise_t second_points[2];
+  RasterHands raster_hands; // Tapered analog
+  SegmentDisplay segments; // Night-stand
+  BcdDisplay bcd;
+  WordClock words;
+  Dashboard dashboard;
+  int date_key; // Day and format the date label was last rendered for
+};
+
+struct FaceInfo {
+  const char *name;
+  void (*create)(lv_obj_t *container, FaceView *view);
+  // Re-apply geometry to an existing view after a size change
+  void (*apply_layout)(FaceView *view, const ClockLayout *layout);
+  // Arena bytes needed beyond FACE_ARENA_BASE_SIZE, or nullptr for none
+  size_t (*arena_size)(const ClockLayout *layout);
+};
+
+extern const FaceInfo clock_faces[ClockFaceCount];
+
+void get_local_time(struct tm *timeinfo);
+
+bool clock_face_is_24_hour(const ClockFaceSettings &settings);
+
+// Copies `layout` into the view and returns the view's copy, which faces
+// apply instead of the cached one
+const ClockLayout *face_view_adopt_layout(FaceView *view,
+                                         const ClockLayout *layout);
+
+// Point the widgets of `view` at the given time
+void clock_face_update(FaceView *view, const struct tm &timeinfo);
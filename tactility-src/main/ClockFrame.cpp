@@ -0,0 +1,204 @@
+#include "ClockFrame.h"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <sys/time.h>
+
+#ifdef ESP_PLATFORM
+#include "ServiceTask.h"
+
+#include <esp_log.h>
+
+constexpr auto *TAG = "ClockFrame";
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// How long before a second begins its frame is computed
+constexpr int64_t LEAD_US = 50000;
+
+// Frames for even and odd seconds, so the frame being written is never the
+// one being read in the same second. The sequence is odd while writing.
+struct FrameSlot {
+  std::atomic<uint32_t> sequence;
+  ClockFrame frame;
+};
+
+// Freed by clock_frames_stop() once the task or thread has exited
+struct FrameTask {
+  const LocaleInfo *locale;
+#ifdef ESP_PLATFORM
+  ServiceTask *service;
+#else
+  std::atomic<bool> stop;
+  std::mutex mutex;
+  std::condition_variable wake;
+#endif
+};
+
+static FrameSlot slots[2] = {};
+static FrameTask *active_task = nullptr;
+#ifdef ESP_PLATFORM
+static ServiceTask frame_service = {};
+#else
+static std::thread active_thread;
+#endif
+// LVGL task side
+static ClockFrame current = {};
+static bool has_current = false;
+
+void clock_frame_compute(ClockFrame *frame, time_t second,
+                         const LocaleInfo *locale) {
+  frame->second = second;
+  frame->locale = locale;
+  localtime_r(&second, &frame->timeinfo);
+  clock_core_hands(&frame->hands, frame->timeinfo);
+  clock_core_texts(&frame->texts, frame->timeinfo, locale);
+}
+
+static void publish(time_t second, const LocaleInfo *locale) {
+  FrameSlot &slot = slots[second & 1];
+  uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+  slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  clock_frame_compute(&slot.frame, second, locale);
+  slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Copies the slot's frame; false while it is being written
+static bool read_slot(const FrameSlot &slot, ClockFrame *out) {
+  uint32_t before = slot.sequence.load(std::memory_order_acquire);
+  if (before & 1) {
+    return false;
+  }
+  memcpy(out, &slot.frame, sizeof(*out));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return slot.sequence.load(std::memory_order_relaxed) == before;
+}
+
+// Microseconds until LEAD_US before the next second, and that second
+static int64_t time_to_next(time_t *next) {
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  *next = now.tv_sec + 1;
+  int64_t wait_us = 1000000 - now.tv_usec - LEAD_US;
+  if (wait_us < 0) {
+    // Too close to make this boundary ahead of time
+    (*next)++;
+    wait_us += 1000000;
+  }
+  return wait_us;
+}
+
+// Sleeps until `wait_us` has passed or clock_frames_stop() wakes it. False
+// once the loop should end.
+static bool wait_for_next(FrameTask *task, int64_t wait_us) {
+#ifdef ESP_PLATFORM
+  return service_task_sleep(task->service, (uint32_t)(wait_us / 1000));
+#else
+  std::unique_lock<std::mutex> lock(task->mutex);
+  task->wake.wait_for(lock, std::chrono::microseconds(wait_us),
+                      [task] { return task->stop.load(); });
+  return !task->stop;
+#endif
+}
+
+static void precompute_loop(FrameTask *task) {
+  // The current second too, for the first ticks
+  time_t now = time(nullptr);
+  publish(now, task->locale);
+  for (;;) {
+    time_t next;
+    int64_t wait_us = time_to_next(&next);
+    if (!wait_for_next(task, wait_us)) {
+      break;
+    }
+    publish(next, task->locale);
+  }
+}
+
+#ifdef ESP_PLATFORM
+static void precompute_task(void *param) {
+  auto *task = static_cast<FrameTask *>(param);
+  precompute_loop(task);
+  service_task_exit(task->service);
+}
+#endif
+
+bool clock_frames_start(const LocaleInfo *locale) {
+  clock_frames_stop();
+  auto *task = new (std::nothrow) FrameTask();
+  if (!task) {
+    return false;
+  }
+  task->locale = locale;
+#ifdef ESP_PLATFORM
+#if CONFIG_FREERTOS_UNICORE
+  BaseType_t core = tskNO_AFFINITY;
+#else
+  // Called from the LVGL task: use the other core
+  BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;
+#endif
+  task->service = &frame_service;
+  if (!service_task_start(&frame_service, precompute_task, "clock_frames",
+                          3072, tskIDLE_PRIORITY + 5, core, task)) {
+    ESP_LOGE(TAG, "Failed to start precompute task");
+    delete task;
+    return false;
+  }
+#else
+  task->stop = false;
+  active_thread = std::thread(precompute_loop, task);
+#endif
+  active_task = task;
+  return true;
+}
+
+void clock_frames_stop() {
+  has_current = false;
+  if (!active_task) {
+    return;
+  }
+  // Both wait for the loop to exit, so a restart never runs two and nothing
+  // outlives the app
+#ifdef ESP_PLATFORM
+  service_task_stop(&frame_service);
+#else
+  active_task->stop = true;
+  {
+    std::lock_guard<std::mutex> lock(active_task->mutex);
+  }
+  active_task->wake.notify_one();
+  active_thread.join();
+#endif
+  delete active_task;
+  active_task = nullptr;
+}
+
+const ClockFrame *clock_frame_get(time_t now) {
+  if (!active_task) {
+    return nullptr;
+  }
+  if (has_current && current.second == now) {
+    return &current;
+  }
+  has_current = read_slot(slots[now & 1], &current) && current.second == now;
+  return has_current ? &current : nullptr;
+}
+
+const ClockFrame *clock_frame_matching(const struct tm &timeinfo) {
+  if (!has_current) {
+    return nullptr;
+  }
+  const struct tm &frame_time = current.timeinfo;
+  bool matches = frame_time.tm_sec == timeinfo.tm_sec &&
+                 frame_time.tm_min == timeinfo.tm_min &&
+                 frame_time.tm_hour == timeinfo.tm_hour &&
+                 frame_time.tm_yday == timeinfo.tm_yday &&
+                 frame_time.tm_year == timeinfo.tm_year;
+  return matches ? &current : nullptr;
+}
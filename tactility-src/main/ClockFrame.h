@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ClockCore.h"
+
+// Everything the faces derive from the time for one second: the broken-down
+// time, hand angles and their unit vectors, and the formatted texts in the
+// configured locale. Layout-specific values (hand lengths, which texts show)
+// are applied on the LVGL task.
+struct ClockFrame {
+  time_t second;
+  struct tm timeinfo;
+  const LocaleInfo *locale;
+  ClockHands hands;
+  ClockTexts texts;
+};
+
+void clock_frame_compute(ClockFrame *frame, time_t second,
+                         const LocaleInfo *locale);
+
+// Precomputes each second's frame shortly before the second begins, on the
+// core the LVGL task is not running on, and publishes it through a seqlock.
+// The LVGL tick then only looks the frame up. Host builds run the same loop
+// on a std::thread. Stopping waits for the loop to exit.
+bool clock_frames_start(const LocaleInfo *locale);
+
+void clock_frames_stop();
+
+// LVGL task only: the precomputed frame for `now`, or nullptr when none is
+// ready (not started, or the clock was just stepped)
+const ClockFrame *clock_frame_get(time_t now);
+
+// The frame last returned by clock_frame_get(), if it is for `timeinfo`
+const ClockFrame *clock_frame_matching(const struct tm &timeinfo);
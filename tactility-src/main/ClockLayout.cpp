@@ -0,0 +1,121 @@
+#include "ClockLayout.h"
+
+#include <esp_log.h>
+
+constexpr auto *TAG = "ClockLayout";
+
+// Portrait and landscape plus a couple of spares
+constexpr int LAYOUT_CACHE_SIZE = 4;
+
+struct LayoutSlot {
+  ClockLayout layout;
+  uint32_t last_used;
+  bool valid;
+};
+
+static LayoutSlot slots[LAYOUT_CACHE_SIZE] = {};
+static uint32_t use_counter = 0;
+
+static void compute_layout(ClockLayout *layout, lv_coord_t width,
+                           lv_coord_t height, UiScale ui_scale) {
+  ClockSizes sizes;
+  clock_core_sizes(&sizes, width, height);
+  bool is_small = sizes.is_small;
+
+  layout->width = width;
+  layout->height = height;
+  layout->ui_scale = ui_scale;
+  layout->is_small = is_small;
+
+  // Analog
+  lv_coord_t clock_size = sizes.clock_size;
+  layout->clock_size = clock_size;
+  layout->border_width = is_small ? 2 : 3;
+  layout->center_x = clock_size / 2;
+  layout->center_y = clock_size / 2;
+  layout->hour_length = sizes.hour_length;
+  layout->minute_length = sizes.minute_length;
+  layout->second_length = sizes.second_length;
+  layout->hour_width = is_small ? 4 : 6;
+  layout->minute_width = is_small ? 3 : 4;
+  layout->center_dot_size = is_small ? 8 : 12;
+
+  for (int i = 0; i < CLOCK_MARKER_COUNT; i++) {
+    layout->marker_widths[i] =
+        (i % 3 == 0) ? (is_small ? 3 : 4) : (is_small ? 1 : 2);
+    for (int end = 0; end < 2; end++) {
+      layout->marker_points[i][end].x =
+          (lv_value_precise_t)sizes.marker_points[i][end][0];
+      layout->marker_points[i][end].y =
+          (lv_value_precise_t)sizes.marker_points[i][end][1];
+    }
+  }
+
+  // Digital
+  layout->time_offset_y = is_small ? -25 : -35;
+  layout->time_radius = is_small ? 12 : 16;
+  layout->time_padding = is_small ? 20 : 28;
+  layout->date_gap = is_small ? 12 : 16;
+  layout->date_padding = is_small ? 8 : 10;
+
+  // Night-stand
+  lv_coord_t digit_width = sizes.segment_digit_width;
+  layout->segment_digit_width = digit_width;
+  layout->segment_digit_height = (lv_coord_t)((float)digit_width * 1.8f);
+  layout->segment_thickness = LV_MAX(digit_width / 6, 3);
+  layout->segment_digit_gap = digit_width / 4;
+  layout->segment_colon_width = digit_width / 2;
+
+  // BCD
+  lv_coord_t bcd_cell = sizes.bcd_cell_size;
+  layout->bcd_cell_size = bcd_cell;
+  layout->bcd_cell_gap = bcd_cell / 5;
+  layout->bcd_pair_gap = bcd_cell;
+
+  // Word clock
+  layout->word_cell_width = sizes.word_cell_width;
+  layout->word_cell_height = sizes.word_cell_height;
+
+  // Dashboard
+  layout->dash_width = sizes.dash_width;
+  layout->dash_height = sizes.dash_height;
+  layout->dash_gap = is_small ? 6 : 10;
+  layout->dash_radius = is_small ? 6 : 10;
+  layout->dash_padding = is_small ? 4 : 8;
+
+  // Wi-Fi prompt
+  layout->card_radius = is_small ? 8 : 16;
+  layout->card_padding = is_small ? 12 : 20;
+  layout->title_gap = is_small ? 8 : 12;
+  layout->button_height = is_small ? 28 : 36;
+  layout->button_gap = is_small ? 12 : 16;
+  layout->button_radius = is_small ? 6 : 8;
+}
+
+const ClockLayout *clock_layout_get(lv_coord_t width, lv_coord_t height,
+                                    UiScale ui_scale) {
+  LayoutSlot *victim = &slots[0];
+  for (auto &slot : slots) {
+    if (slot.valid && slot.layout.width == width &&
+        slot.layout.height == height && slot.layout.ui_scale == ui_scale) {
+      slot.last_used = ++use_counter;
+      return &slot.layout;
+    }
+    if (!slot.valid || (victim->valid && slot.last_used < victim->last_used)) {
+      victim = &slot;
+    }
+  }
+
+  ESP_LOGI(TAG, "Computing layout for %dx%d", (int)width, (int)height);
+  compute_layout(&victim->layout, width, height, ui_scale);
+  victim->valid = true;
+  victim->last_used = ++use_counter;
+  return &victim->layout;
+}
+
+void clock_layout_clear() {
+  for (auto &slot : slots) {
+    slot = {};
+  }
+  use_counter = 0;
+}
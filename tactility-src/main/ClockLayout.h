@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ClockCore.h"
+
+#include <lvgl.h>
+#include <tt_hal.h>
+
+// Geometry for every face at one container size. Layouts are cached per
+// (width, height, UiScale), so rotating back and forth only re-applies values
+// to existing widgets. Line widgets reference `marker_points` directly, so a
+// face keeps its own copy of the layout it applied (FaceView::own_layout)
+// rather than pointing into the cache.
+struct ClockLayout {
+  lv_coord_t width;
+  lv_coord_t height;
+  UiScale ui_scale;
+  bool is_small;
+
+  // Analog
+  lv_coord_t clock_size;
+  lv_coord_t border_width;
+  lv_coord_t center_x;
+  lv_coord_t center_y;
+  lv_coord_t hour_length;
+  lv_coord_t minute_length;
+  lv_coord_t second_length;
+  lv_coord_t hour_width;
+  lv_coord_t minute_width;
+  lv_coord_t center_dot_size;
+  lv_coord_t marker_widths[CLOCK_MARKER_COUNT];
+  lv_point_precise_t marker_points[CLOCK_MARKER_COUNT][2];
+
+  // Digital
+  lv_coord_t time_offset_y;
+  lv_coord_t time_radius;
+  lv_coord_t time_padding;
+  lv_coord_t date_gap;
+  lv_coord_t date_padding;
+
+  // Night-stand seven-segment digits
+  lv_coord_t segment_digit_width;
+  lv_coord_t segment_digit_height;
+  lv_coord_t segment_thickness;
+  lv_coord_t segment_digit_gap;
+  lv_coord_t segment_colon_width;
+
+  // Binary coded decimal cells
+  lv_coord_t bcd_cell_size;
+  lv_coord_t bcd_cell_gap;
+  lv_coord_t bcd_pair_gap;
+
+  // Word clock letter grid
+  lv_coord_t word_cell_width;
+  lv_coord_t word_cell_height;
+
+  // Dashboard grid
+  lv_coord_t dash_width;
+  lv_coord_t dash_height;
+  lv_coord_t dash_gap;
+  lv_coord_t dash_radius;
+  lv_coord_t dash_padding;
+
+  // Wi-Fi prompt
+  lv_coord_t card_radius;
+  lv_coord_t card_padding;
+  lv_coord_t title_gap;
+  lv_coord_t button_height;
+  lv_coord_t button_gap;
+  lv_coord_t button_radius;
+};
+
+// Returns the cached layout for this size, computing it on a miss.
+// The contents stay valid until enough other sizes have been requested to
+// evict it, so copy what has to outlive the next few calls.
+const ClockLayout *clock_layout_get(lv_coord_t width, lv_coord_t height,
+                                    UiScale ui_scale);
+
+void clock_layout_clear();
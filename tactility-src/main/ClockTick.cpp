@@ -0,0 +1,267 @@
+#include "ClockTick.h"
+#include "ClockFrame.h"
+#include "PowerBudget.h"
+
+#include <lvgl.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include <sys/time.h>
+
+constexpr auto *TAG = "ClockTick";
+
+// Ticks are scheduled this long after each second starts, so time() has
+// already rolled over when the timer fires
+constexpr uint32_t ALIGN_MARGIN_MS = 2;
+// Second-to-flush latency is logged after this many samples
+constexpr uint32_t LATENCY_LOG_SAMPLES = 60;
+
+struct Subscriber {
+  ClockTickCallback callback;
+  void *user_data;
+};
+
+static Subscriber subscribers[CLOCK_TICK_MAX_SUBSCRIBERS] = {};
+static int subscriber_count = 0;
+static lv_timer_t *tick_timer = nullptr;
+static bool dispatching = false;
+static bool paused = false;
+static time_t last_second = 0;
+static uint32_t interval_s = 1;
+static time_t fixed_time = 0;
+
+struct LatencyStats {
+  uint32_t count;
+  int64_t total_us;
+  int64_t max_us;
+};
+
+struct DisplaySync {
+  lv_display_t *display;
+  ClockTickMode mode;
+  int64_t pending_second_us; // Wall time of the dispatched second, 0 if none
+  int64_t flushed_us;        // Wall time of the last flush since then
+  LatencyStats latency;
+};
+
+static DisplaySync display_sync = {};
+
+static int64_t wall_time_us() {
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  return (int64_t)now.tv_sec * 1000000 + now.tv_usec;
+}
+
+// Close the gaps left by unsubscribing during a dispatch
+static void compact_subscribers() {
+  int count = 0;
+  for (int i = 0; i < subscriber_count; i++) {
+    if (subscribers[i].callback) {
+      subscribers[count++] = subscribers[i];
+    }
+  }
+  for (int i = count; i < subscriber_count; i++) {
+    subscribers[i] = {};
+  }
+  subscriber_count = count;
+
+  if (subscriber_count == 0 && tick_timer) {
+    lv_timer_delete(tick_timer);
+    tick_timer = nullptr;
+  }
+}
+
+static void dispatch(time_t now) {
+  int64_t start_us = esp_timer_get_time();
+  last_second = now;
+  struct tm timeinfo;
+  // Usually converted ahead of time on the other core
+  const ClockFrame *frame = clock_frame_get(now);
+  if (frame) {
+    timeinfo = frame->timeinfo;
+  } else {
+    localtime_r(&now, &timeinfo);
+  }
+  if (display_sync.display) {
+    display_sync.pending_second_us = (int64_t)now * 1000000;
+    display_sync.flushed_us = 0;
+  }
+
+  // Subscribers added by a callback start with the next tick
+  dispatching = true;
+  int count = subscriber_count;
+  for (int i = 0; i < count; i++) {
+    Subscriber subscriber = subscribers[i];
+    if (subscriber.callback) {
+      subscriber.callback(now, timeinfo, subscriber.user_data);
+    }
+  }
+  dispatching = false;
+  compact_subscribers();
+  power_budget_add_busy(start_us, esp_timer_get_time());
+}
+
+// Whether `now` starts a new interval since the last dispatch
+static bool is_due(time_t now) {
+  return now / interval_s != last_second / interval_s;
+}
+
+static void tick_timer_cb(lv_timer_t *timer) {
+  // Fire again just after the next interval starts
+  int64_t wall_us = wall_time_us();
+  int64_t interval_us = (int64_t)interval_s * 1000000;
+  lv_timer_set_period(
+      timer, (uint32_t)((interval_us - wall_us % interval_us) / 1000) +
+                 ALIGN_MARGIN_MS);
+  auto now = fixed_time ? fixed_time : (time_t)(wall_us / 1000000);
+  if (!is_due(now)) {
+    return;
+  }
+  if (display_sync.display && display_sync.mode == ClockTickOnRefresh) {
+    // Dispatched from the refresh it starts
+    lv_timer_t *refresh_timer = lv_display_get_refr_timer(display_sync.display);
+    lv_timer_resume(refresh_timer);
+    lv_timer_ready(refresh_timer);
+    return;
+  }
+  dispatch(now);
+  if (display_sync.display) {
+    lv_refr_now(display_sync.display);
+  }
+}
+
+static void refresh_start_cb(lv_event_t *e) {
+  if (paused || subscriber_count == 0) {
+    return;
+  }
+  time_t now = clock_tick_time();
+  if (is_due(now)) {
+    // Invalidated areas are drawn by the refresh that is starting
+    dispatch(now);
+  }
+}
+
+static void flush_finish_cb(lv_event_t *e) {
+  if (display_sync.pending_second_us != 0) {
+    display_sync.flushed_us = wall_time_us();
+  }
+}
+
+static void refresh_ready_cb(lv_event_t *e) {
+  if (display_sync.pending_second_us == 0 || display_sync.flushed_us == 0) {
+    return;
+  }
+  int64_t latency_us = display_sync.flushed_us - display_sync.pending_second_us;
+  display_sync.pending_second_us = 0;
+  // Skip samples around clock corrections
+  if (latency_us < 0 || latency_us >= 1000000) {
+    return;
+  }
+  LatencyStats &stats = display_sync.latency;
+  stats.count++;
+  stats.total_us += latency_us;
+  stats.max_us = LV_MAX(stats.max_us, latency_us);
+  if (stats.count == LATENCY_LOG_SAMPLES) {
+    ESP_LOGI(TAG, "Second to flush (%s): avg %.1f ms, max %.1f ms",
+             display_sync.mode == ClockTickOnRefresh ? "on refresh" : "immediate",
+             (double)stats.total_us / stats.count / 1000,
+             (double)stats.max_us / 1000);
+    stats = {};
+  }
+}
+
+bool clock_tick_subscribe(ClockTickCallback callback, void *user_data) {
+  if (subscriber_count == CLOCK_TICK_MAX_SUBSCRIBERS) {
+    ESP_LOGW(TAG, "No room for another subscriber");
+    return false;
+  }
+  subscribers[subscriber_count++] = {callback, user_data};
+
+  if (!tick_timer) {
+    tick_timer = lv_timer_create(tick_timer_cb, 1000, nullptr);
+    last_second = 0;
+    if (paused) {
+      lv_timer_pause(tick_timer);
+    }
+  }
+  return true;
+}
+
+void clock_tick_unsubscribe(ClockTickCallback callback, void *user_data) {
+  for (int i = 0; i < subscriber_count; i++) {
+    if (subscribers[i].callback == callback &&
+        subscribers[i].user_data == user_data) {
+      subscribers[i] = {};
+      break;
+    }
+  }
+  if (!dispatching) {
+    compact_subscribers();
+  }
+}
+
+void clock_tick_set_paused(bool pause) {
+  if (pause == paused) {
+    return;
+  }
+  paused = pause;
+  if (!tick_timer) {
+    return;
+  }
+  if (pause) {
+    lv_timer_pause(tick_timer);
+  } else {
+    lv_timer_resume(tick_timer);
+    lv_timer_ready(tick_timer);
+  }
+}
+
+time_t clock_tick_time() { return fixed_time ? fixed_time : ::time(nullptr); }
+
+void clock_tick_set_fixed_time(time_t time) {
+  fixed_time = time;
+  // Render the new time on the next pass
+  last_second = 0;
+  if (tick_timer && !paused) {
+    lv_timer_ready(tick_timer);
+  }
+}
+
+void clock_tick_set_interval(uint32_t seconds) {
+  if (seconds == 0 || seconds == interval_s) {
+    return;
+  }
+  interval_s = seconds;
+  if (tick_timer && !paused) {
+    // Reschedule for the new interval
+    lv_timer_ready(tick_timer);
+  }
+}
+
+void clock_tick_attach(lv_display_t *display, ClockTickMode mode) {
+  clock_tick_detach();
+  display_sync.display = display;
+  display_sync.mode = mode;
+  if (mode == ClockTickOnRefresh) {
+    lv_display_add_event_cb(display, refresh_start_cb, LV_EVENT_REFR_START,
+                            nullptr);
+  }
+  lv_display_add_event_cb(display, flush_finish_cb, LV_EVENT_FLUSH_FINISH,
+                          nullptr);
+  lv_display_add_event_cb(display, refresh_ready_cb, LV_EVENT_REFR_READY,
+                          nullptr);
+}
+
+void clock_tick_detach() {
+  if (!display_sync.display) {
+    return;
+  }
+  lv_display_remove_event_cb_with_user_data(display_sync.display, refresh_start_cb,
+                                            nullptr);
+  lv_display_remove_event_cb_with_user_data(display_sync.display, flush_finish_cb,
+                                            nullptr);
+  lv_display_remove_event_cb_with_user_data(display_sync.display, refresh_ready_cb,
+                                            nullptr);
+  display_sync = {};
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <time.h>
+
+// One lv_timer shared by every clock on screen. Each tick reads the time
+// once and hands the same snapshot to all subscribers in subscription order,
+// so N clocks cost one timer and one localtime_r() per second. The timer
+// exists only while there are subscribers, and fires just after each second
+// starts.
+typedef void (*ClockTickCallback)(time_t now, const struct tm &timeinfo,
+                                  void *user_data);
+
+constexpr int CLOCK_TICK_MAX_SUBSCRIBERS = 16;
+
+// Returns false when the subscriber table is full
+bool clock_tick_subscribe(ClockTickCallback callback, void *user_data);
+
+// Safe to call from within a tick callback
+void clock_tick_unsubscribe(ClockTickCallback callback, void *user_data);
+
+// While paused no tick fires. Resuming ticks on the next timer pass, so every
+// subscriber catches up to the current time in a single frame.
+void clock_tick_set_paused(bool paused);
+
+// The time ticks are for: the wall clock, or the fixed time if one is set
+time_t clock_tick_time();
+
+// Freezes every clock at `time` so frames render identically from run to run,
+// e.g. for reference screenshots on the simulator; 0 follows the wall clock
+void clock_tick_set_fixed_time(time_t time);
+
+// Ticks only when the time reaches a multiple of `seconds`, e.g. 60 for
+// minute updates under load. Defaults to 1.
+void clock_tick_set_interval(uint32_t seconds);
+
+// How a tick reaches the panel once a display is attached
+enum ClockTickMode {
+  // Render and flush from the tick itself with lv_refr_now()
+  ClockTickImmediate = 0,
+  // Apply the tick at the start of a display refresh, so the changes go out
+  // with that refresh; the tick only starts one early
+  ClockTickOnRefresh = 1,
+};
+
+// Without an attached display ticks wait for the next regular refresh.
+// Attached, the latency from each second starting to its last flush is
+// measured and logged every minute.
+void clock_tick_attach(lv_display_t *display, ClockTickMode mode);
+
+void clock_tick_detach();
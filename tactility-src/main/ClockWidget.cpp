@@ -0,0 +1,108 @@
+#include "ClockWidget.h"
+#include "ClockTick.h"
+
+#include <esp_log.h>
+
+constexpr auto *TAG = "ClockWidget";
+
+static bool arena_enabled = true;
+
+struct ClockWidget {
+  int face;
+  FaceView view;
+};
+
+static void widget_tick_cb(time_t now, const struct tm &timeinfo,
+                           void *user_data) {
+  auto *widget = static_cast<ClockWidget *>(user_data);
+  clock_face_update(&widget->view, timeinfo);
+}
+
+static void widget_size_changed_cb(lv_event_t *e) {
+  auto *obj = static_cast<lv_obj_t *>(lv_event_get_target(e));
+  auto *widget = static_cast<ClockWidget *>(lv_event_get_user_data(e));
+  const ClockLayout *current = widget->view.layout;
+  const ClockLayout *layout =
+      clock_layout_get(lv_obj_get_width(obj), lv_obj_get_height(obj),
+                       widget->view.settings.ui_scale);
+  if (current && current->width == layout->width &&
+      current->height == layout->height &&
+      current->ui_scale == layout->ui_scale) {
+    return;
+  }
+
+  clock_faces[widget->face].apply_layout(
+      &widget->view, face_view_adopt_layout(&widget->view, layout));
+  struct tm timeinfo;
+  get_local_time(&timeinfo);
+  clock_face_update(&widget->view, timeinfo);
+}
+
+static void widget_delete_cb(lv_event_t *e) {
+  auto *obj = static_cast<lv_obj_t *>(lv_event_get_target(e));
+  auto *widget = static_cast<ClockWidget *>(lv_event_get_user_data(e));
+  clock_tick_unsubscribe(widget_tick_cb, widget);
+  // Children are deleted after this event, but their delete callbacks may
+  // still point into the view, so delete them while it is alive
+  lv_obj_clean(obj);
+  lv_free(widget);
+}
+
+lv_obj_t *clock_widget_create(lv_obj_t *parent, int face,
+                              const ClockFaceSettings &settings) {
+  lv_obj_t *obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(obj);
+  lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
+  lv_obj_set_style_pad_all(obj, 10, 0);
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+  // Presses belong to the parent, e.g. for the carousel swipe
+  lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_layout(obj, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(obj, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_flex_align(obj, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER,
+                        LV_FLEX_ALIGN_CENTER);
+  // Faces size themselves from the widget's final size
+  lv_obj_update_layout(obj);
+
+  // The view and the face's arena share one allocation
+  const FaceInfo &info = clock_faces[face];
+  const ClockLayout *layout = clock_layout_get(
+      lv_obj_get_width(obj), lv_obj_get_height(obj), settings.ui_scale);
+  size_t arena_size = 0;
+  if (arena_enabled) {
+    arena_size =
+        FACE_ARENA_BASE_SIZE + (info.arena_size ? info.arena_size(layout) : 0);
+  }
+  auto *widget =
+      static_cast<ClockWidget *>(lv_malloc(sizeof(ClockWidget) + arena_size));
+  if (!widget) {
+    ESP_LOGE(TAG, "Not enough memory for a %s clock", info.name);
+    lv_obj_delete(obj);
+    return nullptr;
+  }
+  *widget = {};
+  widget->face = face;
+  widget->view.settings = settings;
+  face_arena_init(&widget->view.arena, widget + 1, arena_size);
+
+  lv_obj_set_user_data(obj, widget);
+  lv_obj_add_event_cb(obj, widget_delete_cb, LV_EVENT_DELETE, widget);
+  info.create(obj, &widget->view);
+  ESP_LOGD(TAG, "Created %s clock, %u of %u arena bytes used", info.name,
+           (unsigned)widget->view.arena.used, (unsigned)arena_size);
+
+  lv_obj_add_event_cb(obj, widget_size_changed_cb, LV_EVENT_SIZE_CHANGED,
+                      widget);
+  clock_tick_subscribe(widget_tick_cb, widget);
+  return obj;
+}
+
+int clock_widget_get_face(lv_obj_t *widget) {
+  return static_cast<ClockWidget *>(lv_obj_get_user_data(widget))->face;
+}
+
+const FaceView *clock_widget_get_view(lv_obj_t *widget) {
+  return &static_cast<ClockWidget *>(lv_obj_get_user_data(widget))->view;
+}
+
+void clock_widget_set_arena_enabled(bool enabled) { arena_enabled = enabled; }
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "ClockFaces.h"
+
+#include <lvgl.h>
+
+// A clock face as a self-contained LVGL object. All per-instance state (the
+// FaceView) lives in one allocation attached as user data and freed with the
+// object. Every instance is driven by the shared ClockTick timer and re-applies
+// its cached layout when its size changes.
+lv_obj_t *clock_widget_create(lv_obj_t *parent, int face,
+                              const ClockFaceSettings &settings);
+
+int clock_widget_get_face(lv_obj_t *widget);
+
+const FaceView *clock_widget_get_view(lv_obj_t *widget);
+
+// Faces allocate from their arena unless this is turned off, in which case
+// widgets created afterwards put everything on the heap as separate blocks.
+// Only for measuring what the arena saves; on by default.
+void clock_widget_set_arena_enabled(bool enabled);
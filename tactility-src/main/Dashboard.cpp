@@ -0,0 +1,191 @@
+#include "Dashboard.h"
+
+#include <esp_timer.h>
+
+#include <cstdio>
+#include <cstring>
+
+static void surface_draw_cb(lv_event_t *e);
+
+void dashboard_create(Dashboard *dashboard, lv_obj_t *parent,
+                      const DashboardZone *zones, bool show_seconds) {
+  *dashboard = {};
+  dashboard->show_seconds = show_seconds;
+
+  DashboardCell *cells = dashboard->cells;
+  cells[0].kind = DashboardCellLocal;
+  strcpy(cells[0].title, "Local");
+  for (int i = 0; i < DASHBOARD_ZONE_COUNT; i++) {
+    DashboardCell &cell = cells[i + 1];
+    cell.kind = DashboardCellZone;
+    snprintf(cell.title, sizeof(cell.title), "%s", zones[i].name);
+    cell.rule = zones[i].rule;
+  }
+  cells[DASHBOARD_CELL_COUNT - 1].kind = DashboardCellUptime;
+  strcpy(cells[DASHBOARD_CELL_COUNT - 1].title, "Uptime");
+
+  lv_obj_t *surface = lv_obj_create(parent);
+  dashboard->surface = surface;
+  lv_obj_remove_style_all(surface);
+  lv_obj_clear_flag(surface, LV_OBJ_FLAG_SCROLLABLE);
+  // Let presses reach the container so the carousel can be swiped
+  lv_obj_clear_flag(surface, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_event_cb(surface, surface_draw_cb, LV_EVENT_DRAW_MAIN, dashboard);
+}
+
+static void get_cell_area(const Dashboard *dashboard, int index,
+                          lv_area_t *area) {
+  lv_area_t coords;
+  lv_obj_get_coords(dashboard->surface, &coords);
+  lv_coord_t gap = dashboard->layout->dash_gap;
+  lv_coord_t cell_width = (lv_area_get_width(&coords) - gap) / 2;
+  lv_coord_t cell_height = (lv_area_get_height(&coords) - gap) / 2;
+  lv_coord_t x = coords.x1 + (index % 2) * (cell_width + gap);
+  lv_coord_t y = coords.y1 + (index / 2) * (cell_height + gap);
+  *area = {x, y, x + cell_width - 1, y + cell_height - 1};
+}
+
+int dashboard_zone_at(const Dashboard *dashboard, const lv_point_t *point) {
+  if (!dashboard->layout) {
+    return -1;
+  }
+  for (int i = 0; i < DASHBOARD_CELL_COUNT; i++) {
+    if (dashboard->cells[i].kind != DashboardCellZone) {
+      continue;
+    }
+    lv_area_t area;
+    get_cell_area(dashboard, i, &area);
+    if (lv_area_is_point_on(&area, point, 0)) {
+      return i - 1; // Zone cells follow the local one
+    }
+  }
+  return -1;
+}
+
+static void surface_draw_cb(lv_event_t *e) {
+  auto *dashboard = static_cast<Dashboard *>(lv_event_get_user_data(e));
+  if (!dashboard->layout) {
+    return;
+  }
+
+  lv_layer_t *layer = lv_event_get_layer(e);
+  const lv_font_t *font = lv_font_get_default();
+  lv_coord_t line_height = lv_font_get_line_height(font);
+  lv_coord_t padding = dashboard->layout->dash_padding;
+
+  lv_draw_rect_dsc_t background;
+  lv_draw_rect_dsc_init(&background);
+  background.bg_color = lv_color_hex(0x1E1E1E);
+  background.bg_opa = LV_OPA_COVER;
+  background.radius = dashboard->layout->dash_radius;
+
+  lv_draw_label_dsc_t caption;
+  lv_draw_label_dsc_init(&caption);
+  caption.font = font;
+  caption.color = lv_color_hex(0x999999);
+  caption.align = LV_TEXT_ALIGN_CENTER;
+
+  lv_draw_label_dsc_t value = caption;
+  value.color = lv_color_hex(0xFFFFFF);
+
+  for (int i = 0; i < DASHBOARD_CELL_COUNT; i++) {
+    const DashboardCell &cell = dashboard->cells[i];
+    lv_area_t area;
+    get_cell_area(dashboard, i, &area);
+    lv_draw_rect(layer, &background, &area);
+
+    lv_area_t title_area = {area.x1, area.y1 + padding, area.x2,
+                            area.y1 + padding + line_height - 1};
+    caption.text = cell.title;
+    lv_draw_label(layer, &caption, &title_area);
+
+    lv_coord_t middle = (area.y1 + area.y2 - line_height) / 2;
+    lv_area_t time_area = {area.x1, middle, area.x2, middle + line_height - 1};
+    value.text = cell.time_text;
+    lv_draw_label(layer, &value, &time_area);
+
+    lv_area_t detail_area = {area.x1, area.y2 - padding - line_height + 1,
+                             area.x2, area.y2 - padding};
+    caption.text = cell.detail_text;
+    lv_draw_label(layer, &caption, &detail_area);
+  }
+}
+
+void dashboard_apply_layout(Dashboard *dashboard, const ClockLayout *layout) {
+  dashboard->layout = layout;
+  lv_obj_set_size(dashboard->surface, layout->dash_width, layout->dash_height);
+  lv_obj_invalidate(dashboard->surface);
+}
+
+static void format_clock(char *out, size_t size, const struct tm &timeinfo,
+                         bool is_24_hour, bool show_seconds,
+                         const LocaleInfo *locale) {
+  const char *format;
+  if (show_seconds) {
+    format = is_24_hour ? "%H:%M:%S" : "%I:%M:%S %p";
+  } else {
+    format = is_24_hour ? "%H:%M" : "%I:%M %p";
+  }
+  locale_format(out, size, format, locale, timeinfo);
+}
+
+static void format_cell(const DashboardCell &cell, time_t now,
+                        const struct tm &local, bool is_24_hour,
+                        bool show_seconds, const LocaleInfo *locale,
+                        char *time_text, char *detail_text) {
+  constexpr size_t size = sizeof(cell.time_text);
+  switch (cell.kind) {
+  case DashboardCellLocal:
+    format_clock(time_text, size, local, is_24_hour, show_seconds, locale);
+    locale_format_pattern(detail_text, size, locale, LocaleWeekdayDay, local);
+    break;
+  case DashboardCellZone: {
+    time_t zone_time = now + zone_rule_offset(cell.rule, now);
+    struct tm zone;
+    gmtime_r(&zone_time, &zone);
+    format_clock(time_text, size, zone, is_24_hour, show_seconds, locale);
+    locale_format_pattern(detail_text, size, locale, LocaleWeekdayDay, zone);
+    break;
+  }
+  case DashboardCellUptime: {
+    auto seconds = (long)(esp_timer_get_time() / 1000000);
+    long days = seconds / 86400;
+    if (show_seconds) {
+      snprintf(time_text, size, "%02ld:%02ld:%02ld", seconds / 3600 % 24,
+               seconds / 60 % 60, seconds % 60);
+    } else {
+      snprintf(time_text, size, "%02ld:%02ld", seconds / 3600 % 24,
+               seconds / 60 % 60);
+    }
+    snprintf(detail_text, size, "%ld days", days);
+    break;
+  }
+  }
+}
+
+void dashboard_update(Dashboard *dashboard, const struct tm &timeinfo,
+                      bool is_24_hour, const LocaleInfo *locale) {
+  // The same instant as `timeinfo`, for the other zones
+  struct tm local = timeinfo;
+  time_t now = mktime(&local);
+
+  for (int i = 0; i < DASHBOARD_CELL_COUNT; i++) {
+    DashboardCell &cell = dashboard->cells[i];
+    char time_text[sizeof(cell.time_text)];
+    char detail_text[sizeof(cell.detail_text)];
+    format_cell(cell, now, timeinfo, is_24_hour, dashboard->show_seconds,
+                locale, time_text, detail_text);
+    if (strcmp(time_text, cell.time_text) == 0 &&
+        strcmp(detail_text, cell.detail_text) == 0) {
+      continue;
+    }
+
+    strcpy(cell.time_text, time_text);
+    strcpy(cell.detail_text, detail_text);
+    if (dashboard->layout) {
+      lv_area_t area;
+      get_cell_area(dashboard, i, &area);
+      lv_obj_invalidate_area(dashboard->surface, &area);
+    }
+  }
+}
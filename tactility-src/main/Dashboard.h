@@ -0,0 +1,57 @@
+#pragma once
+
+#include "ClockLayout.h"
+#include "Locale.h"
+#include "ZoneRule.h"
+
+#include <lvgl.h>
+
+#include <cstdint>
+#include <time.h>
+
+constexpr int DASHBOARD_ZONE_COUNT = 2;
+constexpr int DASHBOARD_CELL_COUNT = DASHBOARD_ZONE_COUNT + 2;
+
+// A zone's title and rule; daylight saving time is applied when drawing
+struct DashboardZone {
+  char name[16];
+  ZoneRule rule;
+};
+
+enum DashboardCellKind {
+  DashboardCellLocal,
+  DashboardCellZone,
+  DashboardCellUptime,
+};
+
+struct DashboardCell {
+  DashboardCellKind kind;
+  char title[16];
+  ZoneRule rule;
+  char time_text[16];
+  char detail_text[16];
+};
+
+// Local time, two other zones and device uptime in a 2 x 2 grid. The grid
+// is one object: every cell is drawn in the same DRAW_MAIN pass from text
+// formatted once per tick, and only cells whose text changed are invalidated.
+struct Dashboard {
+  lv_obj_t *surface;
+  const ClockLayout *layout;
+  bool show_seconds;
+  DashboardCell cells[DASHBOARD_CELL_COUNT];
+};
+
+// Without `show_seconds` times and the uptime end at the minute
+void dashboard_create(Dashboard *dashboard, lv_obj_t *parent,
+                      const DashboardZone *zones, bool show_seconds);
+
+void dashboard_apply_layout(Dashboard *dashboard, const ClockLayout *layout);
+
+// Index into the zones the dashboard was created with of the zone cell at
+// `point` (screen coordinates), or -1
+int dashboard_zone_at(const Dashboard *dashboard, const lv_point_t *point);
+
+// All cells are derived from the one local time snapshot
+void dashboard_update(Dashboard *dashboard, const struct tm &timeinfo,
+                      bool is_24_hour, const LocaleInfo *locale);
@@ -0,0 +1,23 @@
+#include "FaceArena.h"
+
+void face_arena_init(FaceArena *arena, void *memory, size_t capacity) {
+  arena->base = static_cast<uint8_t *>(memory);
+  arena->capacity = memory ? capacity : 0;
+  arena->used = 0;
+}
+
+void *face_arena_alloc(FaceArena *arena, size_t size, size_t alignment) {
+  auto address = reinterpret_cast<uintptr_t>(arena->base) + arena->used;
+  size_t padding = (alignment - address % alignment) % alignment;
+  if (padding + size > arena->capacity - arena->used) {
+    return nullptr;
+  }
+  arena->used += padding;
+  void *memory = arena->base + arena->used;
+  arena->used += size;
+  return memory;
+}
+
+size_t face_arena_remaining(const FaceArena *arena) {
+  return arena->capacity - arena->used;
+}
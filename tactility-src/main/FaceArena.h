@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Bump allocator for data owned by one face: label text buffers, hand
+// coverage layers and similar. The memory is carved from the clock widget's
+// own allocation, so everything a face allocated is released in one step
+// when the widget is freed, instead of as many differently sized heap blocks.
+// There is no per-allocation free.
+struct FaceArena {
+  uint8_t *base;
+  size_t capacity;
+  size_t used;
+};
+
+void face_arena_init(FaceArena *arena, void *memory, size_t capacity);
+
+// Returns nullptr when the arena is exhausted; callers fall back to the heap
+void *face_arena_alloc(FaceArena *arena, size_t size,
+                       size_t alignment = alignof(max_align_t));
+
+size_t face_arena_remaining(const FaceArena *arena);
@@ -0,0 +1,249 @@
+#include "FaceAssets.h"
+#include "RleDecoder.h"
+
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include <cstdio>
+#include <cstring>
+
+constexpr auto *TAG = "FaceAssets";
+
+constexpr int MAX_ENTRIES = 6;
+constexpr size_t BUDGET_INTERNAL = 96 * 1024;
+constexpr size_t BUDGET_PSRAM = 512 * 1024;
+constexpr int NAME_SIZE = 32;
+constexpr int HEADER_SIZE = 24;
+constexpr int READ_CHUNK_SIZE = 512;
+constexpr uint8_t FORMAT_VERSION = 1;
+
+struct AssetEntry {
+  char name[NAME_SIZE];
+  lv_draw_buf_t *buffer; // nullptr for a file known to be missing
+  uint16_t design_size;
+  uint16_t pins;
+  uint32_t last_used;
+  bool orphaned; // Cleared while pinned, destroy on release
+};
+
+// Header written by convert_images.py, little-endian
+struct ImageHeader {
+  uint8_t color_format;
+  uint8_t unit;
+  uint16_t width;
+  uint16_t height;
+  uint16_t stride;
+  uint16_t design_size;
+  uint32_t data_size;
+};
+
+static AssetEntry entries[MAX_ENTRIES] = {};
+static char directory[128] = "";
+static size_t used = 0;
+static uint32_t use_counter = 0;
+
+static size_t budget() {
+  return heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0 ? BUDGET_PSRAM
+                                                         : BUDGET_INTERNAL;
+}
+
+static void destroy_entry(AssetEntry *entry) {
+  if (entry->buffer) {
+    used -= entry->buffer->data_size;
+    lv_image_cache_drop(entry->buffer);
+    lv_draw_buf_destroy(entry->buffer);
+  }
+  *entry = {};
+}
+
+static AssetEntry *find_entry(const char *name) {
+  for (auto &entry : entries) {
+    if (entry.name[0] && !entry.orphaned && strcmp(entry.name, name) == 0) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+static bool evict_one() {
+  AssetEntry *victim = nullptr;
+  for (auto &entry : entries) {
+    if (entry.name[0] && entry.pins == 0 &&
+        (!victim || entry.last_used < victim->last_used)) {
+      victim = &entry;
+    }
+  }
+  if (!victim) {
+    return false;
+  }
+  ESP_LOGD(TAG, "Evicting %s", victim->name);
+  destroy_entry(victim);
+  return true;
+}
+
+static AssetEntry *free_entry() {
+  for (auto &entry : entries) {
+    if (!entry.name[0]) {
+      return &entry;
+    }
+  }
+  return evict_one() ? free_entry() : nullptr;
+}
+
+static uint16_t read_u16(const uint8_t *data) {
+  return (uint16_t)(data[0] | data[1] << 8);
+}
+
+static uint32_t read_u32(const uint8_t *data) {
+  return (uint32_t)data[0] | (uint32_t)data[1] << 8 |
+         (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+static bool read_header(FILE *file, ImageHeader *header) {
+  uint8_t data[HEADER_SIZE];
+  if (fread(data, 1, HEADER_SIZE, file) != HEADER_SIZE ||
+      memcmp(data, "TCIM", 4) != 0 || data[4] != FORMAT_VERSION) {
+    return false;
+  }
+  header->color_format = data[5];
+  header->unit = data[6];
+  header->width = read_u16(data + 8);
+  header->height = read_u16(data + 10);
+  header->stride = read_u16(data + 12);
+  header->design_size = read_u16(data + 14);
+  header->data_size = read_u32(data + 16);
+  return header->unit >= 1 && header->unit <= 4 && header->width &&
+         header->height && header->data_size % header->unit == 0;
+}
+
+static lv_draw_buf_t *load_image(const char *path, uint16_t *design_size) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return nullptr;
+  }
+  int64_t start = esp_timer_get_time();
+  ImageHeader header;
+  if (!read_header(file, &header)) {
+    ESP_LOGW(TAG, "%s is not a converted face image", path);
+    fclose(file);
+    return nullptr;
+  }
+  lv_draw_buf_t *buffer =
+      lv_draw_buf_create(header.width, header.height,
+                         (lv_color_format_t)header.color_format, header.stride);
+  if (!buffer || buffer->data_size < header.data_size) {
+    ESP_LOGW(TAG, "No room to decode %s", path);
+    if (buffer) {
+      lv_draw_buf_destroy(buffer);
+    }
+    fclose(file);
+    return nullptr;
+  }
+
+  RleDecoder decoder;
+  rle_decoder_init(&decoder, buffer->data, header.data_size, header.unit);
+  uint8_t chunk[READ_CHUNK_SIZE];
+  size_t compressed = HEADER_SIZE;
+  size_t length;
+  while (!decoder.error &&
+         (length = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    rle_decode(&decoder, chunk, length);
+    compressed += length;
+  }
+  fclose(file);
+  if (!rle_decoder_complete(&decoder)) {
+    ESP_LOGW(TAG, "%s is corrupt", path);
+    lv_draw_buf_destroy(buffer);
+    return nullptr;
+  }
+
+  *design_size = header.design_size;
+  ESP_LOGI(TAG, "Loaded %s: %ux%u, %u -> %u bytes in %lld us", path,
+           (unsigned)header.width, (unsigned)header.height,
+           (unsigned)compressed, (unsigned)header.data_size,
+           (long long)(esp_timer_get_time() - start));
+  return buffer;
+}
+
+// Looks up or loads one file; missing files are remembered as such
+static AssetEntry *lookup(const char *name) {
+  AssetEntry *entry = find_entry(name);
+  if (entry) {
+    return entry;
+  }
+
+  char path[sizeof(directory) + NAME_SIZE + 8];
+  snprintf(path, sizeof(path), "%s/%s.bin", directory, name);
+  uint16_t design_size = 0;
+  lv_draw_buf_t *buffer = load_image(path, &design_size);
+  if (buffer) {
+    while (used + buffer->data_size > budget() && evict_one()) {
+    }
+  }
+  entry = free_entry();
+  if (!entry) {
+    // Every entry is pinned; hand out nothing rather than exceed the table
+    if (buffer) {
+      lv_draw_buf_destroy(buffer);
+    }
+    return nullptr;
+  }
+  snprintf(entry->name, sizeof(entry->name), "%s", name);
+  entry->buffer = buffer;
+  entry->design_size = design_size;
+  if (buffer) {
+    used += buffer->data_size;
+  }
+  return entry;
+}
+
+void face_assets_set_directory(const char *path) {
+  if (strcmp(directory, path) != 0) {
+    face_assets_clear();
+    snprintf(directory, sizeof(directory), "%s", path);
+  }
+}
+
+FaceAsset face_asset_acquire(const char *name, int32_t size) {
+  if (!directory[0]) {
+    return {nullptr, 0};
+  }
+  char sized_name[NAME_SIZE];
+  snprintf(sized_name, sizeof(sized_name), "%s_%ld", name, (long)size);
+  AssetEntry *entry = lookup(sized_name);
+  if (!entry || !entry->buffer) {
+    entry = lookup(name);
+  }
+  if (!entry || !entry->buffer) {
+    return {nullptr, 0};
+  }
+  entry->pins++;
+  entry->last_used = ++use_counter;
+  return {entry->buffer, entry->design_size};
+}
+
+void face_asset_release(lv_draw_buf_t *buffer) {
+  for (auto &entry : entries) {
+    if (entry.buffer == buffer && entry.pins > 0) {
+      entry.pins--;
+      if (entry.orphaned && entry.pins == 0) {
+        destroy_entry(&entry);
+      }
+      return;
+    }
+  }
+}
+
+void face_assets_clear() {
+  for (auto &entry : entries) {
+    if (!entry.name[0]) {
+      continue;
+    }
+    if (entry.pins == 0) {
+      destroy_entry(&entry);
+    } else {
+      entry.orphaned = true;
+    }
+  }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Face images produced by convert_images.py, loaded from the app's assets on
+// first use. Files hold RLE-compressed pixels in the display's native color
+// format, which decode straight into a draw buffer. Decoded images are kept
+// in a small LRU cache bounded by a byte budget, so recreating a face (e.g.
+// when swiping back to it) does not decode again.
+struct FaceAsset {
+  lv_draw_buf_t *buffer;
+  // Dial diameter the image was drawn for, 0 when unknown
+  uint16_t design_size;
+};
+
+// Directory holding the converted images, e.g. "<app assets>/faces"
+void face_assets_set_directory(const char *directory);
+
+// Prefers "<name>_<size>.bin" (pre-scaled for a dial of `size`) over
+// "<name>.bin". Returns a pinned asset, or one with a null buffer when the
+// image is missing or cannot be decoded.
+FaceAsset face_asset_acquire(const char *name, int32_t size);
+
+void face_asset_release(lv_draw_buf_t *buffer);
+
+// Drops unpinned images
+void face_assets_clear();
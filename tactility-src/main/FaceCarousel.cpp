@@ -0,0 +1,298 @@
+#include "FaceCarousel.h"
+#include "FaceTransition.h"
+#include "SnapshotCache.h"
+
+#include <esp_log.h>
+
+#include <cstdlib>
+
+constexpr auto *TAG = "FaceCarousel";
+
+constexpr int32_t DRAG_THRESHOLD = 12;
+constexpr uint32_t SETTLE_DURATION_MS = 200;
+constexpr uint32_t PREWARM_DELAY_MS = 500;
+
+// Slots for the previous, current and next face
+constexpr int SLOT_COUNT = 3;
+constexpr int SLOT_CURRENT = 1;
+
+struct CarouselState {
+  lv_obj_t *container;
+  const FaceCarouselOps *ops;
+  lv_obj_t *overlay;
+  lv_obj_t *images[SLOT_COUNT];
+  lv_draw_buf_t *buffers[SLOT_COUNT];
+  int faces[SLOT_COUNT];
+  lv_point_t press_point;
+  int32_t offset;
+  int32_t width;
+  bool pressed;
+  bool dragging;
+  bool settling;
+  int target; // -1 previous, 0 stay, +1 next
+  lv_timer_t *prewarm_timer;
+};
+
+static CarouselState carousel = {};
+
+static int wrap_face(int face) {
+  int count = carousel.ops->get_face_count();
+  return (face % count + count) % count;
+}
+
+static lv_draw_buf_t *acquire_face_snapshot(int face, bool is_live) {
+  // The live face is always captured fresh, neighbours come from the cache
+  uint32_t stamp = carousel.ops->get_stamp();
+  if (!is_live) {
+    lv_draw_buf_t *cached = snapshot_cache_acquire(face, stamp);
+    if (cached) {
+      return cached;
+    }
+  }
+
+  lv_draw_buf_t *buffer = is_live ? lv_snapshot_take(carousel.container, LV_COLOR_FORMAT_NATIVE)
+                   : carousel.ops->render_face(face);
+  if (!buffer || !snapshot_cache_put(face, stamp, buffer)) {
+    return nullptr;
+  }
+  return snapshot_cache_acquire(face, stamp);
+}
+
+static void release_slots() {
+  for (int i = 0; i < SLOT_COUNT; i++) {
+    if (carousel.buffers[i]) {
+      snapshot_cache_release(carousel.buffers[i]);
+      carousel.buffers[i] = nullptr;
+    }
+    carousel.images[i] = nullptr;
+  }
+}
+
+static void layout_images() {
+  for (int i = 0; i < SLOT_COUNT; i++) {
+    if (carousel.images[i]) {
+      lv_obj_set_x(carousel.images[i],
+                   (i - SLOT_CURRENT) * carousel.width + carousel.offset);
+    }
+  }
+}
+
+static void end_drag() {
+  lv_anim_delete(&carousel, nullptr);
+  if (carousel.overlay && lv_obj_is_valid(carousel.overlay)) {
+    lv_obj_delete(carousel.overlay);
+  }
+  carousel.overlay = nullptr;
+  release_slots();
+
+  if (carousel.container && lv_obj_is_valid(carousel.container)) {
+    lv_obj_set_style_opa(carousel.container, LV_OPA_COVER, 0);
+  }
+  carousel.dragging = false;
+  carousel.settling = false;
+  carousel.offset = 0;
+}
+
+static bool begin_drag() {
+  face_transition_finish();
+
+  int count = carousel.ops->get_face_count();
+  int current = carousel.ops->get_current_face();
+  carousel.width = lv_obj_get_width(carousel.container);
+
+  for (int i = 0; i < SLOT_COUNT; i++) {
+    carousel.faces[i] = wrap_face(current + i - SLOT_CURRENT);
+    if (i != SLOT_CURRENT && count < 2) {
+      continue;
+    }
+    carousel.buffers[i] =
+        acquire_face_snapshot(carousel.faces[i], i == SLOT_CURRENT);
+  }
+
+  if (!carousel.buffers[SLOT_CURRENT]) {
+    ESP_LOGW(TAG, "No snapshot of the current face, swiping without preview");
+    release_slots();
+    return false;
+  }
+
+  carousel.overlay = lv_obj_create(lv_obj_get_parent(carousel.container));
+  lv_obj_remove_style_all(carousel.overlay);
+  lv_obj_add_flag(carousel.overlay, LV_OBJ_FLAG_IGNORE_LAYOUT);
+  lv_obj_clear_flag(carousel.overlay, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_clear_flag(carousel.overlay, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_size(carousel.overlay, carousel.width,
+                  lv_obj_get_height(carousel.container));
+  lv_obj_align_to(carousel.overlay, carousel.container, LV_ALIGN_TOP_LEFT, 0, 0);
+
+  for (int i = 0; i < SLOT_COUNT; i++) {
+    if (carousel.buffers[i]) {
+      carousel.images[i] = lv_image_create(carousel.overlay);
+      lv_image_set_src(carousel.images[i], carousel.buffers[i]);
+      lv_obj_set_y(carousel.images[i], 0);
+    }
+  }
+
+  // Transparent instead of hidden so the container keeps receiving the press
+  lv_obj_set_style_opa(carousel.container, LV_OPA_TRANSP, 0);
+  carousel.dragging = true;
+  return true;
+}
+
+static int32_t clamp_offset(int32_t offset) {
+  // No preview available in that direction: don't move
+  if (offset > 0 && !carousel.buffers[SLOT_CURRENT - 1]) {
+    return 0;
+  }
+  if (offset < 0 && !carousel.buffers[SLOT_CURRENT + 1]) {
+    return 0;
+  }
+  return LV_MAX(-carousel.width, LV_MIN(carousel.width, offset));
+}
+
+static void settle_anim_cb(void *var, int32_t value) {
+  carousel.offset = value;
+  layout_images();
+}
+
+static void settle_completed_cb(lv_anim_t *anim) {
+  int target = carousel.target;
+  int face = carousel.faces[SLOT_CURRENT + target];
+  end_drag();
+
+  if (target != 0) {
+    carousel.ops->settle(face);
+    face_carousel_prewarm();
+  }
+}
+
+static void start_settle() {
+  int32_t threshold = carousel.width / 4;
+  if (carousel.offset < -threshold) {
+    carousel.target = 1;
+  } else if (carousel.offset > threshold) {
+    carousel.target = -1;
+  } else {
+    carousel.target = 0;
+  }
+  carousel.settling = true;
+
+  lv_anim_t anim;
+  lv_anim_init(&anim);
+  lv_anim_set_var(&anim, &carousel);
+  lv_anim_set_values(&anim, carousel.offset, -carousel.target * carousel.width);
+  lv_anim_set_duration(&anim, SETTLE_DURATION_MS);
+  lv_anim_set_exec_cb(&anim, settle_anim_cb);
+  lv_anim_set_path_cb(&anim, lv_anim_path_ease_out);
+  lv_anim_set_completed_cb(&anim, settle_completed_cb);
+  lv_anim_start(&anim);
+}
+
+static void carousel_event_cb(lv_event_t *e) {
+  lv_event_code_t code = lv_event_get_code(e);
+  if (code != LV_EVENT_PRESSED && code != LV_EVENT_PRESSING &&
+      code != LV_EVENT_RELEASED && code != LV_EVENT_PRESS_LOST) {
+    return;
+  }
+
+  lv_indev_t *indev = lv_indev_active();
+  if (!indev || lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) {
+    return;
+  }
+
+  lv_point_t point;
+  lv_indev_get_point(indev, &point);
+
+  if (code == LV_EVENT_PRESSED) {
+    if (carousel.settling || !carousel.ops->is_enabled()) {
+      return;
+    }
+    carousel.pressed = true;
+    carousel.press_point = point;
+  } else if (code == LV_EVENT_PRESSING && carousel.pressed) {
+    int32_t dx = point.x - carousel.press_point.x;
+    int32_t dy = point.y - carousel.press_point.y;
+    if (!carousel.dragging) {
+      if (std::abs(dx) < DRAG_THRESHOLD || std::abs(dx) <= std::abs(dy)) {
+        return;
+      }
+      if (carousel.ops->get_face_count() < 2) {
+        carousel.pressed = false;
+        return;
+      }
+      if (!begin_drag()) {
+        // Out of snapshot memory: switch without the live preview
+        carousel.pressed = false;
+        carousel.ops->settle(wrap_face(carousel.ops->get_current_face() +
+                                       (dx < 0 ? 1 : -1)));
+        return;
+      }
+    }
+    carousel.offset = clamp_offset(dx);
+    layout_images();
+  } else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
+    carousel.pressed = false;
+    if (carousel.dragging && !carousel.settling) {
+      start_settle();
+    }
+  }
+}
+
+static void prewarm_timer_cb(lv_timer_t *timer) {
+  carousel.prewarm_timer = nullptr;
+  if (!carousel.container || carousel.dragging ||
+      !carousel.ops->is_enabled() || carousel.ops->get_face_count() < 2) {
+    return;
+  }
+
+  uint32_t stamp = carousel.ops->get_stamp();
+  int current = carousel.ops->get_current_face();
+  int neighbours[2] = {wrap_face(current + 1), wrap_face(current - 1)};
+  for (int face : neighbours) {
+    if (snapshot_cache_contains(face, stamp)) {
+      continue;
+    }
+    lv_draw_buf_t *buffer = carousel.ops->render_face(face);
+    if (buffer) {
+      snapshot_cache_put(face, stamp, buffer);
+    }
+  }
+  ESP_LOGD(TAG, "Prewarmed neighbours of face %d, cache uses %u bytes",
+           current, (unsigned)snapshot_cache_get_used());
+}
+
+void face_carousel_prewarm() {
+  if (!carousel.container) {
+    return;
+  }
+  if (carousel.prewarm_timer) {
+    lv_timer_reset(carousel.prewarm_timer);
+    return;
+  }
+  carousel.prewarm_timer = lv_timer_create(prewarm_timer_cb, PREWARM_DELAY_MS, nullptr);
+  lv_timer_set_repeat_count(carousel.prewarm_timer, 1);
+}
+
+bool face_carousel_is_dragging() {
+  return carousel.dragging || carousel.settling;
+}
+
+void face_carousel_attach(lv_obj_t *container, const FaceCarouselOps *ops) {
+  face_carousel_detach();
+  carousel.container = container;
+  carousel.ops = ops;
+  lv_obj_add_event_cb(container, carousel_event_cb, LV_EVENT_ALL, nullptr);
+  face_carousel_prewarm();
+}
+
+void face_carousel_detach() {
+  if (carousel.prewarm_timer) {
+    lv_timer_delete(carousel.prewarm_timer);
+    carousel.prewarm_timer = nullptr;
+  }
+  end_drag();
+  if (carousel.container && lv_obj_is_valid(carousel.container)) {
+    lv_obj_remove_event_cb(carousel.container, carousel_event_cb);
+  }
+  carousel = {};
+  snapshot_cache_clear();
+}
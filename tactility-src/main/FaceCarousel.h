@@ -0,0 +1,31 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <cstdint>
+
+// Horizontal swipe carousel across all clock faces.
+// While dragging, only cached snapshots of the current and neighbouring faces
+// are composited; a face is instantiated live once the carousel settles on it.
+struct FaceCarouselOps {
+  int (*get_face_count)();
+  int (*get_current_face)();
+  // Swiping is disabled while this returns false (e.g. Wi-Fi prompt shown)
+  bool (*is_enabled)();
+  // Render `face` off-screen and return its snapshot, owned by the caller
+  lv_draw_buf_t *(*render_face)(int face);
+  // Make `face` the live face
+  void (*settle)(int face);
+  // Snapshots are reused while this stamp is unchanged (e.g. current minute)
+  uint32_t (*get_stamp)();
+};
+
+void face_carousel_attach(lv_obj_t *container, const FaceCarouselOps *ops);
+
+void face_carousel_detach();
+
+// A swipe is being dragged or animating to rest
+bool face_carousel_is_dragging();
+
+// Render neighbours of the current face into the snapshot cache (deferred)
+void face_carousel_prewarm();
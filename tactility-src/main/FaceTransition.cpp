@@ -0,0 +1,147 @@
+#include "FaceTransition.h"
+
+#include <esp_log.h>
+
+constexpr auto *TAG = "FaceTransition";
+
+constexpr uint32_t TRANSITION_DURATION_MS = 300;
+constexpr int32_t TRANSITION_STEPS = 1024;
+
+struct TransitionState {
+  lv_obj_t *container; // Live face tree, hidden while the bitmaps animate
+  lv_obj_t *overlay;
+  lv_obj_t *outgoing_image;
+  lv_obj_t *incoming_image;
+  lv_draw_buf_t *outgoing;
+  lv_draw_buf_t *incoming;
+  FaceTransitionStyle style;
+  int direction;
+  int32_t width;
+};
+
+static TransitionState transition = {};
+
+static void release_snapshot(lv_draw_buf_t **snapshot) {
+  if (*snapshot) {
+    lv_image_cache_drop(*snapshot);
+    lv_draw_buf_destroy(*snapshot);
+    *snapshot = nullptr;
+  }
+}
+
+static void transition_anim_cb(void *var, int32_t value) {
+  auto *state = static_cast<TransitionState *>(var);
+  if (!state->overlay) {
+    return;
+  }
+
+  if (state->style == FaceTransitionCrossfade) {
+    auto opa = (lv_opa_t)((value * LV_OPA_COVER) / TRANSITION_STEPS);
+    lv_obj_set_style_image_opa(state->incoming_image, opa, 0);
+  } else {
+    int32_t offset = (state->width * value) / TRANSITION_STEPS;
+    lv_obj_set_x(state->outgoing_image, -state->direction * offset);
+    lv_obj_set_x(state->incoming_image,
+                 state->direction * (state->width - offset));
+  }
+}
+
+static void transition_completed_cb(lv_anim_t *anim) {
+  face_transition_finish();
+}
+
+void face_transition_finish() {
+  lv_anim_delete(&transition, transition_anim_cb);
+
+  if (transition.overlay && lv_obj_is_valid(transition.overlay)) {
+    lv_obj_delete(transition.overlay);
+  }
+  transition.overlay = nullptr;
+  transition.outgoing_image = nullptr;
+  transition.incoming_image = nullptr;
+
+  // Images are gone, so the buffers are no longer referenced
+  release_snapshot(&transition.outgoing);
+  release_snapshot(&transition.incoming);
+
+  if (transition.container && lv_obj_is_valid(transition.container)) {
+    lv_obj_clear_flag(transition.container, LV_OBJ_FLAG_HIDDEN);
+  }
+  transition.container = nullptr;
+}
+
+bool face_transition_is_running() { return transition.overlay != nullptr; }
+
+static lv_obj_t *create_snapshot_image(lv_obj_t *overlay,
+                                       lv_draw_buf_t *snapshot) {
+  lv_obj_t *image = lv_image_create(overlay);
+  lv_image_set_src(image, snapshot);
+  lv_obj_set_pos(image, 0, 0);
+  return image;
+}
+
+void face_transition_start(lv_obj_t *container, FaceTransitionStyle style,
+                           int direction, FaceRebuildCallback rebuild) {
+  face_transition_finish();
+
+#if LV_USE_SNAPSHOT
+  if (style == FaceTransitionNone) {
+    rebuild();
+    return;
+  }
+
+  lv_obj_update_layout(container);
+  transition.outgoing = lv_snapshot_take(container, LV_COLOR_FORMAT_NATIVE);
+  if (!transition.outgoing) {
+    ESP_LOGW(TAG, "Not enough memory for outgoing snapshot, swapping instantly");
+    rebuild();
+    return;
+  }
+
+  rebuild();
+
+  // Lay out the new face now so the snapshot matches what will be shown
+  lv_obj_update_layout(container);
+  transition.incoming = lv_snapshot_take(container, LV_COLOR_FORMAT_NATIVE);
+  if (!transition.incoming) {
+    ESP_LOGW(TAG, "Not enough memory for incoming snapshot, swapping instantly");
+    release_snapshot(&transition.outgoing);
+    return;
+  }
+
+  transition.container = container;
+  transition.style = style;
+  transition.direction = direction < 0 ? -1 : 1;
+  transition.width = lv_obj_get_width(container);
+
+  // Overlay covers the container and clips the sliding bitmaps to its area
+  transition.overlay = lv_obj_create(lv_obj_get_parent(container));
+  lv_obj_remove_style_all(transition.overlay);
+  lv_obj_add_flag(transition.overlay, LV_OBJ_FLAG_IGNORE_LAYOUT);
+  lv_obj_clear_flag(transition.overlay, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_size(transition.overlay, lv_obj_get_width(container),
+                  lv_obj_get_height(container));
+  lv_obj_align_to(transition.overlay, container, LV_ALIGN_TOP_LEFT, 0, 0);
+
+  transition.outgoing_image =
+      create_snapshot_image(transition.overlay, transition.outgoing);
+  transition.incoming_image =
+      create_snapshot_image(transition.overlay, transition.incoming);
+  transition_anim_cb(&transition, 0);
+
+  // Only the bitmaps are drawn until the animation completes
+  lv_obj_add_flag(container, LV_OBJ_FLAG_HIDDEN);
+
+  lv_anim_t anim;
+  lv_anim_init(&anim);
+  lv_anim_set_var(&anim, &transition);
+  lv_anim_set_values(&anim, 0, TRANSITION_STEPS);
+  lv_anim_set_duration(&anim, TRANSITION_DURATION_MS);
+  lv_anim_set_exec_cb(&anim, transition_anim_cb);
+  lv_anim_set_path_cb(&anim, lv_anim_path_ease_out);
+  lv_anim_set_completed_cb(&anim, transition_completed_cb);
+  lv_anim_start(&anim);
+#else
+  rebuild();
+#endif
+}
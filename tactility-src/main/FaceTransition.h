@@ -0,0 +1,26 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Animated swap between clock faces.
+// Both faces are captured with lv_snapshot, so the animation only composites
+// two bitmaps instead of re-rendering live widget trees on every frame.
+enum FaceTransitionStyle {
+  FaceTransitionNone = 0,
+  FaceTransitionSlide = 1,
+  FaceTransitionCrossfade = 2,
+};
+
+typedef void (*FaceRebuildCallback)();
+
+// Snapshot the current content of `container`, call `rebuild` to create the
+// incoming face, snapshot that, then animate from one bitmap to the other.
+// `direction` is +1 (incoming from the right) or -1 (from the left).
+// Falls back to an instant rebuild when snapshots cannot be allocated.
+void face_transition_start(lv_obj_t *container, FaceTransitionStyle style,
+                           int direction, FaceRebuildCallback rebuild);
+
+// Jump to the end of a running transition (live face visible, buffers freed)
+void face_transition_finish();
+
+bool face_transition_is_running();
@@ -0,0 +1,20 @@
+#include "FetchSchedule.h"
+
+void fetch_schedule_init(FetchSchedule *schedule) {
+  schedule->backoff_s = FETCH_BACKOFF_MIN_S;
+  schedule->backing_off = false;
+}
+
+uint32_t fetch_schedule_next(FetchSchedule *schedule, FetchResult result,
+                             uint32_t interval_s) {
+  if (result != FetchFailed) {
+    fetch_schedule_init(schedule);
+    return interval_s;
+  }
+  uint32_t delay_s = schedule->backoff_s;
+  schedule->backoff_s = schedule->backoff_s * 2 < FETCH_BACKOFF_MAX_S
+                            ? schedule->backoff_s * 2
+                            : FETCH_BACKOFF_MAX_S;
+  schedule->backing_off = true;
+  return delay_s;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+// When the background services try again: their own interval after a
+// success, exponential backoff from one minute up to an hour after failures.
+// Plain C++ without ESP-IDF dependencies, so it builds on a host.
+constexpr uint32_t FETCH_BACKOFF_MIN_S = 60;
+constexpr uint32_t FETCH_BACKOFF_MAX_S = 60 * 60;
+
+enum FetchResult {
+  FetchUpdated,
+  FetchNotModified, // 304 to a conditional request
+  FetchFailed,
+};
+
+struct FetchSchedule {
+  uint32_t backoff_s; // Delay after the next failure
+  bool backing_off;   // The last attempt failed
+};
+
+void fetch_schedule_init(FetchSchedule *schedule);
+
+// Seconds until the next attempt after `result`; a 304 counts as a success
+uint32_t fetch_schedule_next(FetchSchedule *schedule, FetchResult result,
+                             uint32_t interval_s);
@@ -0,0 +1,193 @@
+#include "HandRasterizer.h"
+
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+constexpr int SUBSAMPLES = 4;
+// Coverage contributed by one sub-scanline fully covering a pixel
+constexpr int32_t SUBSAMPLE_COVERAGE = 256 / SUBSAMPLES;
+constexpr int COUNTERWEIGHT_SEGMENTS = 16;
+
+// Per-row coverage sums, relative to the clip rectangle's left edge
+static uint16_t row_accumulator[RASTER_MAX_WIDTH + 1];
+
+static int32_t to_fixed(float value) {
+  return (int32_t)lroundf(value * (float)RASTER_ONE);
+}
+
+RasterRect raster_rect_empty() { return {0, 0, -1, -1}; }
+
+RasterRect raster_rect_union(const RasterRect &a, const RasterRect &b) {
+  if (raster_rect_is_empty(a)) {
+    return b;
+  }
+  if (raster_rect_is_empty(b)) {
+    return a;
+  }
+  return {a.x1 < b.x1 ? a.x1 : b.x1, a.y1 < b.y1 ? a.y1 : b.y1,
+          a.x2 > b.x2 ? a.x2 : b.x2, a.y2 > b.y2 ? a.y2 : b.y2};
+}
+
+RasterRect raster_rect_intersect(const RasterRect &a, const RasterRect &b) {
+  return {a.x1 > b.x1 ? a.x1 : b.x1, a.y1 > b.y1 ? a.y1 : b.y1,
+          a.x2 < b.x2 ? a.x2 : b.x2, a.y2 < b.y2 ? a.y2 : b.y2};
+}
+
+RasterRect raster_polygon_bounds(const RasterPolygon &polygon) {
+  if (polygon.count == 0) {
+    return raster_rect_empty();
+  }
+  int32_t min_x = INT32_MAX, min_y = INT32_MAX;
+  int32_t max_x = INT32_MIN, max_y = INT32_MIN;
+  for (int i = 0; i < polygon.count; i++) {
+    min_x = polygon.x[i] < min_x ? polygon.x[i] : min_x;
+    max_x = polygon.x[i] > max_x ? polygon.x[i] : max_x;
+    min_y = polygon.y[i] < min_y ? polygon.y[i] : min_y;
+    max_y = polygon.y[i] > max_y ? polygon.y[i] : max_y;
+  }
+  return {min_x >> RASTER_FRAC_BITS, min_y >> RASTER_FRAC_BITS,
+          max_x >> RASTER_FRAC_BITS, max_y >> RASTER_FRAC_BITS};
+}
+
+int raster_build_hand(const HandShape &shape, float pivot_x, float pivot_y,
+                      float dx, float dy, RasterPolygon polygons[2]) {
+  // (along axis, across axis) pairs, wound around the outline
+  const float outline[6][2] = {
+      {-shape.tail, -shape.tail_width / 2},
+      {0, -shape.base_width / 2},
+      {shape.length, -shape.tip_width / 2},
+      {shape.length, shape.tip_width / 2},
+      {0, shape.base_width / 2},
+      {-shape.tail, shape.tail_width / 2},
+  };
+
+  RasterPolygon &body = polygons[0];
+  body.count = 6;
+  for (int i = 0; i < 6; i++) {
+    float u = outline[i][0];
+    float v = outline[i][1];
+    body.x[i] = to_fixed(pivot_x + u * dx - v * dy);
+    body.y[i] = to_fixed(pivot_y + u * dy + v * dx);
+  }
+
+  if (shape.counterweight_radius <= 0) {
+    return 1;
+  }
+
+  RasterPolygon &weight = polygons[1];
+  float center_x = pivot_x - shape.counterweight_offset * dx;
+  float center_y = pivot_y - shape.counterweight_offset * dy;
+  weight.count = COUNTERWEIGHT_SEGMENTS;
+  for (int i = 0; i < COUNTERWEIGHT_SEGMENTS; i++) {
+    float a = (float)i * 2.0f * (float)M_PI / COUNTERWEIGHT_SEGMENTS;
+    weight.x[i] = to_fixed(center_x + shape.counterweight_radius * cosf(a));
+    weight.y[i] = to_fixed(center_y + shape.counterweight_radius * sinf(a));
+  }
+  return 2;
+}
+
+void raster_clear(CoverageBuffer *buffer, const RasterRect &clip) {
+  RasterRect bounds = {0, 0, buffer->width - 1, buffer->height - 1};
+  RasterRect area = raster_rect_intersect(clip, bounds);
+  if (raster_rect_is_empty(area)) {
+    return;
+  }
+  auto width = (size_t)(area.x2 - area.x1 + 1);
+  for (int32_t y = area.y1; y <= area.y2; y++) {
+    memset(buffer->data + y * buffer->stride + area.x1, 0, width);
+  }
+}
+
+// Add coverage for the span [start, end) given in 24.8 relative to the clip
+static void accumulate_span(int32_t start, int32_t end, int32_t *min_x,
+                            int32_t *max_x) {
+  int32_t first = start >> RASTER_FRAC_BITS;
+  int32_t last = end >> RASTER_FRAC_BITS;
+  int32_t first_frac = start & (RASTER_ONE - 1);
+  int32_t last_frac = end & (RASTER_ONE - 1);
+
+  if (first == last) {
+    row_accumulator[first] += (uint16_t)(((end - start) * SUBSAMPLE_COVERAGE) >> RASTER_FRAC_BITS);
+  } else {
+    row_accumulator[first] += (uint16_t)(((RASTER_ONE - first_frac) * SUBSAMPLE_COVERAGE) >> RASTER_FRAC_BITS);
+    for (int32_t x = first + 1; x < last; x++) {
+      row_accumulator[x] += SUBSAMPLE_COVERAGE;
+    }
+    if (last_frac) {
+      row_accumulator[last] += (uint16_t)((last_frac * SUBSAMPLE_COVERAGE) >> RASTER_FRAC_BITS);
+    }
+  }
+
+  *min_x = first < *min_x ? first : *min_x;
+  int32_t touched = last_frac ? last : last - 1;
+  *max_x = touched > *max_x ? touched : *max_x;
+}
+
+void raster_fill_polygon(CoverageBuffer *buffer, const RasterPolygon &polygon,
+                         const RasterRect &clip) {
+  RasterRect bounds = {0, 0, buffer->width - 1, buffer->height - 1};
+  RasterRect area = raster_rect_intersect(clip, bounds);
+  area = raster_rect_intersect(area, raster_polygon_bounds(polygon));
+  if (raster_rect_is_empty(area) || polygon.count < 3) {
+    return;
+  }
+  if (area.x2 - area.x1 + 1 > RASTER_MAX_WIDTH) {
+    area.x2 = area.x1 + RASTER_MAX_WIDTH - 1;
+  }
+
+  int32_t clip_left = area.x1 << RASTER_FRAC_BITS;
+  int32_t clip_right = (area.x2 + 1) << RASTER_FRAC_BITS;
+
+  for (int32_t y = area.y1; y <= area.y2; y++) {
+    int32_t min_x = INT32_MAX;
+    int32_t max_x = -1;
+
+    for (int s = 0; s < SUBSAMPLES; s++) {
+      int32_t sample_y = (y << RASTER_FRAC_BITS) +
+                         ((2 * s + 1) << RASTER_FRAC_BITS) / (2 * SUBSAMPLES);
+
+      // Edge crossings on this sub-scanline
+      int32_t crossings[RASTER_MAX_VERTICES];
+      int crossing_count = 0;
+      for (int i = 0; i < polygon.count; i++) {
+        int j = (i + 1) % polygon.count;
+        int32_t y0 = polygon.y[i];
+        int32_t y1 = polygon.y[j];
+        if ((y0 <= sample_y) == (y1 <= sample_y)) {
+          continue;
+        }
+        int32_t x0 = polygon.x[i];
+        int32_t x1 = polygon.x[j];
+        auto x = (int32_t)(x0 + (int64_t)(sample_y - y0) * (x1 - x0) / (y1 - y0));
+
+        // Insertion sort; polygons are small
+        int k = crossing_count++;
+        while (k > 0 && crossings[k - 1] > x) {
+          crossings[k] = crossings[k - 1];
+          k--;
+        }
+        crossings[k] = x;
+      }
+
+      // Even-odd fill between crossing pairs
+      for (int k = 0; k + 1 < crossing_count; k += 2) {
+        int32_t start = crossings[k] > clip_left ? crossings[k] : clip_left;
+        int32_t end = crossings[k + 1] < clip_right ? crossings[k + 1] : clip_right;
+        if (start < end) {
+          accumulate_span(start - clip_left, end - clip_left, &min_x, &max_x);
+        }
+      }
+    }
+
+    uint8_t *row = buffer->data + y * buffer->stride + area.x1;
+    for (int32_t x = min_x; x <= max_x; x++) {
+      uint16_t coverage = row_accumulator[x];
+      auto value = (uint8_t)(coverage > 255 ? 255 : coverage);
+      if (value > row[x]) {
+        row[x] = value;
+      }
+      row_accumulator[x] = 0;
+    }
+  }
+}
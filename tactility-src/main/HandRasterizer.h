@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+
+// Fixed-point scanline polygon rasterizer with coverage anti-aliasing.
+// Renders into an 8-bit coverage (alpha) buffer; the caller decides the color.
+// Vertices use 24.8 fixed point. Each pixel row is sampled on 4 sub-scanlines
+// with exact horizontal coverage at span ends.
+
+constexpr int RASTER_FRAC_BITS = 8;
+constexpr int32_t RASTER_ONE = 1 << RASTER_FRAC_BITS;
+constexpr int RASTER_MAX_VERTICES = 24;
+// Widest clip rectangle supported by the row accumulator. Wider clips are cut
+// to it, so callers keep their buffers within it.
+constexpr int32_t RASTER_MAX_WIDTH = 512;
+
+struct RasterRect {
+  int32_t x1;
+  int32_t y1;
+  int32_t x2; // Inclusive
+  int32_t y2; // Inclusive
+};
+
+struct CoverageBuffer {
+  uint8_t *data;
+  int32_t width;
+  int32_t height;
+  int32_t stride;
+};
+
+struct RasterPolygon {
+  int32_t x[RASTER_MAX_VERTICES]; // 24.8 fixed point
+  int32_t y[RASTER_MAX_VERTICES];
+  int count;
+};
+
+// Hand outline in pixels along the hand axis, measured from the pivot
+struct HandShape {
+  float length;
+  float tail;
+  float tip_width;
+  float base_width;
+  float tail_width;
+  // Disc on the tail, 0 for none
+  float counterweight_radius;
+  float counterweight_offset;
+};
+
+inline bool raster_rect_is_empty(const RasterRect &rect) {
+  return rect.x2 < rect.x1 || rect.y2 < rect.y1;
+}
+
+RasterRect raster_rect_empty();
+
+RasterRect raster_rect_union(const RasterRect &a, const RasterRect &b);
+
+RasterRect raster_rect_intersect(const RasterRect &a, const RasterRect &b);
+
+// Pixel bounds of a polygon, including partially covered edge pixels
+RasterRect raster_polygon_bounds(const RasterPolygon &polygon);
+
+// Build the tapered body (polygons[0]) and, when the shape has one, the
+// counterweight disc (polygons[1]) along the unit direction (dx, dy). Returns
+// the number of polygons written.
+int raster_build_hand(const HandShape &shape, float pivot_x, float pivot_y,
+                      float dx, float dy, RasterPolygon polygons[2]);
+
+void raster_clear(CoverageBuffer *buffer, const RasterRect &clip);
+
+// Accumulate polygon coverage into `buffer` (max-combined), touching only
+// pixels inside `clip`
+void raster_fill_polygon(CoverageBuffer *buffer, const RasterPolygon &polygon,
+                         const RasterRect &clip);
@@ -0,0 +1,46 @@
+#include "HttpFetch.h"
+
+#include <esp_crt_bundle.h>
+#include <esp_log.h>
+
+void http_config_init(esp_http_client_config_t *config, const char *url,
+                      int timeout_ms) {
+  *config = {};
+  config->url = url;
+  config->timeout_ms = timeout_ms;
+  config->crt_bundle_attach = esp_crt_bundle_attach;
+  config->max_redirection_count = HTTP_MAX_REDIRECTS;
+}
+
+static bool is_redirect(int status) {
+  return status == 301 || status == 302 || status == 303 || status == 307 ||
+         status == 308;
+}
+
+int http_open(esp_http_client_handle_t client, const char *tag) {
+  for (int redirects = 0;; redirects++) {
+    esp_err_t err = esp_http_client_open(client, 0);
+    if (err != ESP_OK) {
+      ESP_LOGW(tag, "Connect failed: %s", esp_err_to_name(err));
+      return -1;
+    }
+    if (esp_http_client_fetch_headers(client) < 0) {
+      ESP_LOGW(tag, "No response headers");
+      return -1;
+    }
+    int status = esp_http_client_get_status_code(client);
+    if (!is_redirect(status)) {
+      return status;
+    }
+    if (redirects == HTTP_MAX_REDIRECTS) {
+      ESP_LOGW(tag, "Too many redirects");
+      return status;
+    }
+    // Drop the redirect's body, then reconnect to the Location
+    esp_http_client_flush_response(client, nullptr);
+    if (esp_http_client_set_redirection(client) != ESP_OK) {
+      ESP_LOGW(tag, "Redirect without a location");
+      return status;
+    }
+  }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <esp_http_client.h>
+
+// HTTP client set-up shared by the background services
+
+constexpr int HTTP_MAX_REDIRECTS = 5;
+
+// Config for `url` with HTTPS verified against ESP-IDF's certificate bundle
+void http_config_init(esp_http_client_config_t *config, const char *url,
+                      int timeout_ms);
+
+// Opens a GET and reads the response headers, following redirects (which the
+// streaming API does not do by itself). Headers set on the client are sent
+// again to the new location. Returns the final status, or -1 when connecting
+// or reading the headers failed.
+int http_open(esp_http_client_handle_t client, const char *tag);
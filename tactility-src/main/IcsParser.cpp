@@ -0,0 +1,342 @@
+#include "IcsParser.h"
+
+#include <cstdlib>
+#include <cstring>
+
+constexpr time_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+void calendar_index_clear(CalendarIndex *index) { index->count = 0; }
+
+void calendar_index_insert(CalendarIndex *index, const CalendarEvent &event) {
+  int position = index->count;
+  while (position > 0 && index->events[position - 1].start > event.start) {
+    position--;
+  }
+  if (position == CALENDAR_INDEX_SIZE) {
+    return;
+  }
+  int last = index->count < CALENDAR_INDEX_SIZE ? index->count
+                                                : CALENDAR_INDEX_SIZE - 1;
+  memmove(&index->events[position + 1], &index->events[position],
+          (size_t)(last - position) * sizeof(CalendarEvent));
+  index->events[position] = event;
+  if (index->count < CALENDAR_INDEX_SIZE) {
+    index->count++;
+  }
+}
+
+static bool is_full_before(const CalendarIndex *index, time_t start) {
+  return index->count == CALENDAR_INDEX_SIZE &&
+         index->events[CALENDAR_INDEX_SIZE - 1].start <= start;
+}
+
+const CalendarEvent *calendar_index_next(const CalendarIndex *index,
+                                         time_t now) {
+  for (int i = 0; i < index->count; i++) {
+    const CalendarEvent &event = index->events[i];
+    time_t end = event.all_day ? event.start + SECONDS_PER_DAY : event.start;
+    if (end >= now) {
+      return &event;
+    }
+  }
+  return nullptr;
+}
+
+void ics_parser_init(IcsParser *parser, CalendarIndex *index,
+                     time_t window_start, time_t window_end) {
+  memset(parser, 0, sizeof(*parser));
+  parser->index = index;
+  parser->window_start = window_start;
+  parser->window_end = window_end;
+}
+
+// Days since 1970-01-01 of a proleptic Gregorian date
+static int64_t days_from_civil(int64_t year, int64_t month, int64_t day) {
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t year_of_era = year - era * 400;
+  int64_t day_of_year =
+      (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int64_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+static bool parse_digits(const char *text, int count, int *value) {
+  *value = 0;
+  for (int i = 0; i < count; i++) {
+    if (text[i] < '0' || text[i] > '9') {
+      return false;
+    }
+    *value = *value * 10 + (text[i] - '0');
+  }
+  return true;
+}
+
+// "20261017", "20261017T143000" (local) or "20261017T143000Z" (UTC)
+static bool parse_date_time(const char *text, time_t *out, bool *all_day) {
+  int year, month, day;
+  if (!parse_digits(text, 4, &year) || !parse_digits(text + 4, 2, &month) ||
+      !parse_digits(text + 6, 2, &day)) {
+    return false;
+  }
+  int hour = 0, minute = 0, second = 0;
+  *all_day = text[8] != 'T';
+  if (!*all_day && (!parse_digits(text + 9, 2, &hour) ||
+                    !parse_digits(text + 11, 2, &minute) ||
+                    !parse_digits(text + 13, 2, &second))) {
+    return false;
+  }
+  if (!*all_day && text[15] == 'Z') {
+    *out = (time_t)(days_from_civil(year, month, day) * SECONDS_PER_DAY +
+                    hour * 3600 + minute * 60 + second);
+    return true;
+  }
+  struct tm local = {};
+  local.tm_year = year - 1900;
+  local.tm_mon = month - 1;
+  local.tm_mday = day;
+  local.tm_hour = hour;
+  local.tm_min = minute;
+  local.tm_sec = second;
+  local.tm_isdst = -1;
+  *out = mktime(&local);
+  return *out != (time_t)-1;
+}
+
+static void parse_rule(const char *value, IcsRule *rule) {
+  *rule = {IcsFrequencyNone, 1, 0, 0};
+  while (*value) {
+    const char *end = strchr(value, ';');
+    size_t length = end ? (size_t)(end - value) : strlen(value);
+    if (strncmp(value, "FREQ=", 5) == 0) {
+      const char *frequency = value + 5;
+      if (strncmp(frequency, "DAILY", 5) == 0) {
+        rule->frequency = IcsFrequencyDaily;
+      } else if (strncmp(frequency, "WEEKLY", 6) == 0) {
+        rule->frequency = IcsFrequencyWeekly;
+      } else if (strncmp(frequency, "MONTHLY", 7) == 0) {
+        rule->frequency = IcsFrequencyMonthly;
+      } else if (strncmp(frequency, "YEARLY", 6) == 0) {
+        rule->frequency = IcsFrequencyYearly;
+      }
+    } else if (strncmp(value, "INTERVAL=", 9) == 0) {
+      long interval = strtol(value + 9, nullptr, 10);
+      rule->interval = interval > 0 ? (uint32_t)interval : 1;
+    } else if (strncmp(value, "COUNT=", 6) == 0) {
+      long count = strtol(value + 6, nullptr, 10);
+      rule->count = count > 0 ? (uint32_t)count : 0;
+    } else if (strncmp(value, "UNTIL=", 6) == 0) {
+      bool all_day;
+      if (!parse_date_time(value + 6, &rule->until, &all_day)) {
+        rule->until = 0;
+      } else if (all_day) {
+        // A date-only UNTIL includes that whole day
+        rule->until += SECONDS_PER_DAY - 1;
+      }
+    }
+    value += length;
+    if (*value == ';') {
+      value++;
+    }
+  }
+}
+
+// Copies a TEXT value, undoing RFC 5545 escapes
+static void copy_text(char *out, size_t size, const char *value) {
+  size_t length = 0;
+  for (; *value && length + 1 < size; value++) {
+    char c = *value;
+    if (c == '\\' && value[1]) {
+      value++;
+      c = (*value == 'n' || *value == 'N') ? ' ' : *value;
+    }
+    out[length++] = c;
+  }
+  out[length] = '\0';
+}
+
+// All-day events stay in the window until their day is over
+static bool in_window(const IcsParser *parser, time_t start) {
+  time_t end = parser->event.all_day ? start + SECONDS_PER_DAY : start;
+  return end > parser->window_start && start < parser->window_end;
+}
+
+static void add_occurrence(IcsParser *parser, time_t start) {
+  parser->event.start = start;
+  calendar_index_insert(parser->index, parser->event);
+}
+
+// Walks the rule from the first period that can reach the window, so events
+// created years ago cost no more than new ones
+static void expand_rule(IcsParser *parser) {
+  const IcsRule &rule = parser->rule;
+  struct tm first;
+  localtime_r(&parser->event.start, &first);
+
+  int64_t step_days = 0;
+  int64_t step_months = 0;
+  switch (rule.frequency) {
+  case IcsFrequencyDaily:
+    step_days = rule.interval;
+    break;
+  case IcsFrequencyWeekly:
+    step_days = 7 * (int64_t)rule.interval;
+    break;
+  case IcsFrequencyMonthly:
+    step_months = rule.interval;
+    break;
+  default:
+    step_months = 12 * (int64_t)rule.interval;
+    break;
+  }
+
+  // Periods that end before the window opens are skipped arithmetically
+  int64_t skip = 0;
+  time_t lead = parser->window_start - SECONDS_PER_DAY - parser->event.start;
+  if (lead > 0) {
+    if (step_days) {
+      skip = lead / (step_days * SECONDS_PER_DAY);
+    } else {
+      struct tm window;
+      localtime_r(&parser->window_start, &window);
+      int64_t months = (int64_t)(window.tm_year - first.tm_year) * 12 +
+                       (window.tm_mon - first.tm_mon);
+      skip = months > 0 ? (months - 1) / step_months : 0;
+    }
+  }
+  // COUNT counts occurrences rather than periods, so skipped periods may
+  // only be counted when each has one. Monthly and yearly rules on a day
+  // some months lack walk from the start instead.
+  if (rule.count && step_months && first.tm_mday > 28) {
+    skip = 0;
+  }
+
+  int64_t emitted = skip; // Occurrences before period n
+  for (int64_t n = skip;; n++) {
+    if (rule.count && emitted >= (int64_t)rule.count) {
+      break;
+    }
+    struct tm occurrence = first;
+    occurrence.tm_mday += (int)(n * step_days);
+    occurrence.tm_mon += (int)(n * step_months);
+    occurrence.tm_isdst = -1;
+    time_t start = mktime(&occurrence);
+    if (start == (time_t)-1 || start >= parser->window_end ||
+        (rule.until && start > rule.until) ||
+        is_full_before(parser->index, start)) {
+      break;
+    }
+    // Monthly and yearly rules skip dates that do not exist, e.g. the 31st
+    if (step_months && occurrence.tm_mday != first.tm_mday) {
+      continue;
+    }
+    emitted++;
+    if (in_window(parser, start)) {
+      add_occurrence(parser, start);
+    }
+  }
+}
+
+static void end_event(IcsParser *parser) {
+  parser->events_read++;
+  if (!parser->has_start) {
+    return;
+  }
+  if (parser->rule.frequency != IcsFrequencyNone) {
+    expand_rule(parser);
+  } else if (in_window(parser, parser->event.start)) {
+    add_occurrence(parser, parser->event.start);
+  }
+}
+
+static void process_line(IcsParser *parser) {
+  char *line = parser->line;
+  line[parser->line_length] = '\0';
+
+  if (strncmp(line, "BEGIN:", 6) == 0) {
+    if (parser->in_event) {
+      parser->nested++;
+    } else if (strcmp(line + 6, "VEVENT") == 0) {
+      parser->in_event = true;
+      parser->nested = 0;
+      parser->has_start = false;
+      parser->event = {};
+      parser->rule = {IcsFrequencyNone, 1, 0, 0};
+    }
+    return;
+  }
+  if (!parser->in_event) {
+    return;
+  }
+  if (strncmp(line, "END:", 4) == 0) {
+    if (parser->nested) {
+      parser->nested--;
+    } else {
+      parser->in_event = false;
+      end_event(parser);
+    }
+    return;
+  }
+  if (parser->nested) {
+    return;
+  }
+
+  // NAME[;PARAM=...]:VALUE, where quoted parameter values may contain ':'
+  char *value = nullptr;
+  bool quoted = false;
+  for (char *c = line; *c; c++) {
+    if (*c == '"') {
+      quoted = !quoted;
+    } else if (*c == ':' && !quoted) {
+      *c = '\0';
+      value = c + 1;
+      break;
+    }
+  }
+  if (!value) {
+    return;
+  }
+  char *params = strchr(line, ';');
+  if (params) {
+    *params++ = '\0';
+  }
+
+  if (strcmp(line, "DTSTART") == 0) {
+    parser->has_start =
+        parse_date_time(value, &parser->event.start, &parser->event.all_day);
+  } else if (strcmp(line, "SUMMARY") == 0) {
+    copy_text(parser->event.summary, sizeof(parser->event.summary), value);
+  } else if (strcmp(line, "RRULE") == 0) {
+    parse_rule(value, &parser->rule);
+  }
+}
+
+void ics_parser_feed(IcsParser *parser, const char *data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    char c = data[i];
+    if (parser->line_complete) {
+      parser->line_complete = false;
+      // A leading space or tab continues the previous line
+      if (c == ' ' || c == '\t') {
+        continue;
+      }
+      process_line(parser);
+      parser->line_length = 0;
+    }
+    if (c == '\n') {
+      parser->line_complete = true;
+    } else if (c != '\r' && parser->line_length < ICS_LINE_SIZE - 1) {
+      // Overlong lines (descriptions, attachments) are cut short
+      parser->line[parser->line_length++] = c;
+    }
+  }
+}
+
+void ics_parser_finish(IcsParser *parser) {
+  if (parser->line_length) {
+    process_line(parser);
+    parser->line_length = 0;
+  }
+  parser->line_complete = false;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+// Incremental iCalendar (RFC 5545) reader that keeps only the earliest
+// occurrences inside a time window. Input is fed in chunks of any size and
+// memory use is fixed regardless of calendar size. Plain C++ without ESP-IDF
+// or LVGL dependencies, so it builds on a host.
+//
+// Supported: VEVENT with DTSTART (UTC, floating/TZID treated as local time,
+// or all-day dates), SUMMARY, and RRULE with FREQ, INTERVAL, COUNT and UNTIL.
+// BYxxx parts, EXDATE and RECURRENCE-ID overrides are not applied.
+constexpr int CALENDAR_SUMMARY_SIZE = 40;
+constexpr int CALENDAR_INDEX_SIZE = 16;
+constexpr int ICS_LINE_SIZE = 256;
+
+struct CalendarEvent {
+  time_t start;
+  bool all_day;
+  char summary[CALENDAR_SUMMARY_SIZE];
+};
+
+// Sorted by start time; holds the CALENDAR_INDEX_SIZE earliest occurrences
+struct CalendarIndex {
+  CalendarEvent events[CALENDAR_INDEX_SIZE];
+  int count;
+};
+
+void calendar_index_clear(CalendarIndex *index);
+void calendar_index_insert(CalendarIndex *index, const CalendarEvent &event);
+
+// First event that has not started yet, or an all-day event still running
+const CalendarEvent *calendar_index_next(const CalendarIndex *index,
+                                         time_t now);
+
+enum IcsFrequency : uint8_t {
+  IcsFrequencyNone,
+  IcsFrequencyDaily,
+  IcsFrequencyWeekly,
+  IcsFrequencyMonthly,
+  IcsFrequencyYearly,
+};
+
+struct IcsRule {
+  IcsFrequency frequency;
+  uint32_t interval;
+  uint32_t count; // 0 for no limit
+  time_t until;   // 0 for no limit
+};
+
+struct IcsParser {
+  CalendarIndex *index;
+  time_t window_start;
+  time_t window_end;
+  // The current logical line; folded continuation lines are appended
+  char line[ICS_LINE_SIZE];
+  uint16_t line_length;
+  bool line_complete; // Seen its newline, waiting to rule out a fold
+  // The event being read
+  bool in_event;
+  uint8_t nested; // Components inside the event, e.g. VALARM
+  bool has_start;
+  CalendarEvent event;
+  IcsRule rule;
+  uint32_t events_read;
+};
+
+void ics_parser_init(IcsParser *parser, CalendarIndex *index,
+                     time_t window_start, time_t window_end);
+void ics_parser_feed(IcsParser *parser, const char *data, size_t length);
+
+// Call after the last chunk to process a final unterminated line
+void ics_parser_finish(IcsParser *parser);
@@ -0,0 +1,410 @@
+#include "JsonStream.h"
+
+#include <cstring>
+
+enum JsonState : uint8_t {
+  StateValue,      // A value must follow
+  StateValueOrEnd, // After '['
+  StateKey,        // After ',' in an object
+  StateKeyOrEnd,   // After '{'
+  StateColon,
+  StateAfterValue,
+  StateKeyString,
+  StateValueString,
+  StateEscape,
+  StateUnicode,
+  StateNumber,
+  StateLiteral,
+  StateDone,
+  StateError,
+};
+
+// Number grammar: -? (0 | [1-9][0-9]*) (. [0-9]+)? ([eE] [+-]? [0-9]+)?
+enum NumberPart : uint8_t {
+  NumberSign,         // After '-', a digit must follow
+  NumberZero,         // Leading 0, no more integer digits
+  NumberInteger,
+  NumberPoint,        // After '.', a digit must follow
+  NumberFraction,
+  NumberExponent,     // After 'e', a sign or digit must follow
+  NumberExponentSign, // A digit must follow
+  NumberExponentDigits,
+};
+
+void json_stream_init(JsonStream *stream, JsonValueCallback callback,
+                      void *user_data) {
+  memset(stream, 0, sizeof(*stream));
+  stream->callback = callback;
+  stream->user_data = user_data;
+  stream->state = StateValue;
+  stream->path_overflow_depth = -1;
+}
+
+static bool fail(JsonStream *stream, JsonError error) {
+  stream->state = StateError;
+  stream->error = error;
+  return false;
+}
+
+static bool is_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool in_array(const JsonStream *stream) {
+  return stream->depth > 0 && stream->containers[stream->depth - 1] == '[';
+}
+
+static void append_token(JsonStream *stream, char c) {
+  // Overlong tokens are cut short rather than rejected
+  if (stream->token_length < JSON_MAX_TOKEN - 1) {
+    stream->token[stream->token_length++] = c;
+  }
+}
+
+// Replace the last path segment of the current level
+static void set_segment(JsonStream *stream, const char *segment) {
+  if (stream->path_overflow_depth >= stream->depth) {
+    stream->path_overflow_depth = -1;
+  }
+  uint16_t base = stream->path_bases[stream->depth];
+  size_t separator = base > 0 ? 1 : 0;
+  size_t length = strlen(segment);
+  if (base + separator + length >= JSON_MAX_PATH) {
+    if (stream->path_overflow_depth < 0) {
+      stream->path_overflow_depth = stream->depth;
+    }
+    stream->path_length = base;
+  } else {
+    if (separator) {
+      stream->path[base] = '.';
+    }
+    memcpy(stream->path + base + separator, segment, length);
+    stream->path_length = (uint16_t)(base + separator + length);
+  }
+  stream->path[stream->path_length] = '\0';
+}
+
+// Array elements are addressed by index
+static void begin_value(JsonStream *stream) {
+  if (in_array(stream)) {
+    char index[12];
+    uint32_t value = stream->indices[stream->depth - 1];
+    int length = 0;
+    do {
+      index[length++] = (char)('0' + value % 10);
+      value /= 10;
+    } while (value);
+    for (int i = 0; i < length / 2; i++) {
+      char swap = index[i];
+      index[i] = index[length - 1 - i];
+      index[length - 1 - i] = swap;
+    }
+    index[length] = '\0';
+    set_segment(stream, index);
+  }
+  stream->token_length = 0;
+}
+
+static void end_value(JsonStream *stream) {
+  stream->state = stream->depth == 0 ? StateDone : StateAfterValue;
+}
+
+static void emit(JsonStream *stream, JsonValueType type) {
+  stream->token[stream->token_length] = '\0';
+  if (stream->callback && stream->path_overflow_depth < 0) {
+    stream->callback(stream->path, type, stream->token, stream->user_data);
+  }
+  end_value(stream);
+}
+
+static bool push(JsonStream *stream, char container) {
+  if (stream->depth == JSON_MAX_DEPTH) {
+    return fail(stream, JsonErrorDepth);
+  }
+  stream->containers[stream->depth] = container;
+  stream->indices[stream->depth] = 0;
+  stream->depth++;
+  stream->path_bases[stream->depth] = stream->path_length;
+  stream->state = container == '{' ? StateKeyOrEnd : StateValueOrEnd;
+  return true;
+}
+
+static bool pop(JsonStream *stream, char container) {
+  if (stream->depth == 0 || stream->containers[stream->depth - 1] != container) {
+    return fail(stream, JsonErrorSyntax);
+  }
+  stream->depth--;
+  if (stream->path_overflow_depth > stream->depth) {
+    stream->path_overflow_depth = -1;
+  }
+  end_value(stream);
+  return true;
+}
+
+static bool start_value(JsonStream *stream, char c) {
+  begin_value(stream);
+  if (c == '{' || c == '[') {
+    return push(stream, c);
+  }
+  if (c == '"') {
+    stream->state = StateValueString;
+    return true;
+  }
+  if (c == '-' || (c >= '0' && c <= '9')) {
+    append_token(stream, c);
+    stream->number_part = c == '-'   ? NumberSign
+                          : c == '0' ? NumberZero
+                                     : NumberInteger;
+    stream->state = StateNumber;
+    return true;
+  }
+  if (c == 't' || c == 'f' || c == 'n') {
+    append_token(stream, c);
+    stream->state = StateLiteral;
+    return true;
+  }
+  return fail(stream, JsonErrorSyntax);
+}
+
+static void append_utf8(JsonStream *stream, uint16_t code) {
+  if (code < 0x80) {
+    append_token(stream, (char)code);
+  } else if (code < 0x800) {
+    append_token(stream, (char)(0xC0 | (code >> 6)));
+    append_token(stream, (char)(0x80 | (code & 0x3F)));
+  } else if (code >= 0xD800 && code <= 0xDFFF) {
+    // Surrogate pairs are not combined
+    append_token(stream, '?');
+  } else {
+    append_token(stream, (char)(0xE0 | (code >> 12)));
+    append_token(stream, (char)(0x80 | ((code >> 6) & 0x3F)));
+    append_token(stream, (char)(0x80 | (code & 0x3F)));
+  }
+}
+
+static int hex_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+static bool step(JsonStream *stream, char c);
+
+static bool finish_string(JsonStream *stream, bool is_key) {
+  stream->token[stream->token_length] = '\0';
+  if (is_key) {
+    set_segment(stream, stream->token);
+    stream->token_length = 0;
+    stream->state = StateColon;
+  } else {
+    emit(stream, JsonValueString);
+  }
+  return true;
+}
+
+// Next position in the number grammar after `c`, or -1 when `c` cannot
+// continue the number
+static int number_next(uint8_t part, char c) {
+  bool digit = c >= '0' && c <= '9';
+  bool exponent = c == 'e' || c == 'E';
+  switch (part) {
+  case NumberSign:
+    return c == '0' ? NumberZero : digit ? NumberInteger : -1;
+  case NumberZero:
+    return c == '.' ? NumberPoint : exponent ? NumberExponent : -1;
+  case NumberInteger:
+    return digit      ? NumberInteger
+           : c == '.' ? NumberPoint
+           : exponent ? NumberExponent
+                      : -1;
+  case NumberPoint:
+    return digit ? NumberFraction : -1;
+  case NumberFraction:
+    return digit ? NumberFraction : exponent ? NumberExponent : -1;
+  case NumberExponent:
+    return (c == '+' || c == '-') ? NumberExponentSign
+           : digit                ? NumberExponentDigits
+                                  : -1;
+  case NumberExponentSign:
+  case NumberExponentDigits:
+    return digit ? NumberExponentDigits : -1;
+  default:
+    return -1;
+  }
+}
+
+// A number may end after a digit, but not after '-', '.', 'e' or its sign
+static bool finish_number(JsonStream *stream) {
+  uint8_t part = stream->number_part;
+  if (part != NumberZero && part != NumberInteger && part != NumberFraction &&
+      part != NumberExponentDigits) {
+    return fail(stream, JsonErrorSyntax);
+  }
+  emit(stream, JsonValueNumber);
+  return true;
+}
+
+static bool finish_literal(JsonStream *stream) {
+  stream->token[stream->token_length] = '\0';
+  if (strcmp(stream->token, "true") == 0 ||
+      strcmp(stream->token, "false") == 0) {
+    emit(stream, JsonValueBool);
+  } else if (strcmp(stream->token, "null") == 0) {
+    emit(stream, JsonValueNull);
+  } else {
+    return fail(stream, JsonErrorSyntax);
+  }
+  return true;
+}
+
+static bool step(JsonStream *stream, char c) {
+  switch (stream->state) {
+  case StateValue:
+    return is_space(c) || start_value(stream, c);
+  case StateValueOrEnd:
+    if (is_space(c)) {
+      return true;
+    }
+    return c == ']' ? pop(stream, '[') : start_value(stream, c);
+  case StateKeyOrEnd:
+    if (c == '}') {
+      return pop(stream, '{');
+    }
+    // Fall through
+  case StateKey:
+    if (is_space(c)) {
+      return true;
+    }
+    if (c != '"') {
+      return fail(stream, JsonErrorSyntax);
+    }
+    stream->token_length = 0;
+    stream->state = StateKeyString;
+    return true;
+  case StateColon:
+    if (is_space(c)) {
+      return true;
+    }
+    if (c != ':') {
+      return fail(stream, JsonErrorSyntax);
+    }
+    stream->state = StateValue;
+    return true;
+  case StateAfterValue:
+    if (is_space(c)) {
+      return true;
+    }
+    if (c == ',') {
+      if (in_array(stream)) {
+        stream->indices[stream->depth - 1]++;
+        stream->state = StateValue;
+      } else {
+        stream->state = StateKey;
+      }
+      return true;
+    }
+    if (c == '}' || c == ']') {
+      return pop(stream, c == '}' ? '{' : '[');
+    }
+    return fail(stream, JsonErrorSyntax);
+  case StateKeyString:
+  case StateValueString:
+    if (c == '"') {
+      return finish_string(stream, stream->state == StateKeyString);
+    }
+    if (c == '\\') {
+      stream->resume_state = stream->state;
+      stream->state = StateEscape;
+      return true;
+    }
+    if ((unsigned char)c < 0x20) {
+      return fail(stream, JsonErrorSyntax);
+    }
+    append_token(stream, c);
+    return true;
+  case StateEscape: {
+    const char *escapes = "\"\"\\\\//b\bf\fn\nr\rt\t";
+    for (const char *escape = escapes; *escape; escape += 2) {
+      if (*escape == c) {
+        append_token(stream, escape[1]);
+        stream->state = stream->resume_state;
+        return true;
+      }
+    }
+    if (c != 'u') {
+      return fail(stream, JsonErrorSyntax);
+    }
+    stream->unicode = 0;
+    stream->unicode_digits = 0;
+    stream->state = StateUnicode;
+    return true;
+  }
+  case StateUnicode: {
+    int digit = hex_value(c);
+    if (digit < 0) {
+      return fail(stream, JsonErrorSyntax);
+    }
+    stream->unicode = (uint16_t)((stream->unicode << 4) | digit);
+    if (++stream->unicode_digits == 4) {
+      append_utf8(stream, stream->unicode);
+      stream->state = stream->resume_state;
+    }
+    return true;
+  }
+  case StateNumber: {
+    int next = number_next(stream->number_part, c);
+    if (next >= 0) {
+      stream->number_part = (uint8_t)next;
+      append_token(stream, c);
+      return true;
+    }
+    // Whatever ends the number must be valid after a value: "1-2" fails on
+    // the '-' there
+    return finish_number(stream) && step(stream, c);
+  }
+  case StateLiteral:
+    if (c >= 'a' && c <= 'z') {
+      append_token(stream, c);
+      return true;
+    }
+    return finish_literal(stream) && step(stream, c);
+  case StateDone:
+    return is_space(c) || fail(stream, JsonErrorSyntax);
+  default:
+    return false;
+  }
+}
+
+bool json_stream_feed(JsonStream *stream, const char *data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (!step(stream, data[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool json_stream_finish(JsonStream *stream) {
+  // A top-level number or literal ends with the input
+  if (stream->depth == 0) {
+    if (stream->state == StateNumber) {
+      finish_number(stream);
+    } else if (stream->state == StateLiteral) {
+      finish_literal(stream);
+    }
+  }
+  if (stream->state == StateError) {
+    return false;
+  }
+  if (stream->state != StateDone) {
+    return fail(stream, JsonErrorIncomplete);
+  }
+  return true;
+}
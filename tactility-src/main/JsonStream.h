@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Incremental JSON tokenizer with fixed memory. Input can be fed in chunks of
+// any size (straight from an HTTP read loop) and is never buffered as a
+// whole. Every scalar is reported with its dotted path, e.g.
+// "current.temperature_2m" or "hourly.time.3" for array elements.
+// Plain C++ without ESP-IDF or LVGL dependencies, so it builds on a host.
+constexpr int JSON_MAX_DEPTH = 16;
+constexpr int JSON_MAX_PATH = 96;
+constexpr int JSON_MAX_TOKEN = 64;
+
+enum JsonValueType {
+  JsonValueString,
+  JsonValueNumber,
+  JsonValueBool,
+  JsonValueNull,
+};
+
+enum JsonError {
+  JsonErrorNone = 0,
+  JsonErrorSyntax,
+  JsonErrorDepth,
+  JsonErrorIncomplete,
+};
+
+// `text` is null-terminated and only valid during the call. Strings longer
+// than JSON_MAX_TOKEN - 1 bytes are cut short. Values below keys that do not
+// fit in the path are not reported.
+typedef void (*JsonValueCallback)(const char *path, JsonValueType type,
+                                  const char *text, void *user_data);
+
+struct JsonStream {
+  JsonValueCallback callback;
+  void *user_data;
+  uint8_t state;
+  uint8_t resume_state; // State to return to after a string or escape
+  uint8_t number_part;  // Position in the number grammar
+  int depth;
+  int path_overflow_depth;    // -1 while the path fits
+  char containers[JSON_MAX_DEPTH]; // '{' or '[' per open level
+  uint32_t indices[JSON_MAX_DEPTH];
+  uint16_t path_bases[JSON_MAX_DEPTH + 1];
+  uint16_t path_length;
+  char path[JSON_MAX_PATH];
+  char token[JSON_MAX_TOKEN];
+  uint16_t token_length;
+  uint16_t unicode;
+  uint8_t unicode_digits;
+  JsonError error;
+};
+
+void json_stream_init(JsonStream *stream, JsonValueCallback callback,
+                      void *user_data);
+
+// Returns false once the input is malformed; further input is ignored
+bool json_stream_feed(JsonStream *stream, const char *data, size_t length);
+
+// Call after the last chunk. Returns true when exactly one complete value
+// was parsed.
+bool json_stream_finish(JsonStream *stream);
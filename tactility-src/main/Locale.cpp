@@ -0,0 +1,119 @@
+#include "Locale.h"
+
+#include <cstring>
+
+const LocaleInfo *locale_find(const char *code) {
+  for (int i = 0; i < locale_count; i++) {
+    if (strcmp(locales[i].code, code) == 0) {
+      return &locales[i];
+    }
+  }
+  return nullptr;
+}
+
+const LocaleInfo *locale_default() {
+  const LocaleInfo *english = locale_find("en");
+  return english ? english : &locales[0];
+}
+
+struct FormatBuffer {
+  char *out;
+  size_t size;
+  size_t length;
+};
+
+static void put_text(FormatBuffer *buffer, const char *text) {
+  while (*text && buffer->length + 1 < buffer->size) {
+    buffer->out[buffer->length++] = *text++;
+  }
+}
+
+// Single digits are padded to two with `pad`, or left alone when it is 0
+static void put_number(FormatBuffer *buffer, int value, char pad) {
+  char digits[12];
+  int count = 0;
+  unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+  do {
+    digits[count++] = (char)('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude);
+  if (count == 1 && pad) {
+    digits[count++] = pad;
+  }
+  if (value < 0) {
+    digits[count++] = '-';
+  }
+  while (count > 0 && buffer->length + 1 < buffer->size) {
+    buffer->out[buffer->length++] = digits[--count];
+  }
+}
+
+size_t locale_format(char *out, size_t size, const char *format,
+                     const LocaleInfo *locale, const struct tm &timeinfo) {
+  if (size == 0) {
+    return 0;
+  }
+  FormatBuffer buffer = {out, size, 0};
+  for (; *format && buffer.length + 1 < size; format++) {
+    if (*format != '%' || !format[1]) {
+      out[buffer.length++] = *format;
+      continue;
+    }
+    switch (*++format) {
+    case 'a':
+      put_text(&buffer,
+               locale_string(locale, LocaleWeekdayShort + timeinfo.tm_wday));
+      break;
+    case 'A':
+      put_text(&buffer, locale_string(locale, LocaleWeekday + timeinfo.tm_wday));
+      break;
+    case 'b':
+      put_text(&buffer,
+               locale_string(locale, LocaleMonthShort + timeinfo.tm_mon));
+      break;
+    case 'B':
+      put_text(&buffer, locale_string(locale, LocaleMonth + timeinfo.tm_mon));
+      break;
+    case 'd':
+      put_number(&buffer, timeinfo.tm_mday, '0');
+      break;
+    case 'e':
+      // Unpadded, unlike strftime's space padding, which reads oddly in text
+      put_number(&buffer, timeinfo.tm_mday, 0);
+      break;
+    case 'm':
+      put_number(&buffer, timeinfo.tm_mon + 1, '0');
+      break;
+    case 'y':
+      put_number(&buffer, timeinfo.tm_year % 100, '0');
+      break;
+    case 'Y':
+      put_number(&buffer, timeinfo.tm_year + 1900, 0);
+      break;
+    case 'H':
+      put_number(&buffer, timeinfo.tm_hour, '0');
+      break;
+    case 'I': {
+      int hour = timeinfo.tm_hour % 12;
+      put_number(&buffer, hour == 0 ? 12 : hour, '0');
+      break;
+    }
+    case 'M':
+      put_number(&buffer, timeinfo.tm_min, '0');
+      break;
+    case 'S':
+      put_number(&buffer, timeinfo.tm_sec, '0');
+      break;
+    case 'p':
+      put_text(&buffer,
+               locale_string(locale, timeinfo.tm_hour < 12 ? LocaleAm
+                                                           : LocalePm));
+      break;
+    default:
+      out[buffer.length++] = *format;
+      break;
+    }
+  }
+  out[buffer.length] = '\0';
+  return buffer.length;
+}
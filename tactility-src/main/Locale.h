@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <time.h>
+
+// Day and month names, AM/PM markers and date patterns per locale. The
+// tables are generated at build time from locales/*.json by
+// generate_locales.py (LocaleData.cpp), so only the enabled locales are
+// linked in and nothing goes through newlib's locale machinery.
+enum LocaleString {
+  LocaleWeekday = 0,       // 7 names, Sunday first
+  LocaleWeekdayShort = 7,  // 7 names
+  LocaleMonth = 14,        // 12 names, January first
+  LocaleMonthShort = 26,   // 12 names
+  LocaleAm = 38,
+  LocalePm = 39,
+  // Patterns for locale_format()
+  LocaleDateLong = 40,     // e.g. "Saturday, October 17, 2026"
+  LocaleDateShort = 41,    // e.g. "10/17/2026"
+  LocaleDayMonth = 42,     // e.g. "10/17"
+  LocaleWeekdayDay = 43,   // e.g. "Sat 17"
+  LocaleStringCount = 44,
+};
+
+struct LocaleInfo {
+  const char *code;
+  const char *name;
+  bool is_24_hour;
+  uint16_t strings[LocaleStringCount]; // Offsets into locale_pool
+};
+
+// Generated tables
+extern const char locale_pool[];
+extern const LocaleInfo locales[];
+extern const int locale_count;
+
+// nullptr when `code` is not built in
+const LocaleInfo *locale_find(const char *code);
+
+// English when built in, otherwise the first table entry
+const LocaleInfo *locale_default();
+
+inline const char *locale_string(const LocaleInfo *locale, int id) {
+  return locale_pool + locale->strings[id];
+}
+
+// strftime() subset: %a %A %b %B %d %e %m %y %Y %H %I %M %S %p and %%.
+// Never allocates; output is cut short at `size` - 1 bytes. Returns the
+// length written.
+size_t locale_format(char *out, size_t size, const char *format,
+                     const LocaleInfo *locale, const struct tm &timeinfo);
+
+inline size_t locale_format_pattern(char *out, size_t size,
+                                    const LocaleInfo *locale, int pattern,
+                                    const struct tm &timeinfo) {
+  return locale_format(out, size, locale_string(locale, pattern), locale,
+                       timeinfo);
+}
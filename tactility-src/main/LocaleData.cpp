@@ -0,0 +1,266 @@
+// Generated by generate_locales.py from locales/*.json; do not edit.
+// Locales: en, de, es, fr, it, nl
+
+#include "Locale.h"
+
+const char locale_pool[] =
+    "Sunday" "\0"
+    "Monday" "\0"
+    "Tuesday" "\0"
+    "Wednesday" "\0"
+    "Thursday" "\0"
+    "Friday" "\0"
+    "Saturday" "\0"
+    "Sun" "\0"
+    "Mon" "\0"
+    "Tue" "\0"
+    "Wed" "\0"
+    "Thu" "\0"
+    "Fri" "\0"
+    "Sat" "\0"
+    "January" "\0"
+    "February" "\0"
+    "March" "\0"
+    "April" "\0"
+    "May" "\0"
+    "June" "\0"
+    "July" "\0"
+    "August" "\0"
+    "September" "\0"
+    "October" "\0"
+    "November" "\0"
+    "December" "\0"
+    "Jan" "\0"
+    "Feb" "\0"
+    "Mar" "\0"
+    "Apr" "\0"
+    "Jun" "\0"
+    "Jul" "\0"
+    "Aug" "\0"
+    "Sep" "\0"
+    "Oct" "\0"
+    "Nov" "\0"
+    "Dec" "\0"
+    "AM" "\0"
+    "PM" "\0"
+    "%A, %B %d, %Y" "\0"
+    "%m/%d/%Y" "\0"
+    "%m/%d" "\0"
+    "%a %d" "\0"
+    "Sonntag" "\0"
+    "Montag" "\0"
+    "Dienstag" "\0"
+    "Mittwoch" "\0"
+    "Donnerstag" "\0"
+    "Freitag" "\0"
+    "Samstag" "\0"
+    "So" "\0"
+    "Mo" "\0"
+    "Di" "\0"
+    "Mi" "\0"
+    "Do" "\0"
+    "Fr" "\0"
+    "Sa" "\0"
+    "Januar" "\0"
+    "Februar" "\0"
+    "M\303\244rz" "\0"
+    "Mai" "\0"
+    "Juni" "\0"
+    "Juli" "\0"
+    "Oktober" "\0"
+    "Dezember" "\0"
+    "M\303\244r" "\0"
+    "Okt" "\0"
+    "Dez" "\0"
+    "%A, %e. %B %Y" "\0"
+    "%d.%m.%Y" "\0"
+    "%d.%m." "\0"
+    "%a %e." "\0"
+    "domingo" "\0"
+    "lunes" "\0"
+    "martes" "\0"
+    "mi\303\251rcoles" "\0"
+    "jueves" "\0"
+    "viernes" "\0"
+    "s\303\241bado" "\0"
+    "dom" "\0"
+    "lun" "\0"
+    "mar" "\0"
+    "mi\303\251" "\0"
+    "jue" "\0"
+    "vie" "\0"
+    "s\303\241b" "\0"
+    "enero" "\0"
+    "febrero" "\0"
+    "marzo" "\0"
+    "abril" "\0"
+    "mayo" "\0"
+    "junio" "\0"
+    "julio" "\0"
+    "agosto" "\0"
+    "septiembre" "\0"
+    "octubre" "\0"
+    "noviembre" "\0"
+    "diciembre" "\0"
+    "ene" "\0"
+    "feb" "\0"
+    "abr" "\0"
+    "may" "\0"
+    "jun" "\0"
+    "jul" "\0"
+    "ago" "\0"
+    "sept" "\0"
+    "oct" "\0"
+    "nov" "\0"
+    "dic" "\0"
+    "a. m." "\0"
+    "p. m." "\0"
+    "%A, %e de %B de %Y" "\0"
+    "%d/%m/%Y" "\0"
+    "%d/%m" "\0"
+    "%a %e" "\0"
+    "dimanche" "\0"
+    "lundi" "\0"
+    "mardi" "\0"
+    "mercredi" "\0"
+    "jeudi" "\0"
+    "vendredi" "\0"
+    "samedi" "\0"
+    "dim." "\0"
+    "lun." "\0"
+    "mar." "\0"
+    "mer." "\0"
+    "jeu." "\0"
+    "ven." "\0"
+    "sam." "\0"
+    "janvier" "\0"
+    "f\303\251vrier" "\0"
+    "mars" "\0"
+    "avril" "\0"
+    "mai" "\0"
+    "juin" "\0"
+    "juillet" "\0"
+    "ao\303\273t" "\0"
+    "septembre" "\0"
+    "octobre" "\0"
+    "novembre" "\0"
+    "d\303\251cembre" "\0"
+    "janv." "\0"
+    "f\303\251vr." "\0"
+    "avr." "\0"
+    "juil." "\0"
+    "sept." "\0"
+    "oct." "\0"
+    "nov." "\0"
+    "d\303\251c." "\0"
+    "%A %e %B %Y" "\0"
+    "domenica" "\0"
+    "luned\303\254" "\0"
+    "marted\303\254" "\0"
+    "mercoled\303\254" "\0"
+    "gioved\303\254" "\0"
+    "venerd\303\254" "\0"
+    "sabato" "\0"
+    "mer" "\0"
+    "gio" "\0"
+    "ven" "\0"
+    "sab" "\0"
+    "gennaio" "\0"
+    "febbraio" "\0"
+    "aprile" "\0"
+    "maggio" "\0"
+    "giugno" "\0"
+    "luglio" "\0"
+    "settembre" "\0"
+    "ottobre" "\0"
+    "dicembre" "\0"
+    "gen" "\0"
+    "apr" "\0"
+    "mag" "\0"
+    "giu" "\0"
+    "lug" "\0"
+    "set" "\0"
+    "ott" "\0"
+    "zondag" "\0"
+    "maandag" "\0"
+    "dinsdag" "\0"
+    "woensdag" "\0"
+    "donderdag" "\0"
+    "vrijdag" "\0"
+    "zaterdag" "\0"
+    "zo" "\0"
+    "ma" "\0"
+    "di" "\0"
+    "wo" "\0"
+    "do" "\0"
+    "vr" "\0"
+    "za" "\0"
+    "januari" "\0"
+    "februari" "\0"
+    "maart" "\0"
+    "april" "\0"
+    "mei" "\0"
+    "juni" "\0"
+    "juli" "\0"
+    "augustus" "\0"
+    "september" "\0"
+    "oktober" "\0"
+    "november" "\0"
+    "december" "\0"
+    "jan" "\0"
+    "mrt" "\0"
+    "aug" "\0"
+    "sep" "\0"
+    "okt" "\0"
+    "dec" "\0"
+    "a.m." "\0"
+    "p.m." "\0"
+    "%d-%m-%Y" "\0"
+    "%d-%m" "\0";
+
+const LocaleInfo locales[] = {
+    {"en", "English", false,
+     {0, 7, 14, 22, 32, 41, 48, 57,
+      61, 65, 69, 73, 77, 81, 85, 93,
+      102, 108, 114, 118, 123, 128, 135, 145,
+      153, 162, 171, 175, 179, 183, 114, 187,
+      191, 195, 199, 203, 207, 211, 215, 218,
+      221, 235, 244, 250}},
+    {"de", "Deutsch", true,
+     {256, 264, 271, 280, 289, 300, 308, 316,
+      319, 322, 325, 328, 331, 334, 337, 344,
+      352, 108, 358, 362, 367, 128, 135, 372,
+      153, 380, 171, 175, 389, 183, 358, 187,
+      191, 195, 199, 394, 207, 398, 215, 218,
+      402, 416, 425, 432}},
+    {"es", "Espa\303\261ol", true,
+     {439, 447, 453, 460, 471, 478, 486, 494,
+      498, 502, 506, 511, 515, 519, 524, 530,
+      538, 544, 550, 555, 561, 567, 574, 585,
+      593, 603, 613, 617, 502, 621, 625, 629,
+      633, 637, 641, 646, 650, 654, 658, 664,
+      670, 689, 698, 704}},
+    {"fr", "Fran\303\247ais", true,
+     {710, 719, 725, 731, 740, 746, 755, 762,
+      767, 772, 777, 782, 787, 792, 797, 805,
+      814, 819, 825, 829, 834, 842, 848, 858,
+      866, 875, 885, 891, 814, 898, 825, 829,
+      903, 842, 909, 915, 920, 925, 215, 218,
+      931, 689, 698, 704}},
+    {"it", "Italiano", true,
+     {943, 952, 960, 969, 980, 989, 998, 494,
+      498, 502, 1005, 1009, 1013, 1017, 1021, 1029,
+      538, 1038, 1045, 1052, 1059, 567, 1066, 1076,
+      866, 1084, 1093, 617, 502, 1097, 1101, 1105,
+      1109, 637, 1113, 1117, 650, 654, 215, 218,
+      931, 689, 698, 704}},
+    {"nl", "Nederlands", true,
+     {1121, 1128, 1136, 1144, 1153, 1163, 1171, 1180,
+      1183, 1186, 1189, 1192, 1195, 1198, 1201, 1209,
+      1218, 1224, 1230, 1234, 1239, 1244, 1253, 1263,
+      1271, 1280, 1289, 617, 1293, 1097, 1230, 629,
+      633, 1297, 1301, 1305, 650, 1309, 1313, 1318,
+      931, 1323, 1332, 704}},
+};
+
+const int locale_count = 6;
@@ -0,0 +1,127 @@
+#include "Lttb.h"
+
+#include <cstring>
+
+// Twice the area of the triangle a, b, c
+static int64_t triangle_area(int32_t ax, int32_t ay, int32_t bx, int32_t by,
+                             int64_t cx, int64_t cy) {
+  int64_t area = ((int64_t)ax - cx) * ((int64_t)by - ay) -
+                 ((int64_t)ax - bx) * (cy - ay);
+  return area < 0 ? -area : area;
+}
+
+// Index in [first, last) of the point forming the largest triangle with
+// point (ax, ay) and the average of [next_first, next_last)
+static int select_point(const int32_t *x, const int32_t *y, int first,
+                        int last, int next_first, int next_last, int32_t ax,
+                        int32_t ay) {
+  int64_t sum_x = 0;
+  int64_t sum_y = 0;
+  for (int i = next_first; i < next_last; i++) {
+    sum_x += x[i];
+    sum_y += y[i];
+  }
+  int64_t count = next_last - next_first;
+  int64_t cx = sum_x / count;
+  int64_t cy = sum_y / count;
+
+  int best = first;
+  int64_t best_area = -1;
+  for (int i = first; i < last; i++) {
+    int64_t area = triangle_area(ax, ay, x[i], y[i], cx, cy);
+    if (area > best_area) {
+      best_area = area;
+      best = i;
+    }
+  }
+  return best;
+}
+
+// Classic LTTB of the kept points down to `target`, in place; the first and
+// last points stay
+static void reduce(LttbStream *stream, int target) {
+  int32_t *x = stream->x;
+  int32_t *y = stream->y;
+  int count = stream->count;
+  int buckets = target - 2;
+  int kept = 1;
+  for (int bucket = 0; bucket < buckets; bucket++) {
+    // Buckets split the points between the first and the last evenly
+    int first = 1 + bucket * (count - 2) / buckets;
+    int last = 1 + (bucket + 1) * (count - 2) / buckets;
+    int next_last = bucket + 1 < buckets
+                        ? 1 + (bucket + 2) * (count - 2) / buckets
+                        : count;
+    int index = select_point(x, y, first, last, last, next_last, x[kept - 1],
+                             y[kept - 1]);
+    // Writes stay behind the reads: kept <= first
+    x[kept] = x[index];
+    y[kept] = y[index];
+    kept++;
+  }
+  x[kept] = x[count - 1];
+  y[kept] = y[count - 1];
+  stream->count = kept + 1;
+}
+
+void lttb_stream_init(LttbStream *stream, int capacity) {
+  memset(stream, 0, sizeof(*stream));
+  stream->capacity =
+      capacity < 4 ? 4 : (capacity > LTTB_MAX_CAPACITY ? LTTB_MAX_CAPACITY
+                                                       : capacity);
+  stream->bucket_size = 1;
+}
+
+static void keep(LttbStream *stream, int32_t x, int32_t y) {
+  stream->x[stream->count] = x;
+  stream->y[stream->count] = y;
+  stream->count++;
+  if (stream->count < stream->capacity) {
+    return;
+  }
+  int half = stream->capacity / 2;
+  if (stream->bucket_size * 2 <= LTTB_MAX_BUCKET) {
+    reduce(stream, half);
+    stream->bucket_size *= 2;
+  } else {
+    stream->count -= half;
+    size_t size = (size_t)stream->count * sizeof(int32_t);
+    memmove(stream->x, stream->x + half, size);
+    memmove(stream->y, stream->y + half, size);
+  }
+}
+
+void lttb_stream_add(LttbStream *stream, int32_t x, int32_t y) {
+  stream->total++;
+  if (stream->count == 0) {
+    keep(stream, x, y);
+    return;
+  }
+  stream->pending_x[stream->pending_count] = x;
+  stream->pending_y[stream->pending_count] = y;
+  stream->pending_count++;
+
+  int size = stream->bucket_size;
+  if (stream->pending_count < 2 * size) {
+    return;
+  }
+  // The first pending bucket is decided by the one after it
+  int index = select_point(stream->pending_x, stream->pending_y, 0, size, size,
+                           2 * size, stream->x[stream->count - 1],
+                           stream->y[stream->count - 1]);
+  keep(stream, stream->pending_x[index], stream->pending_y[index]);
+  stream->pending_count -= size;
+  memmove(stream->pending_x, stream->pending_x + size,
+          (size_t)stream->pending_count * sizeof(int32_t));
+  memmove(stream->pending_y, stream->pending_y + size,
+          (size_t)stream->pending_count * sizeof(int32_t));
+}
+
+int lttb_stream_view(LttbStream *stream) {
+  if (stream->pending_count == 0) {
+    return stream->count;
+  }
+  stream->x[stream->count] = stream->pending_x[stream->pending_count - 1];
+  stream->y[stream->count] = stream->pending_y[stream->pending_count - 1];
+  return stream->count + 1;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+// Largest-Triangle-Three-Buckets downsampling of a growing series, in fixed
+// memory. Points arrive in x order and are grouped into buckets of
+// `bucket_size` points; once the bucket after a bucket is complete, the point
+// of the first that forms the largest triangle with the last kept point and
+// the average of the next is kept. When `capacity` points are kept, they are
+// themselves reduced by half with LTTB and the bucket size doubles. Each new
+// point therefore costs O(1) amortized, and the output never exceeds
+// `capacity` + 1 points however long the series grows.
+//
+// Past LTTB_MAX_BUCKET points per bucket the oldest half is dropped instead,
+// so the output then covers only the most recent points.
+constexpr int LTTB_MAX_CAPACITY = 320;
+constexpr int LTTB_MAX_BUCKET = 32;
+
+struct LttbStream {
+  int capacity;
+  int bucket_size;
+  // Kept points, plus room for the newest raw point (see lttb_stream_view)
+  int32_t x[LTTB_MAX_CAPACITY + 1];
+  int32_t y[LTTB_MAX_CAPACITY + 1];
+  int count;
+  int32_t pending_x[2 * LTTB_MAX_BUCKET];
+  int32_t pending_y[2 * LTTB_MAX_BUCKET];
+  int pending_count;
+  uint32_t total;
+};
+
+// `capacity` is typically the chart's width in pixels
+void lttb_stream_init(LttbStream *stream, int capacity);
+
+void lttb_stream_add(LttbStream *stream, int32_t x, int32_t y);
+
+// Number of points in stream->x / stream->y to draw: the kept points and the
+// newest point, so the line always reaches the latest value
+int lttb_stream_view(LttbStream *stream);
@@ -0,0 +1,142 @@
+#include "Metrics.h"
+
+#include "HttpFetch.h"
+#include "MetricsQueue.h"
+#include "ServiceTask.h"
+
+#include <esp_log.h>
+
+#include <cstdio>
+#include <new>
+
+constexpr auto *TAG = "Metrics";
+
+constexpr int HTTP_TIMEOUT_MS = 10000;
+
+// Owned by the push task and freed when it exits
+struct MetricsTask {
+  MetricsConfig config;
+  MetricsPush push;
+};
+
+// Written by the LVGL task only
+static bool enabled = false;
+static uint32_t window_s;
+static MetricsWindow current;
+static uint32_t next_sequence;
+
+// Shared with the push task; kept across restarts
+static MetricsQueue queue;
+
+static ServiceTask worker;
+
+void metrics_record(MetricId metric, int32_t value) {
+  if (enabled) {
+    metrics_window_record(&current, metric, value);
+  }
+}
+
+static void start_window(time_t now) {
+  current = {};
+  current.sequence = next_sequence++;
+  current.start = now;
+}
+
+void metrics_tick(time_t now) {
+  if (!enabled) {
+    return;
+  }
+  if (current.start == 0) {
+    start_window(now);
+    return;
+  }
+  // A clock correction may move time backwards
+  if (now < current.start) {
+    current.start = now;
+    return;
+  }
+  if ((uint32_t)(now - current.start) < window_s) {
+    return;
+  }
+  current.seconds = (uint32_t)(now - current.start);
+  if (metrics_window_has_samples(current) &&
+      metrics_queue_add(&queue, current)) {
+    service_task_wake(&worker);
+  }
+  start_window(now);
+}
+
+static bool post(const char *payload, size_t length, void *user_data) {
+  auto *config = static_cast<const MetricsConfig *>(user_data);
+  // perform() follows redirects by itself
+  esp_http_client_config_t http_config;
+  http_config_init(&http_config, config->url, HTTP_TIMEOUT_MS);
+  http_config.method = HTTP_METHOD_POST;
+  esp_http_client_handle_t client = esp_http_client_init(&http_config);
+  if (!client) {
+    return false;
+  }
+  esp_http_client_set_header(client, "Content-Type", "application/json");
+  esp_http_client_set_post_field(client, payload, (int)length);
+  esp_err_t err = esp_http_client_perform(client);
+  int status = err == ESP_OK ? esp_http_client_get_status_code(client) : 0;
+  esp_http_client_cleanup(client);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Post failed: %s", esp_err_to_name(err));
+  } else if (status < 200 || status >= 300) {
+    ESP_LOGW(TAG, "Collector returned %d", status);
+  }
+  return err == ESP_OK && status >= 200 && status < 300;
+}
+
+static void metrics_task(void *param) {
+  auto *task = static_cast<MetricsTask *>(param);
+  uint32_t delay_s = task->config.push_s;
+  // Woken early by a full batch or by metrics_stop()
+  while (service_task_sleep(&worker, delay_s * 1000)) {
+    delay_s = metrics_push_step(&queue, &task->push, task->config.push_s);
+  }
+  delete task;
+  service_task_exit(&worker);
+}
+
+bool metrics_start(const MetricsConfig &config) {
+  metrics_stop();
+  if (!config.url[0]) {
+    return false;
+  }
+
+  auto *task = new (std::nothrow) MetricsTask();
+  if (!task) {
+    return false;
+  }
+  task->config = config;
+  snprintf(task->push.device_id, sizeof(task->push.device_id), "%s",
+           config.device_id);
+  task->push.post = post;
+  task->push.user_data = &task->config;
+  fetch_schedule_init(&task->push.schedule);
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.backing_off = false;
+  }
+  if (!service_task_start(&worker, metrics_task, "metrics", 4096,
+                          tskIDLE_PRIORITY + 1, tskNO_AFFINITY, task)) {
+    delete task;
+    return false;
+  }
+  window_s = config.window_s;
+  current = {};
+  enabled = true;
+  return true;
+}
+
+void metrics_stop() {
+  enabled = false;
+  // Queued windows are kept for the next start
+  service_task_stop(&worker);
+}
+
+bool metrics_is_enabled() { return enabled; }
+
+MetricsCounters metrics_counters() { return metrics_queue_counters(&queue); }
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+constexpr int METRICS_URL_SIZE = 160;
+constexpr int METRICS_ID_SIZE = 32;
+// Closed windows waiting to be sent; the oldest is dropped when full
+constexpr int METRICS_QUEUE_SIZE = 32;
+// Windows per POST, so the payload buffer stays fixed
+constexpr int METRICS_BATCH_SIZE = 8;
+
+enum MetricId {
+  MetricSyncAge,      // Seconds since the last clock correction
+  MetricDrift,        // Estimated clock drift, ppm
+  MetricRenderCost,   // Microseconds per rendered frame
+  MetricHeapFree,     // Free 8-bit heap bytes
+  MetricHeapLowWater, // Lowest free 8-bit heap since boot
+  MetricQuality,      // Quality governor level, 0 is full
+  MetricCount,
+};
+
+struct MetricsConfig {
+  char url[METRICS_URL_SIZE];
+  char device_id[METRICS_ID_SIZE];
+  uint32_t window_s; // Samples are aggregated per window
+  uint32_t push_s;   // How often queued windows are sent
+};
+
+struct MetricsCounters {
+  uint32_t windows_sent;
+  uint32_t windows_dropped; // Lost to a full queue
+  uint32_t posts_failed;
+};
+
+// Samples are folded into count/min/max/sum per window; only these
+// aggregates are queued and sent, as JSON POSTs from a background task.
+// While the collector is unreachable the task backs off and the queue fills,
+// then the oldest windows are dropped and counted.
+bool metrics_start(const MetricsConfig &config);
+
+// Returns once the push task has exited
+void metrics_stop();
+bool metrics_is_enabled();
+
+// Record and tick from the LVGL task only; recording takes no lock
+void metrics_record(MetricId metric, int32_t value);
+
+// Closes the current window once it is due
+void metrics_tick(time_t now);
+
+MetricsCounters metrics_counters();
@@ -0,0 +1,168 @@
+#include "MetricsQueue.h"
+
+#include <esp_log.h>
+
+#include <cstdarg>
+#include <cstdio>
+
+constexpr auto *TAG = "Metrics";
+
+static const char *const metric_names[MetricCount] = {
+    "sync_age_s", "drift_ppm", "render_us", "heap_free", "heap_low",
+    "quality",
+};
+
+void metrics_window_record(MetricsWindow *window, MetricId metric,
+                           int32_t value) {
+  MetricAggregate &aggregate = window->metrics[metric];
+  if (aggregate.count == 0 || value < aggregate.min) {
+    aggregate.min = value;
+  }
+  if (aggregate.count == 0 || value > aggregate.max) {
+    aggregate.max = value;
+  }
+  aggregate.sum += value;
+  aggregate.count++;
+}
+
+bool metrics_window_has_samples(const MetricsWindow &window) {
+  for (const MetricAggregate &aggregate : window.metrics) {
+    if (aggregate.count) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool metrics_queue_add(MetricsQueue *queue, const MetricsWindow &window) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (queue->count == METRICS_QUEUE_SIZE) {
+    queue->head = (queue->head + 1) % METRICS_QUEUE_SIZE;
+    queue->count--;
+    queue->counters.windows_dropped++;
+  }
+  queue->windows[(queue->head + queue->count) % METRICS_QUEUE_SIZE] = window;
+  queue->count++;
+  // A full batch goes out early, unless the collector is failing
+  return queue->count >= METRICS_BATCH_SIZE && !queue->backing_off;
+}
+
+MetricsCounters metrics_queue_counters(MetricsQueue *queue) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return queue->counters;
+}
+
+static bool append(char *payload, size_t size, size_t *length,
+                   const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(payload + *length, size - *length, format, args);
+  va_end(args);
+  if (written < 0 || (size_t)written >= size - *length) {
+    return false;
+  }
+  *length += (size_t)written;
+  return true;
+}
+
+int metrics_payload_build(char *payload, size_t size, const char *device_id,
+                          const MetricsWindow *batch, int count,
+                          const MetricsCounters &snapshot, size_t *length) {
+  *length = 0;
+  if (!append(payload, size, length,
+              "{\"id\":\"%s\",\"dropped\":%u,\"failed\":%u,\"windows\":[",
+              device_id, (unsigned)snapshot.windows_dropped,
+              (unsigned)snapshot.posts_failed)) {
+    return 0;
+  }
+  // Keep room for the closing "]}"
+  size_t body_size = size - 2;
+  int included = 0;
+  for (; included < count; included++) {
+    const MetricsWindow &window = batch[included];
+    size_t window_start = *length;
+    bool fits = append(payload, body_size, length,
+                       "%s{\"seq\":%u,\"t\":%lld,\"s\":%u",
+                       included ? "," : "", (unsigned)window.sequence,
+                       (long long)window.start, (unsigned)window.seconds);
+    for (int i = 0; fits && i < MetricCount; i++) {
+      const MetricAggregate &aggregate = window.metrics[i];
+      if (aggregate.count) {
+        fits = append(payload, body_size, length, ",\"%s\":[%u,%ld,%ld,%lld]",
+                      metric_names[i], (unsigned)aggregate.count,
+                      (long)aggregate.min, (long)aggregate.max,
+                      (long long)(aggregate.sum / aggregate.count));
+      }
+    }
+    fits = fits && append(payload, body_size, length, "}");
+    if (!fits) {
+      *length = window_start;
+      break;
+    }
+  }
+  if (!append(payload, size, length, "]}")) {
+    return 0;
+  }
+  return included;
+}
+
+bool metrics_push_batch(MetricsQueue *queue, MetricsPush *push, bool *more) {
+  int count;
+  MetricsCounters snapshot;
+  {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    count = queue->count < METRICS_BATCH_SIZE ? queue->count
+                                              : METRICS_BATCH_SIZE;
+    for (int i = 0; i < count; i++) {
+      push->batch[i] =
+          queue->windows[(queue->head + i) % METRICS_QUEUE_SIZE];
+    }
+    snapshot = queue->counters;
+  }
+  *more = false;
+  if (count == 0) {
+    return true;
+  }
+
+  size_t length;
+  int sent = metrics_payload_build(push->payload, sizeof(push->payload),
+                                   push->device_id, push->batch, count,
+                                   snapshot, &length);
+  if (sent == 0) {
+    ESP_LOGE(TAG, "Payload buffer too small");
+    return false;
+  }
+  bool ok = push->post(push->payload, length, push->user_data);
+
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (ok) {
+    // Windows may have been dropped meanwhile; remove by sequence
+    uint32_t last = push->batch[sent - 1].sequence;
+    while (queue->count &&
+           (int32_t)(queue->windows[queue->head].sequence - last) <= 0) {
+      queue->head = (queue->head + 1) % METRICS_QUEUE_SIZE;
+      queue->count--;
+      queue->counters.windows_sent++;
+    }
+    *more = queue->count >= METRICS_BATCH_SIZE;
+  } else {
+    queue->counters.posts_failed++;
+  }
+  return ok;
+}
+
+uint32_t metrics_push_step(MetricsQueue *queue, MetricsPush *push,
+                           uint32_t push_s) {
+  bool more;
+  FetchResult result =
+      metrics_push_batch(queue, push, &more) ? FetchUpdated : FetchFailed;
+  uint32_t delay_s = fetch_schedule_next(&push->schedule, result, push_s);
+  {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->backing_off = push->schedule.backing_off;
+  }
+  if (more && !push->schedule.backing_off) {
+    delay_s = 1;
+  }
+  return delay_s;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "FetchSchedule.h"
+#include "Metrics.h"
+
+#include <cstddef>
+#include <mutex>
+
+// The queue and batching behind Metrics.h: closed windows wait here until
+// the collector accepts them. The LVGL task adds windows and the push task
+// sends them, each under the queue's mutex. Plain C++ without ESP-IDF
+// dependencies, so it builds on a host; the POST itself is a callback.
+constexpr size_t METRICS_PAYLOAD_SIZE = 2560;
+
+struct MetricAggregate {
+  uint32_t count;
+  int32_t min;
+  int32_t max;
+  int64_t sum;
+};
+
+struct MetricsWindow {
+  uint32_t sequence;
+  time_t start;
+  uint32_t seconds;
+  MetricAggregate metrics[MetricCount];
+};
+
+struct MetricsQueue {
+  std::mutex mutex;
+  MetricsWindow windows[METRICS_QUEUE_SIZE];
+  int head;
+  int count;
+  MetricsCounters counters;
+  bool backing_off; // The last push failed
+};
+
+// The push task's side: its buffers and how it posts
+struct MetricsPush {
+  char device_id[METRICS_ID_SIZE];
+  MetricsWindow batch[METRICS_BATCH_SIZE];
+  char payload[METRICS_PAYLOAD_SIZE];
+  // True when the collector accepted the payload
+  bool (*post)(const char *payload, size_t length, void *user_data);
+  void *user_data;
+  FetchSchedule schedule;
+};
+
+void metrics_window_record(MetricsWindow *window, MetricId metric,
+                           int32_t value);
+
+bool metrics_window_has_samples(const MetricsWindow &window);
+
+// Queues a window, dropping the oldest when full. Returns true when a full
+// batch is waiting and the collector is not failing, so the push task should
+// be woken early.
+bool metrics_queue_add(MetricsQueue *queue, const MetricsWindow &window);
+
+MetricsCounters metrics_queue_counters(MetricsQueue *queue);
+
+// {"id":..,"dropped":..,"failed":..,"windows":[{"seq":..,"t":..,"s":..,
+// "render_us":[count,min,max,mean],...},...]}. Returns the number of windows
+// that fit in `size`, 0 when not even the envelope does.
+int metrics_payload_build(char *payload, size_t size, const char *device_id,
+                          const MetricsWindow *batch, int count,
+                          const MetricsCounters &snapshot, size_t *length);
+
+// Posts the oldest queued windows. Windows stay queued until the collector
+// accepts them, so a failed post loses nothing but queue space. Sets `more`
+// when another full batch is waiting.
+bool metrics_push_batch(MetricsQueue *queue, MetricsPush *push, bool *more);
+
+// One push and the seconds until the next: `push_s` after a success, one
+// second while full batches remain, backing off while the collector fails
+uint32_t metrics_push_step(MetricsQueue *queue, MetricsPush *push,
+                           uint32_t push_s);
@@ -0,0 +1,124 @@
+#include "PowerBudget.h"
+#include "ClockFaces.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+constexpr auto *TAG = "PowerBudget";
+
+// LVGL work closer together than this ran in one timer handler pass
+constexpr int64_t SAME_WAKEUP_US = 2000;
+constexpr int64_t REPORT_INTERVAL_US = 60LL * 60 * 1000000;
+constexpr double US_PER_HOUR = 3600e6;
+// Usage slot charged while the display is off
+constexpr int SCREEN_OFF = ClockFaceCount;
+
+static PowerModel model = power_model_default();
+static PowerUsage usage[ClockFaceCount + 1] = {};
+static int current_face = -1;
+static int awake_face = -1;
+static int64_t face_since_us;
+static int64_t last_work_end_us;
+static int64_t last_report_us;
+
+PowerModel power_model_default() {
+  PowerModel power_model;
+  power_model.active_ua = 45000;
+  power_model.idle_ua = 20000;
+  power_model.display_ua = 30000;
+  power_model.wakeup_nc = 2000;
+  power_model.flush_nc_kb = 2500;
+  return power_model;
+}
+
+void power_budget_configure(const PowerModel &power_model) {
+  model = power_model;
+}
+
+static void charge_to(int slot) {
+  int64_t now = esp_timer_get_time();
+  if (current_face >= 0) {
+    usage[current_face].elapsed_us += now - face_since_us;
+  } else if (last_report_us == 0) {
+    last_report_us = now;
+  }
+  current_face = slot;
+  face_since_us = now;
+}
+
+void power_budget_set_face(int face) {
+  charge_to(face >= 0 && face < ClockFaceCount ? face : -1);
+}
+
+void power_budget_set_screen_off(bool off) {
+  if (off && current_face >= 0 && current_face != SCREEN_OFF) {
+    awake_face = current_face;
+    charge_to(SCREEN_OFF);
+  } else if (!off && current_face == SCREEN_OFF) {
+    charge_to(awake_face);
+  }
+}
+
+void power_budget_add_busy(int64_t start_us, int64_t end_us) {
+  if (current_face < 0) {
+    return;
+  }
+  PowerUsage &face_usage = usage[current_face];
+  face_usage.busy_us += end_us - start_us;
+  if (start_us - last_work_end_us > SAME_WAKEUP_US) {
+    face_usage.wakeups++;
+  }
+  last_work_end_us = end_us;
+}
+
+void power_budget_add_flush(uint32_t bytes) {
+  if (current_face >= 0) {
+    usage[current_face].flushed_bytes += bytes;
+  }
+}
+
+const PowerUsage &power_budget_usage(int face) { return usage[face]; }
+
+float power_budget_estimate_mah_per_day(const PowerUsage &face_usage) {
+  if (face_usage.elapsed_us <= 0) {
+    return 0;
+  }
+  auto elapsed = (double)face_usage.elapsed_us;
+  double duty = (double)face_usage.busy_us / elapsed;
+  double average_ua = model.active_ua * duty + model.idle_ua * (1 - duty) +
+                      model.display_ua;
+  // nC per us is mA; times 1000 for uA
+  average_ua += (double)face_usage.wakeups * model.wakeup_nc * 1000 / elapsed;
+  average_ua += (double)face_usage.flushed_bytes / 1024 * model.flush_nc_kb *
+                1000 / elapsed;
+  return (float)(average_ua * 24 / 1000);
+}
+
+void power_budget_report() {
+  // Include the time on the current face so far
+  charge_to(current_face);
+  for (int face = 0; face <= ClockFaceCount; face++) {
+    const PowerUsage &face_usage = usage[face];
+    if (face_usage.elapsed_us < 1000000) {
+      continue;
+    }
+    double hours = (double)face_usage.elapsed_us / US_PER_HOUR;
+    ESP_LOGI(TAG,
+             "%-15s %5.2f h: busy %.0f ms/h, %.0f wakeups/h, %.0f KB/h "
+             "flushed, ~%.0f mAh/day",
+             face == SCREEN_OFF ? "screen off" : clock_faces[face].name,
+             hours,
+             (double)face_usage.busy_us / 1000 / hours,
+             (double)face_usage.wakeups / hours,
+             (double)face_usage.flushed_bytes / 1024 / hours,
+             (double)power_budget_estimate_mah_per_day(face_usage));
+  }
+}
+
+void power_budget_tick() {
+  int64_t now = esp_timer_get_time();
+  if (last_report_us != 0 && now - last_report_us >= REPORT_INTERVAL_US) {
+    last_report_us = now;
+    power_budget_report();
+  }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+// On-device power accounting per clock face. While the app shows, CPU work
+// on the LVGL task (ticks and renders), the wakeups it takes and the bytes
+// flushed to the panel are accumulated for the face on screen. A device power
+// model turns the per-face rates into an estimated mAh/day, logged hourly, so
+// faces and settings can be compared on the hardware they will ship on.
+struct PowerModel {
+  int32_t active_ua;   // CPU busy
+  int32_t idle_ua;     // CPU idle between frames
+  int32_t display_ua;  // Panel and backlight
+  int32_t wakeup_nc;   // Charge per wakeup beyond its busy time
+  int32_t flush_nc_kb; // Charge per KB sent to the panel
+};
+
+struct PowerUsage {
+  int64_t elapsed_us;
+  int64_t busy_us;
+  uint32_t wakeups;
+  uint64_t flushed_bytes;
+};
+
+// Rough figures for an ESP32-S3 driving a small SPI LCD
+PowerModel power_model_default();
+
+void power_budget_configure(const PowerModel &model);
+
+// Charges the time until the next call to the previous face; -1 stops
+void power_budget_set_face(int face);
+
+// While the display is off, time and work are charged to a separate
+// "screen off" entry instead of the face, so the report shows what sleeping
+// costs next to what each face costs awake
+void power_budget_set_screen_off(bool off);
+
+// CPU work between two esp_timer times; work starting shortly after the
+// previous work ended counts as the same wakeup
+void power_budget_add_busy(int64_t start_us, int64_t end_us);
+
+void power_budget_add_flush(uint32_t bytes);
+
+// ClockFaceCount gives the screen off usage
+const PowerUsage &power_budget_usage(int face);
+
+float power_budget_estimate_mah_per_day(const PowerUsage &usage);
+
+// Logs each face's hourly rates and estimate once an hour has passed
+void power_budget_tick();
+
+void power_budget_report();
@@ -0,0 +1,138 @@
+#include "QualityGovernor.h"
+
+#include <lvgl.h>
+
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+constexpr auto *TAG = "QualityGovernor";
+
+// Longer gaps (sleep, clock steps) do not count as time under load
+constexpr uint32_t MAX_TICK_GAP_S = 120;
+
+struct GovernorState {
+  QualityLevel level;
+  time_t last_tick;
+  int64_t render_total_us; // Since the last tick
+  uint32_t render_count;
+  uint32_t loaded_s; // Consecutive time judged loaded
+  uint32_t quiet_s;  // ... and quiet
+  uint32_t changes;
+#if configGENERATE_RUN_TIME_STATS
+  configRUN_TIME_COUNTER_TYPE idle_counter;
+  configRUN_TIME_COUNTER_TYPE total_counter;
+#endif
+};
+
+static GovernorConfig config = governor_config_default();
+static GovernorState state = {};
+
+static const char *const level_names[QualityLevelCount] = {
+    "full", "no antialias", "no seconds", "minutes"};
+
+GovernorConfig governor_config_default() {
+  return {
+    .enabled = true,
+    .render_high_us = 40000,
+    .render_low_us = 15000,
+    .idle_low_pct = 15,
+    .idle_high_pct = 40,
+    .step_down_s = 3,
+    .step_up_s = 30,
+  };
+}
+
+void quality_governor_configure(const GovernorConfig &governor_config) {
+  config = governor_config;
+  quality_governor_reset();
+}
+
+void quality_governor_reset() {
+  uint32_t changes = state.changes;
+  state = {};
+  state.changes = changes;
+}
+
+void quality_governor_add_render(int64_t render_us) {
+  state.render_total_us += render_us;
+  state.render_count++;
+}
+
+// Idle task share of the calling core since the previous call. Without
+// FreeRTOS run time stats, LVGL's own idle estimate stands in.
+static uint32_t idle_percent() {
+#if configGENERATE_RUN_TIME_STATS
+  configRUN_TIME_COUNTER_TYPE idle = ulTaskGetIdleRunTimeCounter();
+  configRUN_TIME_COUNTER_TYPE total = portGET_RUN_TIME_COUNTER_VALUE();
+  configRUN_TIME_COUNTER_TYPE idle_delta = idle - state.idle_counter;
+  configRUN_TIME_COUNTER_TYPE total_delta = total - state.total_counter;
+  bool first = state.total_counter == 0;
+  state.idle_counter = idle;
+  state.total_counter = total;
+  if (first || total_delta == 0) {
+    return 100;
+  }
+  return (uint32_t)(idle_delta * 100 / total_delta);
+#else
+  return lv_timer_get_idle();
+#endif
+}
+
+static void set_level(QualityLevel level, uint32_t render_us,
+                      uint32_t idle) {
+  ESP_LOGI(TAG, "Quality %s -> %s (render %lu us, idle %lu%%), %lu changes",
+           level_names[state.level], level_names[level],
+           (unsigned long)render_us, (unsigned long)idle,
+           (unsigned long)(state.changes + 1));
+  state.level = level;
+  state.changes++;
+  state.loaded_s = 0;
+  state.quiet_s = 0;
+}
+
+bool quality_governor_tick(time_t now) {
+  if (!config.enabled) {
+    return false;
+  }
+  uint32_t idle = idle_percent();
+  uint32_t render_us =
+      state.render_count
+          ? (uint32_t)(state.render_total_us / state.render_count)
+          : 0;
+  bool rendered = state.render_count > 0;
+  state.render_total_us = 0;
+  state.render_count = 0;
+  time_t last_tick = state.last_tick;
+  state.last_tick = now;
+  if (last_tick == 0 || now <= last_tick ||
+      now - last_tick > (time_t)MAX_TICK_GAP_S) {
+    return false;
+  }
+  auto elapsed = (uint32_t)(now - last_tick);
+
+  // Between the thresholds neither count grows, which keeps the level
+  // from flapping
+  bool loaded = (rendered && render_us > config.render_high_us) ||
+                idle < config.idle_low_pct;
+  bool quiet = (!rendered || render_us < config.render_low_us) &&
+               idle > config.idle_high_pct;
+  state.loaded_s = loaded ? state.loaded_s + elapsed : 0;
+  state.quiet_s = quiet ? state.quiet_s + elapsed : 0;
+
+  if (state.loaded_s >= config.step_down_s && state.level < QualityMinutes) {
+    set_level((QualityLevel)(state.level + 1), render_us, idle);
+    return true;
+  }
+  if (state.quiet_s >= config.step_up_s && state.level > QualityFull) {
+    set_level((QualityLevel)(state.level - 1), render_us, idle);
+    return true;
+  }
+  return false;
+}
+
+QualityLevel quality_governor_level() { return state.level; }
+
+const char *quality_level_name(QualityLevel level) {
+  return level_names[level];
+}
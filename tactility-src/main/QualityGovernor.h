@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+// Steps rendering quality down while the device is loaded by other work
+// (Wi-Fi scans, transfers) and back up once it is quiet again. Load is judged
+// from the average LVGL render time and the idle task's share of the LVGL
+// core; levels are cumulative.
+enum QualityLevel {
+  QualityFull = 0,
+  QualityNoAntialias, // Lines and arcs drawn without anti-aliasing
+  QualityNoSeconds,   // Second hands and digits hidden
+  QualityMinutes,     // Clocks only update when the minute changes
+  QualityLevelCount,
+};
+
+struct GovernorConfig {
+  bool enabled;
+  uint32_t render_high_us; // Average render time counted as loaded
+  uint32_t render_low_us;  // ... and as quiet
+  uint32_t idle_low_pct;   // Idle share counted as loaded
+  uint32_t idle_high_pct;  // ... and as quiet
+  uint32_t step_down_s;    // Loaded this long before stepping down
+  uint32_t step_up_s;      // Quiet this long before stepping back up
+};
+
+GovernorConfig governor_config_default();
+
+void quality_governor_configure(const GovernorConfig &config);
+
+// Restarts at full quality
+void quality_governor_reset();
+
+void quality_governor_add_render(int64_t render_us);
+
+// Call on each clock tick. Ticks may be a minute apart at the lowest level,
+// so the load is judged over the time since the previous call. Returns true
+// when the level changed.
+bool quality_governor_tick(time_t now);
+
+QualityLevel quality_governor_level();
+
+const char *quality_level_name(QualityLevel level);
@@ -0,0 +1,318 @@
+#include "RasterHands.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include <cmath>
+
+constexpr auto *TAG = "RasterHands";
+
+// Hour and minute hands, then the second hand, in ClockHand order
+static void hand_shapes(const ClockLayout *layout, HandShape shapes[3]) {
+  auto size = (float)layout->clock_size;
+  shapes[ClockHandHour] = {(float)layout->hour_length, size * 0.06f,
+                           size * 0.012f, size * 0.05f, size * 0.03f, 0, 0};
+  shapes[ClockHandMinute] = {(float)layout->minute_length, size * 0.08f,
+                             size * 0.008f, size * 0.036f, size * 0.02f, 0, 0};
+  shapes[ClockHandSecond] = {(float)layout->second_length, size * 0.16f,
+                             size * 0.004f, size * 0.012f, size * 0.012f,
+                             size * 0.03f, size * 0.12f};
+}
+
+// Farthest any part of the hand gets from the pivot
+static float hand_reach(const HandShape &shape) {
+  float tip = hypotf(shape.length, shape.tip_width / 2);
+  float tail = hypotf(shape.tail, shape.tail_width / 2);
+  float weight = shape.counterweight_radius > 0
+                     ? shape.counterweight_offset + shape.counterweight_radius
+                     : 0;
+  return fmaxf(fmaxf(tip, tail), fmaxf(weight, shape.base_width / 2));
+}
+
+static uint32_t layer_stride(int32_t width) {
+  return lv_draw_buf_width_to_stride((uint32_t)width, LV_COLOR_FORMAT_A8);
+}
+
+static int32_t clamp_width(int32_t width) {
+  return width < RASTER_MAX_WIDTH ? width : RASTER_MAX_WIDTH;
+}
+
+static RasterRect polygons_bounds(const RasterPolygon *polygons, int count) {
+  RasterRect bounds = raster_rect_empty();
+  for (int i = 0; i < count; i++) {
+    bounds = raster_rect_union(bounds, raster_polygon_bounds(polygons[i]));
+  }
+  return bounds;
+}
+
+struct LayerSizes {
+  int32_t hands_side; // Before clamping
+  int32_t seconds_width;
+  uint32_t hands_bytes;
+  uint32_t seconds_bytes;
+};
+
+// The hour/minute layer is a square that holds both hands at any angle; the
+// seconds layer gets the largest of the second hand's 60 bounding boxes
+static LayerSizes layer_sizes(const ClockLayout *layout) {
+  HandShape shapes[3];
+  hand_shapes(layout, shapes);
+  LayerSizes sizes = {};
+
+  float reach = fmaxf(hand_reach(shapes[ClockHandHour]),
+                      hand_reach(shapes[ClockHandMinute]));
+  // A partly covered pixel on either side of the reach, and the pivot's
+  sizes.hands_side = 2 * (int32_t)ceilf(reach) + 3;
+  int32_t side = clamp_width(sizes.hands_side);
+  sizes.hands_bytes = layer_stride(side) * (uint32_t)side;
+
+  for (int second = 0; second < 60; second++) {
+    float radians = ((float)second * 6.0f - 90) * (float)M_PI / 180.0f;
+    RasterPolygon polygons[2];
+    int count = raster_build_hand(
+        shapes[ClockHandSecond], (float)layout->center_x,
+        (float)layout->center_y, cosf(radians), sinf(radians), polygons);
+    RasterRect bounds = polygons_bounds(polygons, count);
+    int32_t width = bounds.x2 - bounds.x1 + 1;
+    int32_t height = bounds.y2 - bounds.y1 + 1;
+    if (width > sizes.seconds_width) {
+      sizes.seconds_width = width;
+    }
+    uint32_t bytes = layer_stride(clamp_width(width)) * (uint32_t)height;
+    if (bytes > sizes.seconds_bytes) {
+      sizes.seconds_bytes = bytes;
+    }
+  }
+  return sizes;
+}
+
+size_t raster_hands_arena_size(const ClockLayout *layout) {
+  LayerSizes sizes = layer_sizes(layout);
+  return (size_t)sizes.hands_bytes + sizes.seconds_bytes +
+         2 * LV_DRAW_BUF_ALIGN;
+}
+
+// Takes the image off the buffer so its memory can be reused
+static void detach_buffer(RasterHandsLayer *layer) {
+  if (!layer->buffer) {
+    return;
+  }
+  lv_image_set_src(layer->image, nullptr);
+  lv_image_cache_drop(layer->buffer);
+  layer->buffer = nullptr;
+}
+
+static void layer_delete_cb(lv_event_t *e) {
+  auto *layer = static_cast<RasterHandsLayer *>(lv_event_get_user_data(e));
+  if (layer->buffer) {
+    lv_image_cache_drop(layer->buffer);
+  }
+  lv_free(layer->heap_block);
+  *layer = {};
+}
+
+// At least `bytes` of layer memory: what the layer has when it is enough,
+// otherwise an arena block when there is room and a heap block when not
+static bool reserve_layer(RasterHandsLayer *layer, uint32_t bytes,
+                          FaceArena *arena) {
+  if (layer->data && bytes <= layer->capacity) {
+    return true;
+  }
+  detach_buffer(layer);
+  lv_free(layer->heap_block);
+  layer->heap_block = nullptr;
+  layer->capacity = 0;
+  layer->data =
+      arena ? face_arena_alloc(arena, bytes, LV_DRAW_BUF_ALIGN) : nullptr;
+  if (!layer->data) {
+    layer->heap_block = lv_malloc(bytes + LV_DRAW_BUF_ALIGN);
+    if (!layer->heap_block) {
+      return false;
+    }
+    layer->data = lv_draw_buf_align(layer->heap_block, LV_COLOR_FORMAT_A8);
+  }
+  layer->capacity = bytes;
+  return true;
+}
+
+// Shows a cleared width x height buffer over the layer's memory
+static void show_buffer(RasterHandsLayer *layer, int32_t width,
+                        int32_t height) {
+  detach_buffer(layer);
+  uint32_t stride = layer_stride(width);
+  lv_draw_buf_init(&layer->draw_buffer, (uint32_t)width, (uint32_t)height,
+                   LV_COLOR_FORMAT_A8, stride, layer->data,
+                   stride * (uint32_t)height);
+  lv_draw_buf_clear(&layer->draw_buffer, nullptr);
+  layer->buffer = &layer->draw_buffer;
+  layer->drawn = raster_rect_empty();
+  lv_image_set_src(layer->image, layer->buffer);
+}
+
+// A8 images are drawn as a mask in the recolor color
+static void create_layer(RasterHandsLayer *layer, lv_obj_t *parent,
+                         lv_color_t color) {
+  layer->image = lv_image_create(parent);
+  lv_obj_set_style_image_recolor(layer->image, color, 0);
+  lv_obj_set_style_image_recolor_opa(layer->image, LV_OPA_COVER, 0);
+  lv_obj_add_event_cb(layer->image, layer_delete_cb, LV_EVENT_DELETE, layer);
+}
+
+static bool setup_layers(RasterHands *hands, const ClockLayout *layout,
+                         FaceArena *arena) {
+  LayerSizes sizes = layer_sizes(layout);
+  if (sizes.hands_side > RASTER_MAX_WIDTH ||
+      sizes.seconds_width > RASTER_MAX_WIDTH) {
+    ESP_LOGW(TAG, "%dpx dial needs %dpx hand layers, clamped to %dpx",
+             (int)layout->clock_size,
+             (int)(sizes.hands_side > sizes.seconds_width
+                       ? sizes.hands_side
+                       : sizes.seconds_width),
+             (int)RASTER_MAX_WIDTH);
+  }
+  if (!reserve_layer(&hands->hands, sizes.hands_bytes, arena) ||
+      !reserve_layer(&hands->seconds, sizes.seconds_bytes, arena)) {
+    return false;
+  }
+  hands->size = layout->clock_size;
+  hands->painted_minute = -1;
+
+  int32_t side = clamp_width(sizes.hands_side);
+  hands->hands.x = layout->center_x - side / 2;
+  hands->hands.y = layout->center_y - side / 2;
+  lv_obj_set_pos(hands->hands.image, hands->hands.x, hands->hands.y);
+  show_buffer(&hands->hands, side, side);
+  // Sized and placed by each paint
+  detach_buffer(&hands->seconds);
+  return true;
+}
+
+bool raster_hands_create(RasterHands *hands, lv_obj_t *parent,
+                         const ClockLayout *layout, FaceArena *arena) {
+  *hands = {};
+  create_layer(&hands->hands, parent, lv_color_hex(0xFFFFFF));
+  create_layer(&hands->seconds, parent, lv_color_hex(0xFF0000));
+  if (!setup_layers(hands, layout, arena)) {
+    ESP_LOGW(TAG, "Not enough memory for %dpx hand layers",
+             (int)layout->clock_size);
+    // Deleting the images frees whatever was allocated
+    lv_obj_delete(hands->hands.image);
+    lv_obj_delete(hands->seconds.image);
+    return false;
+  }
+  return true;
+}
+
+bool raster_hands_resize(RasterHands *hands, const ClockLayout *layout) {
+  if (layout->clock_size == hands->size) {
+    return true;
+  }
+  return setup_layers(hands, layout, nullptr);
+}
+
+// Clear the old hand area, draw the new polygons and invalidate only the union
+static void paint_layer(RasterHandsLayer *layer, const RasterPolygon *polygons,
+                        int count) {
+  if (!layer->buffer) {
+    return;
+  }
+
+  CoverageBuffer coverage = {
+      layer->buffer->data,
+      (int32_t)layer->buffer->header.w,
+      (int32_t)layer->buffer->header.h,
+      (int32_t)layer->buffer->header.stride,
+  };
+
+  RasterRect bounds = polygons_bounds(polygons, count);
+  RasterRect dirty = raster_rect_union(bounds, layer->drawn);
+  dirty = raster_rect_intersect(
+      dirty, {0, 0, coverage.width - 1, coverage.height - 1});
+  if (raster_rect_is_empty(dirty)) {
+    return;
+  }
+
+  raster_clear(&coverage, dirty);
+  for (int i = 0; i < count; i++) {
+    raster_fill_polygon(&coverage, polygons[i], dirty);
+  }
+  layer->drawn = bounds;
+
+  lv_area_t coords;
+  lv_obj_get_coords(layer->image, &coords);
+  lv_area_t area = {coords.x1 + dirty.x1, coords.y1 + dirty.y1,
+                    coords.x1 + dirty.x2, coords.y1 + dirty.y2};
+  lv_obj_invalidate_area(layer->image, &area);
+}
+
+// Cuts the layer to the polygons' bounds and moves it over them; moving the
+// image invalidates both the old and the new area
+static void paint_moving_layer(RasterHandsLayer *layer,
+                               const RasterPolygon *polygons, int count) {
+  if (!layer->data) {
+    return;
+  }
+  RasterRect bounds = polygons_bounds(polygons, count);
+  int32_t width = clamp_width(bounds.x2 - bounds.x1 + 1);
+  int32_t height = bounds.y2 - bounds.y1 + 1;
+  int32_t max_height = (int32_t)(layer->capacity / layer_stride(width));
+  if (height > max_height) {
+    height = max_height;
+  }
+  show_buffer(layer, width, height);
+
+  CoverageBuffer coverage = {layer->buffer->data, width, height,
+                             (int32_t)layer->buffer->header.stride};
+  RasterRect clip = {0, 0, width - 1, height - 1};
+  for (int i = 0; i < count; i++) {
+    RasterPolygon polygon = polygons[i];
+    for (int v = 0; v < polygon.count; v++) {
+      polygon.x[v] -= bounds.x1 * RASTER_ONE;
+      polygon.y[v] -= bounds.y1 * RASTER_ONE;
+    }
+    raster_fill_polygon(&coverage, polygon, clip);
+  }
+  layer->x = bounds.x1;
+  layer->y = bounds.y1;
+  lv_obj_set_pos(layer->image, layer->x, layer->y);
+}
+
+void raster_hands_update(RasterHands *hands, const ClockLayout *layout,
+                         const struct tm &timeinfo,
+                         const ClockHands &clock_hands) {
+  HandShape shapes[3];
+  hand_shapes(layout, shapes);
+
+  int minute_of_day = timeinfo.tm_hour * 60 + timeinfo.tm_min;
+  if (minute_of_day != hands->painted_minute) {
+    // Timed here only: the seconds hand below runs every update
+    int64_t start = esp_timer_get_time();
+    hands->painted_minute = minute_of_day;
+    // Layer pixels
+    auto pivot_x = (float)(layout->center_x - hands->hands.x);
+    auto pivot_y = (float)(layout->center_y - hands->hands.y);
+    RasterPolygon polygons[4];
+    int count = raster_build_hand(
+        shapes[ClockHandHour], pivot_x, pivot_y,
+        clock_hands.cosine[ClockHandHour], clock_hands.sine[ClockHandHour],
+        polygons);
+    count += raster_build_hand(
+        shapes[ClockHandMinute], pivot_x, pivot_y,
+        clock_hands.cosine[ClockHandMinute], clock_hands.sine[ClockHandMinute],
+        polygons + count);
+    paint_layer(&hands->hands, polygons, count);
+    ESP_LOGD(TAG, "Rasterized hands at %dpx in %lld us",
+             (int)layout->clock_size,
+             (long long)(esp_timer_get_time() - start));
+  }
+
+  // Hidden while the quality governor drops seconds
+  if (!lv_obj_has_flag(hands->seconds.image, LV_OBJ_FLAG_HIDDEN)) {
+    RasterPolygon polygons[2];
+    int count = raster_build_hand(
+        shapes[ClockHandSecond], (float)layout->center_x,
+        (float)layout->center_y, clock_hands.cosine[ClockHandSecond],
+        clock_hands.sine[ClockHandSecond], polygons);
+    paint_moving_layer(&hands->seconds, polygons, count);
+  }
+}
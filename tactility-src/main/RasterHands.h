@@ -0,0 +1,54 @@
+#pragma once
+
+#include "ClockLayout.h"
+#include "FaceArena.h"
+#include "HandRasterizer.h"
+
+#include <lvgl.h>
+
+#include <time.h>
+
+// Tapered, counterweighted hands rendered by HandRasterizer into A8 images.
+// Hour and minute hands share one layer, a square around the pivot just large
+// enough for them, that is repainted once a minute; each update clears and
+// redraws only the union of the old and new hand bounds and invalidates just
+// that area. The second hand's layer is cut to the hand's bounding box and
+// moves with it, so it holds a fraction of the dial's pixels.
+struct RasterHandsLayer {
+  lv_obj_t *image;
+  lv_draw_buf_t *buffer; // Points at draw_buffer while there is memory
+  lv_draw_buf_t draw_buffer;
+  RasterRect drawn; // In layer pixels
+  int32_t x;        // Layer position on the dial
+  int32_t y;
+  void *data;
+  uint32_t capacity;
+  void *heap_block; // Behind `data` when the arena had no room
+};
+
+struct RasterHands {
+  RasterHandsLayer hands;
+  RasterHandsLayer seconds;
+  int32_t size;
+  int painted_minute; // -1 forces a repaint of the hour/minute layer
+};
+
+// Arena bytes needed to hold both layers for `layout`'s dial
+size_t raster_hands_arena_size(const ClockLayout *layout);
+
+// Create both layers as children of `parent` (the dial). Layer memory comes
+// from `arena` when it has room and from the heap otherwise; heap blocks are
+// freed when the images are deleted. Layers are capped at RASTER_MAX_WIDTH
+// pixels across, which is logged when a dial needs more. Returns false when
+// the memory cannot be allocated.
+bool raster_hands_create(RasterHands *hands, lv_obj_t *parent,
+                         const ClockLayout *layout, FaceArena *arena);
+
+// Resize the layers for a new dial size, reusing their memory if it fits
+bool raster_hands_resize(RasterHands *hands, const ClockLayout *layout);
+
+// `clock_hands` gives the hand directions; `timeinfo` decides whether the
+// hour/minute layer is due for a repaint
+void raster_hands_update(RasterHands *hands, const ClockLayout *layout,
+                         const struct tm &timeinfo,
+                         const ClockHands &clock_hands);
@@ -0,0 +1,61 @@
+#include "RleDecoder.h"
+
+#include <cstring>
+
+void rle_decoder_init(RleDecoder *decoder, uint8_t *out, size_t size,
+                      uint8_t unit) {
+  *decoder = {};
+  decoder->out = out;
+  decoder->size = size;
+  decoder->unit = unit;
+}
+
+void rle_decode(RleDecoder *decoder, const uint8_t *data, size_t length) {
+  size_t i = 0;
+  while (i < length && !decoder->error) {
+    if (decoder->literal_bytes) {
+      size_t count = decoder->literal_bytes < length - i
+                         ? decoder->literal_bytes
+                         : length - i;
+      if (decoder->position + count > decoder->size) {
+        decoder->error = true;
+        break;
+      }
+      memcpy(decoder->out + decoder->position, data + i, count);
+      decoder->position += count;
+      decoder->literal_bytes -= (uint32_t)count;
+      i += count;
+    } else if (decoder->repeat_count) {
+      decoder->pattern[decoder->pattern_length++] = data[i++];
+      if (decoder->pattern_length < decoder->unit) {
+        continue;
+      }
+      size_t count = (size_t)decoder->repeat_count * decoder->unit;
+      if (decoder->position + count > decoder->size) {
+        decoder->error = true;
+        break;
+      }
+      uint8_t *out = decoder->out + decoder->position;
+      if (decoder->unit == 1) {
+        memset(out, decoder->pattern[0], count);
+      } else {
+        for (size_t offset = 0; offset < count; offset += decoder->unit) {
+          memcpy(out + offset, decoder->pattern, decoder->unit);
+        }
+      }
+      decoder->position += count;
+      decoder->repeat_count = 0;
+      decoder->pattern_length = 0;
+    } else {
+      uint8_t control = data[i++];
+      uint8_t count = control & 0x7F;
+      if (count == 0) {
+        decoder->error = true;
+      } else if (control & 0x80) {
+        decoder->literal_bytes = (uint32_t)count * decoder->unit;
+      } else {
+        decoder->repeat_count = count;
+      }
+    }
+  }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Streaming decoder for the run-length format written by convert_images.py.
+// A control byte n < 0x80 repeats the next unit n times; 0x80 | n is followed
+// by n literal units. Units are 1 to 4 bytes (one pixel of a plane). Input
+// can be fed in chunks of any size and is never held as a whole. Plain C++
+// without ESP-IDF or LVGL dependencies, so it builds on a host.
+struct RleDecoder {
+  uint8_t *out;
+  size_t size;
+  size_t position;
+  uint8_t unit;
+  uint32_t literal_bytes; // Still to copy from the input
+  uint8_t repeat_count;   // Units to write once the pattern is complete
+  uint8_t pattern[4];
+  uint8_t pattern_length;
+  bool error; // Malformed input or output past `size`
+};
+
+void rle_decoder_init(RleDecoder *decoder, uint8_t *out, size_t size,
+                      uint8_t unit);
+
+void rle_decode(RleDecoder *decoder, const uint8_t *data, size_t length);
+
+// True once exactly `size` bytes were written without an error
+inline bool rle_decoder_complete(const RleDecoder *decoder) {
+  return !decoder->error && decoder->position == decoder->size;
+}
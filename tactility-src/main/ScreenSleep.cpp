@@ -0,0 +1,80 @@
+#include "ScreenSleep.h"
+#include "SleepSchedule.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+constexpr auto *TAG = "ScreenSleep";
+
+struct SleepState {
+  lv_display_t *display;
+  lv_timer_t *timer;
+  uint32_t timeout_ms;
+  ScreenSleepCallback callback;
+  bool asleep;
+  int64_t asleep_since_us;
+};
+
+static SleepState state = {};
+
+static void set_asleep(bool asleep) {
+  if (asleep == state.asleep) {
+    return;
+  }
+  state.asleep = asleep;
+  int64_t now = esp_timer_get_time();
+  if (asleep) {
+    state.asleep_since_us = now;
+    ESP_LOGI(TAG, "Display idle, pausing updates");
+  } else {
+    ESP_LOGI(TAG, "Display awake after %lld s",
+             (long long)((now - state.asleep_since_us) / 1000000));
+  }
+  state.callback(asleep);
+}
+
+static void check_timer_cb(lv_timer_t *timer) {
+  SleepCheck check = sleep_schedule_check(
+      state.timeout_ms, lv_display_get_inactive_time(state.display));
+  set_asleep(check.asleep);
+  lv_timer_set_period(timer, check.next_check_ms);
+}
+
+static void indev_pressed_cb(lv_event_t *e) {
+  if (state.asleep) {
+    set_asleep(false);
+    lv_timer_set_period(state.timer, state.timeout_ms);
+    lv_timer_reset(state.timer);
+  }
+}
+
+void screen_sleep_start(lv_display_t *display, uint32_t timeout_ms,
+                        ScreenSleepCallback callback) {
+  screen_sleep_stop();
+  if (timeout_ms == 0) {
+    return;
+  }
+  state.display = display;
+  state.timeout_ms = timeout_ms;
+  state.callback = callback;
+  state.timer = lv_timer_create(check_timer_cb, timeout_ms, nullptr);
+  for (lv_indev_t *indev = lv_indev_get_next(nullptr); indev;
+       indev = lv_indev_get_next(indev)) {
+    lv_indev_add_event_cb(indev, indev_pressed_cb, LV_EVENT_PRESSED, nullptr);
+  }
+}
+
+void screen_sleep_stop() {
+  if (!state.timer) {
+    return;
+  }
+  set_asleep(false);
+  for (lv_indev_t *indev = lv_indev_get_next(nullptr); indev;
+       indev = lv_indev_get_next(indev)) {
+    lv_indev_remove_event_cb_with_user_data(indev, indev_pressed_cb, nullptr);
+  }
+  lv_timer_delete(state.timer);
+  state = {};
+}
+
+bool screen_sleep_is_asleep() { return state.asleep; }
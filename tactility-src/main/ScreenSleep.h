@@ -0,0 +1,21 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <cstdint>
+
+// Follows whether the panel is likely off. Tactility blanks the display after
+// a period without input, which an app is not told about, so the display's
+// inactive time is compared against the same timeout. The check timer only
+// fires when the timeout can next expire, and slowly while asleep; a press
+// on any input device wakes immediately.
+typedef void (*ScreenSleepCallback)(bool asleep);
+
+// A zero timeout never sleeps
+void screen_sleep_start(lv_display_t *display, uint32_t timeout_ms,
+                        ScreenSleepCallback callback);
+
+// Wakes first if asleep
+void screen_sleep_stop();
+
+bool screen_sleep_is_asleep();
@@ -0,0 +1,141 @@
+#include "SegmentDisplay.h"
+
+// Segments a-g map to bits 0-6:
+//    aaa
+//   f   b
+//    ggg
+//   e   c
+//    ddd
+static const uint8_t digit_masks[10] = {
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F,
+};
+
+static lv_obj_t *create_rect(lv_obj_t *parent, lv_color_t color) {
+  // No theme styles: each segment is a single filled rectangle
+  lv_obj_t *rect = lv_obj_create(parent);
+  lv_obj_remove_style_all(rect);
+  lv_obj_set_style_bg_color(rect, color, 0);
+  lv_obj_set_style_bg_opa(rect, LV_OPA_COVER, 0);
+  lv_obj_clear_flag(rect, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_flag(rect, LV_OBJ_FLAG_HIDDEN);
+  return rect;
+}
+
+void segment_display_create(SegmentDisplay *display, lv_obj_t *parent,
+                            lv_color_t color) {
+  *display = {};
+  display->shown_time = -1;
+
+  lv_obj_t *panel = lv_obj_create(parent);
+  display->panel = panel;
+  lv_obj_remove_style_all(panel);
+  lv_obj_clear_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+  // Let presses reach the container so the carousel can be swiped
+  lv_obj_clear_flag(panel, LV_OBJ_FLAG_CLICKABLE);
+
+  for (auto &digit : display->segments) {
+    for (auto &segment : digit) {
+      segment = create_rect(panel, color);
+    }
+  }
+  for (auto &dot : display->colon) {
+    dot = create_rect(panel, color);
+    lv_obj_clear_flag(dot, LV_OBJ_FLAG_HIDDEN);
+  }
+}
+
+static void place_digit(lv_obj_t *const *segments, lv_coord_t x,
+                        const ClockLayout *layout) {
+  lv_coord_t w = layout->segment_digit_width;
+  lv_coord_t h = layout->segment_digit_height;
+  lv_coord_t t = layout->segment_thickness;
+  // Leave a hairline between segments so the digit reads as segmented
+  lv_coord_t inset = LV_MAX(t / 6, 1);
+  lv_coord_t bar_length = w - 2 * t;
+  lv_coord_t post_length = (h - 3 * t) / 2;
+  lv_coord_t middle_y = (h - t) / 2;
+
+  struct Rect {
+    lv_coord_t x, y, w, h;
+  };
+  const Rect rects[SEGMENT_COUNT] = {
+      {t, 0, bar_length, t},                        // a
+      {w - t, t, t, post_length},                   // b
+      {w - t, middle_y + t, t, post_length},        // c
+      {t, h - t, bar_length, t},                    // d
+      {0, middle_y + t, t, post_length},            // e
+      {0, t, t, post_length},                       // f
+      {t, middle_y, bar_length, t},                 // g
+  };
+
+  for (int i = 0; i < SEGMENT_COUNT; i++) {
+    const Rect &rect = rects[i];
+    bool horizontal = rect.w > rect.h;
+    lv_coord_t dx = horizontal ? inset : 0;
+    lv_coord_t dy = horizontal ? 0 : inset;
+    lv_obj_set_pos(segments[i], x + rect.x + dx, rect.y + dy);
+    lv_obj_set_size(segments[i], rect.w - 2 * dx, rect.h - 2 * dy);
+    lv_obj_set_style_radius(segments[i], t / 2, 0);
+  }
+}
+
+void segment_display_apply_layout(SegmentDisplay *display,
+                                  const ClockLayout *layout) {
+  lv_coord_t w = layout->segment_digit_width;
+  lv_coord_t h = layout->segment_digit_height;
+  lv_coord_t t = layout->segment_thickness;
+  lv_coord_t gap = layout->segment_digit_gap;
+  lv_coord_t colon = layout->segment_colon_width;
+
+  lv_coord_t x = 0;
+  for (int i = 0; i < SEGMENT_DIGIT_COUNT; i++) {
+    place_digit(display->segments[i], x, layout);
+    x += w + gap;
+    if (i == 1) {
+      lv_coord_t dot_x = x - gap + (gap + colon - t) / 2;
+      lv_obj_set_pos(display->colon[0], dot_x, h / 3 - t / 2);
+      lv_obj_set_pos(display->colon[1], dot_x, 2 * h / 3 - t / 2);
+      for (auto *dot : display->colon) {
+        lv_obj_set_size(dot, t, t);
+        lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
+      }
+      x += colon;
+    }
+  }
+
+  lv_obj_set_size(display->panel, x - gap, h);
+}
+
+void segment_display_set_time(SegmentDisplay *display, int hour, int minute,
+                              bool blank_leading_zero) {
+  int time = hour * 60 + minute;
+  if (time == display->shown_time) {
+    return;
+  }
+  display->shown_time = time;
+
+  uint8_t masks[SEGMENT_DIGIT_COUNT] = {
+      digit_masks[hour / 10],
+      digit_masks[hour % 10],
+      digit_masks[minute / 10],
+      digit_masks[minute % 10],
+  };
+  if (blank_leading_zero && hour < 10) {
+    masks[0] = 0;
+  }
+
+  for (int i = 0; i < SEGMENT_DIGIT_COUNT; i++) {
+    uint8_t changed = masks[i] ^ display->lit[i];
+    for (int segment = 0; changed; segment++, changed >>= 1) {
+      if (!(changed & 1)) {
+        continue;
+      }
+      if (masks[i] & (1 << segment)) {
+        lv_obj_clear_flag(display->segments[i][segment], LV_OBJ_FLAG_HIDDEN);
+      } else {
+        lv_obj_add_flag(display->segments[i][segment], LV_OBJ_FLAG_HIDDEN);
+      }
+    }
+    display->lit[i] = masks[i];
+  }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ClockLayout.h"
+
+#include <lvgl.h>
+
+#include <cstdint>
+
+constexpr int SEGMENT_DIGIT_COUNT = 4;
+constexpr int SEGMENT_COUNT = 7;
+
+// Large "HH:MM" seven-segment readout built from plain filled rectangles.
+// Every segment is its own unstyled object; unlit segments are hidden. A time
+// change only toggles the segments whose state differs, so LVGL re-flushes
+// just those rectangles, and nothing happens between minutes.
+struct SegmentDisplay {
+  lv_obj_t *panel;
+  lv_obj_t *segments[SEGMENT_DIGIT_COUNT][SEGMENT_COUNT];
+  lv_obj_t *colon[2];
+  uint8_t lit[SEGMENT_DIGIT_COUNT]; // Bit n set when segment n is shown
+  int shown_time;                   // hour * 60 + minute, -1 when blank
+};
+
+void segment_display_create(SegmentDisplay *display, lv_obj_t *parent,
+                            lv_color_t color);
+
+void segment_display_apply_layout(SegmentDisplay *display,
+                                  const ClockLayout *layout);
+
+// `hour` is already in the 12 or 24 hour range to show. With
+// `blank_leading_zero` a single digit hour leaves the first digit dark.
+void segment_display_set_time(SegmentDisplay *display, int hour, int minute,
+                              bool blank_leading_zero);
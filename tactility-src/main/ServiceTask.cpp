@@ -0,0 +1,67 @@
+#include "ServiceTask.h"
+
+#include <esp_log.h>
+
+constexpr auto *TAG = "ServiceTask";
+
+bool service_task_start(ServiceTask *service, TaskFunction_t function,
+                        const char *name, uint32_t stack_size,
+                        UBaseType_t priority, BaseType_t core, void *param) {
+  service_task_stop(service);
+  if (!service->wake) {
+    service->wake = xSemaphoreCreateBinary();
+  }
+  if (!service->exited) {
+    service->exited = xSemaphoreCreateBinary();
+  }
+  if (!service->wake || !service->exited) {
+    return false;
+  }
+  // A wake left over from the previous worker
+  xSemaphoreTake(service->wake, 0);
+  service->stop = false;
+  if (xTaskCreatePinnedToCore(function, name, stack_size, param, priority,
+                              &service->handle, core) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to start %s", name);
+    service->handle = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void service_task_stop(ServiceTask *service) {
+  if (!service->handle) {
+    return;
+  }
+  service->stop = true;
+  xSemaphoreGive(service->wake);
+  xSemaphoreTake(service->exited, portMAX_DELAY);
+  // Suspended in service_task_exit(), or about to be
+  vTaskDelete(service->handle);
+  service->handle = nullptr;
+}
+
+bool service_task_is_running(const ServiceTask *service) {
+  return service->handle != nullptr;
+}
+
+void service_task_wake(ServiceTask *service) {
+  if (service->handle) {
+    xSemaphoreGive(service->wake);
+  }
+}
+
+bool service_task_sleep(ServiceTask *service, uint32_t ms) {
+  if (!service->stop) {
+    TickType_t ticks = pdMS_TO_TICKS(ms);
+    xSemaphoreTake(service->wake, ticks > 0 ? ticks : 1);
+  }
+  return !service->stop;
+}
+
+void service_task_exit(ServiceTask *service) {
+  xSemaphoreGive(service->exited);
+  // The stopping task deletes this one; it must not return into code that
+  // may be unloaded with the app
+  vTaskSuspend(nullptr);
+}
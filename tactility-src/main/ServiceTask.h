@@ -0,0 +1,43 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstdint>
+
+// Lifecycle of a background worker (the weather, calendar and metrics
+// services). Stopping waits for the worker to exit, so a new one never runs
+// alongside it and nothing outlives the app. The worker sleeps on a
+// semaphore owned here rather than a task notification, so waking it never
+// touches a task that may already be gone.
+struct ServiceTask {
+  SemaphoreHandle_t wake;
+  SemaphoreHandle_t exited;
+  TaskHandle_t handle;
+  std::atomic<bool> stop;
+};
+
+// Stops any previous worker, then runs `function(param)` in a new task.
+// `core` is tskNO_AFFINITY or a core to pin it to.
+bool service_task_start(ServiceTask *service, TaskFunction_t function,
+                        const char *name, uint32_t stack_size,
+                        UBaseType_t priority, BaseType_t core, void *param);
+
+// Asks the worker to stop, wakes it and waits until it has exited. A request
+// in flight is abandoned at its next read or when it times out.
+void service_task_stop(ServiceTask *service);
+
+bool service_task_is_running(const ServiceTask *service);
+
+// Wakes the worker early, e.g. when work is queued
+void service_task_wake(ServiceTask *service);
+
+// Worker side: sleeps up to `ms` or until woken. Returns false once the
+// worker should stop.
+bool service_task_sleep(ServiceTask *service, uint32_t ms);
+
+// Worker side: the last call. Lets service_task_stop() return and waits to
+// be deleted.
+void service_task_exit(ServiceTask *service);
@@ -0,0 +1,8 @@
+#include "SleepSchedule.h"
+
+SleepCheck sleep_schedule_check(uint32_t timeout_ms, uint32_t inactive_ms) {
+  if (inactive_ms < timeout_ms) {
+    return {false, timeout_ms - inactive_ms};
+  }
+  return {true, SLEEP_POLL_MS};
+}
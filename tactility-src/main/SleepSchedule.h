@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+// When ScreenSleep next looks at the display's inactive time, and what it
+// concludes. Plain C++ without LVGL, so it builds on a host.
+
+// While asleep: a fallback for input that does not go through an LVGL input
+// device (presses on one wake at once)
+constexpr uint32_t SLEEP_POLL_MS = 5000;
+
+struct SleepCheck {
+  bool asleep;
+  uint32_t next_check_ms;
+};
+
+// The panel is taken to be off once it has been inactive for `timeout_ms`.
+// Awake, the next check is when that could first happen.
+SleepCheck sleep_schedule_check(uint32_t timeout_ms, uint32_t inactive_ms);
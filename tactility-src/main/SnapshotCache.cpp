@@ -0,0 +1,161 @@
+#include "SnapshotCache.h"
+
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+
+constexpr auto *TAG = "SnapshotCache";
+
+constexpr int MAX_ENTRIES = 8;
+constexpr size_t DEFAULT_BUDGET_INTERNAL = 160 * 1024;
+constexpr size_t DEFAULT_BUDGET_PSRAM = 2 * 1024 * 1024;
+
+struct CacheEntry {
+  lv_draw_buf_t *buffer;
+  int key;
+  uint32_t stamp;
+  uint32_t last_used;
+  uint16_t pins;
+  bool orphaned; // Cleared while pinned, destroy on release
+};
+
+static CacheEntry entries[MAX_ENTRIES] = {};
+static size_t budget = DEFAULT_BUDGET_INTERNAL;
+static size_t used = 0;
+static uint32_t use_counter = 0;
+
+static size_t buffer_size(const lv_draw_buf_t *buffer) {
+  return buffer->data_size;
+}
+
+static void destroy_entry(CacheEntry *entry) {
+  used -= buffer_size(entry->buffer);
+  lv_image_cache_drop(entry->buffer);
+  lv_draw_buf_destroy(entry->buffer);
+  *entry = {};
+}
+
+static CacheEntry *find_entry(int key) {
+  for (auto &entry : entries) {
+    if (entry.buffer && !entry.orphaned && entry.key == key) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+static bool evict_one() {
+  CacheEntry *victim = nullptr;
+  for (auto &entry : entries) {
+    if (entry.buffer && entry.pins == 0 &&
+        (!victim || entry.last_used < victim->last_used)) {
+      victim = &entry;
+    }
+  }
+  if (!victim) {
+    return false;
+  }
+  ESP_LOGD(TAG, "Evicting face %d", victim->key);
+  destroy_entry(victim);
+  return true;
+}
+
+size_t snapshot_cache_default_budget() {
+  if (heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0) {
+    return DEFAULT_BUDGET_PSRAM;
+  }
+  return DEFAULT_BUDGET_INTERNAL;
+}
+
+void snapshot_cache_set_budget(size_t budget_bytes) {
+  budget = budget_bytes;
+  while (used > budget && evict_one()) {
+  }
+}
+
+size_t snapshot_cache_get_used() { return used; }
+
+lv_draw_buf_t *snapshot_cache_acquire(int key, uint32_t stamp) {
+  CacheEntry *entry = find_entry(key);
+  if (!entry) {
+    return nullptr;
+  }
+  if (entry->stamp != stamp) {
+    if (entry->pins == 0) {
+      destroy_entry(entry);
+    }
+    return nullptr;
+  }
+  entry->pins++;
+  entry->last_used = ++use_counter;
+  return entry->buffer;
+}
+
+void snapshot_cache_release(lv_draw_buf_t *buffer) {
+  for (auto &entry : entries) {
+    if (entry.buffer == buffer && entry.pins > 0) {
+      entry.pins--;
+      if (entry.pins == 0 && (entry.orphaned || used > budget)) {
+        destroy_entry(&entry);
+      }
+      return;
+    }
+  }
+}
+
+bool snapshot_cache_contains(int key, uint32_t stamp) {
+  CacheEntry *entry = find_entry(key);
+  return entry && entry->stamp == stamp;
+}
+
+bool snapshot_cache_put(int key, uint32_t stamp, lv_draw_buf_t *buffer) {
+  size_t size = buffer_size(buffer);
+
+  CacheEntry *existing = find_entry(key);
+  if (existing) {
+    if (existing->pins > 0) {
+      existing->orphaned = true;
+    } else {
+      destroy_entry(existing);
+    }
+  }
+
+  while (used + size > budget) {
+    if (!evict_one()) {
+      ESP_LOGD(TAG, "Face %d (%u bytes) does not fit the budget", key,
+               (unsigned)size);
+      lv_draw_buf_destroy(buffer);
+      return false;
+    }
+  }
+
+  for (auto &entry : entries) {
+    if (!entry.buffer) {
+      entry.buffer = buffer;
+      entry.key = key;
+      entry.stamp = stamp;
+      entry.last_used = ++use_counter;
+      used += size;
+      return true;
+    }
+  }
+
+  // All slots taken: recycle the least recently used one
+  if (evict_one()) {
+    return snapshot_cache_put(key, stamp, buffer);
+  }
+  lv_draw_buf_destroy(buffer);
+  return false;
+}
+
+void snapshot_cache_clear() {
+  for (auto &entry : entries) {
+    if (!entry.buffer) {
+      continue;
+    }
+    if (entry.pins > 0) {
+      entry.orphaned = true;
+    } else {
+      destroy_entry(&entry);
+    }
+  }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// LRU cache of pre-rendered face snapshots bounded by a byte budget.
+// Entries are keyed by face index and carry a caller-defined stamp (e.g. the
+// minute they were rendered in); a lookup with a different stamp is a miss.
+// The cache owns every buffer put into it.
+
+// Default budget: generous when PSRAM is available, a couple of screens otherwise
+size_t snapshot_cache_default_budget();
+
+void snapshot_cache_set_budget(size_t budget_bytes);
+
+size_t snapshot_cache_get_used();
+
+// Returns a pinned buffer (not evictable until released) or nullptr on miss
+lv_draw_buf_t *snapshot_cache_acquire(int key, uint32_t stamp);
+
+void snapshot_cache_release(lv_draw_buf_t *buffer);
+
+// Takes ownership of `buffer`. Evicts least recently used unpinned entries
+// until it fits; when it cannot fit the buffer is destroyed and false returned.
+bool snapshot_cache_put(int key, uint32_t stamp, lv_draw_buf_t *buffer);
+
+bool snapshot_cache_contains(int key, uint32_t stamp);
+
+// Destroys all unpinned entries; pinned entries are dropped once released
+void snapshot_cache_clear();
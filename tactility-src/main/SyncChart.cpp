@@ -0,0 +1,176 @@
+#include "SyncChart.h"
+#include "Lttb.h"
+
+#include <esp_log.h>
+
+constexpr auto *TAG = "SyncChart";
+
+// Larger corrections set the clock from nothing rather than correct drift
+constexpr int64_t MAX_PLOTTED_STEP_US = 60LL * 1000000;
+constexpr uint32_t OFFSET_COLOR = 0x007BFF;
+constexpr uint32_t DRIFT_COLOR = 0xFF9500;
+
+struct ChartSeries {
+  LttbStream offset; // ms
+  LttbStream drift;  // ppm
+};
+
+struct ChartState {
+  lv_obj_t *overlay;
+  lv_obj_t *chart;
+  lv_obj_t *caption;
+  lv_chart_series_t *offset_series;
+  lv_chart_series_t *drift_series;
+  ChartSeries *series; // Heap, only while open
+  int64_t first_time;  // x is seconds since the first record
+  uint32_t sync_count;
+};
+
+static ChartState state = {};
+
+static void add_record(const SyncRecord &record) {
+  if (state.sync_count++ == 0) {
+    state.first_time = record.time;
+  }
+  auto x = (int32_t)(record.time - state.first_time);
+  if (record.offset_us > -MAX_PLOTTED_STEP_US &&
+      record.offset_us < MAX_PLOTTED_STEP_US) {
+    lttb_stream_add(&state.series->offset, x,
+                    (int32_t)(record.offset_us / 1000));
+  }
+  if (record.drift_ppb != 0) {
+    lttb_stream_add(&state.series->drift, x, record.drift_ppb / 1000);
+  }
+}
+
+static bool read_record(const SyncRecord &record, void *user_data) {
+  add_record(record);
+  return true;
+}
+
+// Pads `stream` past `from` so both series have `count` points
+static void pad_series(LttbStream *stream, int from, int count) {
+  for (int i = from; i < count; i++) {
+    stream->x[i] = 0;
+    stream->y[i] = LV_CHART_POINT_NONE;
+  }
+}
+
+static void set_axis_range(lv_chart_axis_t axis, const LttbStream *stream,
+                           int count) {
+  int32_t low = 0;
+  int32_t high = 0;
+  for (int i = 0; i < count; i++) {
+    low = LV_MIN(low, stream->y[i]);
+    high = LV_MAX(high, stream->y[i]);
+  }
+  // Keep flat lines off the edges
+  int32_t margin = LV_MAX((high - low) / 10, 1);
+  lv_chart_set_range(state.chart, axis, low - margin, high + margin);
+}
+
+// Cost depends on the chart's width only, not on the history length
+static void refresh() {
+  LttbStream *offset = &state.series->offset;
+  LttbStream *drift = &state.series->drift;
+  int offset_count = lttb_stream_view(offset);
+  int drift_count = lttb_stream_view(drift);
+  int count = LV_MAX(offset_count, drift_count);
+
+  set_axis_range(LV_CHART_AXIS_PRIMARY_Y, offset, offset_count);
+  set_axis_range(LV_CHART_AXIS_SECONDARY_Y, drift, drift_count);
+  int32_t last_x = LV_MAX(offset_count ? offset->x[offset_count - 1] : 0,
+                          drift_count ? drift->x[drift_count - 1] : 0);
+  lv_chart_set_range(state.chart, LV_CHART_AXIS_PRIMARY_X, 0,
+                     LV_MAX(last_x, 1));
+  pad_series(offset, offset_count, count);
+  pad_series(drift, drift_count, count);
+
+  lv_chart_set_point_count(state.chart, (uint32_t)count);
+  lv_chart_set_ext_x_array(state.chart, state.offset_series, offset->x);
+  lv_chart_set_ext_y_array(state.chart, state.offset_series, offset->y);
+  lv_chart_set_ext_x_array(state.chart, state.drift_series, drift->x);
+  lv_chart_set_ext_y_array(state.chart, state.drift_series, drift->y);
+  lv_chart_refresh(state.chart);
+
+  lv_label_set_text_fmt(state.caption,
+                        "%lu syncs - offset ms (blue), drift ppm (orange)",
+                        (unsigned long)state.sync_count);
+}
+
+static void close_cb(lv_event_t *e) {
+  // Deleting from the object's own event
+  lv_obj_delete_async(state.overlay);
+  state.overlay = nullptr;
+}
+
+static void overlay_delete_cb(lv_event_t *e) {
+  lv_free(lv_event_get_user_data(e));
+  if (lv_event_get_target(e) == state.overlay) {
+    state = {};
+  }
+}
+
+void sync_chart_open(lv_obj_t *parent) {
+  if (state.overlay) {
+    return;
+  }
+  auto *series = static_cast<ChartSeries *>(lv_malloc(sizeof(ChartSeries)));
+  if (!series) {
+    ESP_LOGE(TAG, "Not enough memory for the sync chart");
+    return;
+  }
+  state = {};
+  state.series = series;
+
+  lv_obj_t *overlay = lv_obj_create(parent);
+  state.overlay = overlay;
+  lv_obj_set_size(overlay, LV_PCT(100), LV_PCT(100));
+  lv_obj_add_flag(overlay, LV_OBJ_FLAG_FLOATING);
+  lv_obj_set_style_radius(overlay, 0, 0);
+  lv_obj_set_style_border_width(overlay, 0, 0);
+  lv_obj_set_style_pad_all(overlay, 4, 0);
+  lv_obj_set_style_pad_row(overlay, 4, 0);
+  lv_obj_clear_flag(overlay, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_layout(overlay, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(overlay, LV_FLEX_FLOW_COLUMN);
+  lv_obj_add_event_cb(overlay, close_cb, LV_EVENT_CLICKED, nullptr);
+  lv_obj_add_event_cb(overlay, overlay_delete_cb, LV_EVENT_DELETE, series);
+
+  state.caption = lv_label_create(overlay);
+  lv_obj_set_width(state.caption, LV_PCT(100));
+  lv_label_set_long_mode(state.caption, LV_LABEL_LONG_DOT);
+  lv_obj_set_style_text_color(state.caption, lv_color_hex(0x888888), 0);
+
+  lv_obj_t *chart = lv_chart_create(overlay);
+  state.chart = chart;
+  lv_obj_set_width(chart, LV_PCT(100));
+  lv_obj_set_flex_grow(chart, 1);
+  // Taps go to the overlay and close it
+  lv_obj_clear_flag(chart, LV_OBJ_FLAG_CLICKABLE);
+  lv_chart_set_type(chart, LV_CHART_TYPE_SCATTER);
+  lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);
+  lv_obj_set_style_line_width(chart, 2, LV_PART_ITEMS);
+  state.offset_series = lv_chart_add_series(
+      chart, lv_color_hex(OFFSET_COLOR), LV_CHART_AXIS_PRIMARY_Y);
+  state.drift_series = lv_chart_add_series(chart, lv_color_hex(DRIFT_COLOR),
+                                           LV_CHART_AXIS_SECONDARY_Y);
+
+  // One kept point per pixel column
+  lv_obj_update_layout(overlay);
+  int width = (int)lv_obj_get_content_width(chart);
+  lttb_stream_init(&series->offset, width);
+  lttb_stream_init(&series->drift, width);
+  sync_log_read(read_record, nullptr);
+  refresh();
+  ESP_LOGD(TAG, "%lu records, %d offset points kept",
+           (unsigned long)state.sync_count, series->offset.count);
+}
+
+void sync_chart_add(const SyncRecord &record) {
+  if (!state.overlay) {
+    return;
+  }
+  add_record(record);
+  refresh();
+}
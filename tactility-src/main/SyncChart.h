@@ -0,0 +1,14 @@
+#pragma once
+
+#include "SyncLog.h"
+
+#include <lvgl.h>
+
+// Full-screen chart of the sync history: the correction applied at each sync
+// (ms) and the drift estimate (ppm) over time. Both series are downsampled
+// with streaming LTTB to the chart's width, so drawing costs the same however
+// long the history is. Closes on tap; only one chart is open at a time.
+void sync_chart_open(lv_obj_t *parent);
+
+// Adds a record just appended to the log, if the chart is open
+void sync_chart_add(const SyncRecord &record);
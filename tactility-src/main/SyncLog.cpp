@@ -0,0 +1,225 @@
+#include "SyncLog.h"
+#include "SyncMonitor.h"
+
+#include <esp_log.h>
+
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+constexpr auto *TAG = "SyncLog";
+
+constexpr int SLOT_SIZE = 32;
+constexpr int CRC_OFFSET = SLOT_SIZE - 4;
+constexpr uint8_t FORMAT_VERSION = 1;
+constexpr int READ_SLOTS = 16;
+
+struct LogState {
+  char path[160];
+  int next_slot;
+  uint32_t next_sequence;
+  uint8_t valid[SYNC_LOG_CAPACITY / 8]; // Slots holding a record
+  int count;
+};
+
+static LogState state = {};
+
+static uint32_t crc32(const uint8_t *data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+static void write_le(uint8_t *out, uint64_t value, int size) {
+  for (int i = 0; i < size; i++) {
+    out[i] = (uint8_t)(value >> (8 * i));
+  }
+}
+
+static uint64_t read_le(const uint8_t *data, int size) {
+  uint64_t value = 0;
+  for (int i = 0; i < size; i++) {
+    value |= (uint64_t)data[i] << (8 * i);
+  }
+  return value;
+}
+
+static void encode_slot(const SyncRecord &record, uint8_t *slot) {
+  write_le(slot, record.sequence, 4);
+  write_le(slot + 4, (uint64_t)record.time, 8);
+  write_le(slot + 12, (uint64_t)record.offset_us, 8);
+  write_le(slot + 20, (uint32_t)record.drift_ppb, 4);
+  write_le(slot + 24, record.rtt_ms, 2);
+  slot[26] = record.source;
+  slot[27] = FORMAT_VERSION;
+  write_le(slot + CRC_OFFSET, crc32(slot, CRC_OFFSET), 4);
+}
+
+// False for torn, never written or foreign slots
+static bool decode_slot(const uint8_t *slot, SyncRecord *record) {
+  if (slot[27] != FORMAT_VERSION ||
+      read_le(slot + CRC_OFFSET, 4) != crc32(slot, CRC_OFFSET)) {
+    return false;
+  }
+  record->sequence = (uint32_t)read_le(slot, 4);
+  record->time = (int64_t)read_le(slot + 4, 8);
+  record->offset_us = (int64_t)read_le(slot + 12, 8);
+  record->drift_ppb = (int32_t)(uint32_t)read_le(slot + 20, 4);
+  record->rtt_ms = (uint16_t)read_le(slot + 24, 2);
+  record->source = slot[26];
+  return record->sequence != 0;
+}
+
+static void set_valid(int slot, bool valid) {
+  bool was_valid = state.valid[slot / 8] & (1 << (slot % 8));
+  if (valid && !was_valid) {
+    state.valid[slot / 8] |= (uint8_t)(1 << (slot % 8));
+    state.count++;
+  } else if (!valid && was_valid) {
+    state.valid[slot / 8] &= (uint8_t)~(1 << (slot % 8));
+    state.count--;
+  }
+}
+
+// Visits slots [first, last) of an open log file
+static bool read_slots(FILE *file, int first, int last,
+                       bool (*visit)(int slot, const SyncRecord &record,
+                                     void *user_data),
+                       void *user_data) {
+  uint8_t buffer[READ_SLOTS * SLOT_SIZE];
+  if (fseek(file, (long)first * SLOT_SIZE, SEEK_SET) != 0) {
+    return true;
+  }
+  for (int slot = first; slot < last;) {
+    int wanted = last - slot < READ_SLOTS ? last - slot : READ_SLOTS;
+    auto read = (int)(fread(buffer, SLOT_SIZE, (size_t)wanted, file));
+    for (int i = 0; i < read; i++) {
+      SyncRecord record;
+      if (decode_slot(buffer + i * SLOT_SIZE, &record) &&
+          !visit(slot + i, record, user_data)) {
+        return false;
+      }
+    }
+    if (read < wanted) {
+      break; // The file ends before the ring is full
+    }
+    slot += read;
+  }
+  return true;
+}
+
+static bool scan_slot(int slot, const SyncRecord &record, void *user_data) {
+  set_valid(slot, true);
+  if (record.sequence >= state.next_sequence) {
+    state.next_sequence = record.sequence + 1;
+    state.next_slot = (slot + 1) % SYNC_LOG_CAPACITY;
+  }
+  return true;
+}
+
+void sync_log_open(const char *path) {
+  state = {};
+  snprintf(state.path, sizeof(state.path), "%s", path);
+  state.next_sequence = 1;
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return;
+  }
+  read_slots(file, 0, SYNC_LOG_CAPACITY, scan_slot, nullptr);
+  fclose(file);
+  ESP_LOGI(TAG, "%d records, next sequence %lu", state.count,
+           (unsigned long)state.next_sequence);
+}
+
+bool sync_log_append(const SyncRecord &record) {
+  if (!state.path[0]) {
+    return false;
+  }
+  FILE *file = fopen(state.path, "r+b");
+  if (!file) {
+    file = fopen(state.path, "w+b");
+  }
+  if (!file) {
+    ESP_LOGW(TAG, "Cannot open %s", state.path);
+    return false;
+  }
+
+  SyncRecord stored = record;
+  stored.sequence = state.next_sequence;
+  uint8_t slot[SLOT_SIZE];
+  encode_slot(stored, slot);
+  // The slot being replaced is the oldest record, or a torn one
+  set_valid(state.next_slot, false);
+  bool written =
+      fseek(file, (long)state.next_slot * SLOT_SIZE, SEEK_SET) == 0 &&
+      fwrite(slot, SLOT_SIZE, 1, file) == 1 && fflush(file) == 0 &&
+      fsync(fileno(file)) == 0;
+  fclose(file);
+  if (!written) {
+    ESP_LOGW(TAG, "Writing slot %d failed", state.next_slot);
+    return false;
+  }
+  set_valid(state.next_slot, true);
+  state.next_slot = (state.next_slot + 1) % SYNC_LOG_CAPACITY;
+  state.next_sequence++;
+  return true;
+}
+
+int sync_log_count() { return state.count; }
+
+struct ReadContext {
+  bool (*visit)(const SyncRecord &record, void *user_data);
+  void *user_data;
+};
+
+static bool visit_record(int slot, const SyncRecord &record, void *user_data) {
+  auto *context = static_cast<ReadContext *>(user_data);
+  return context->visit(record, context->user_data);
+}
+
+void sync_log_read(bool (*visit)(const SyncRecord &record, void *user_data),
+                   void *user_data) {
+  FILE *file = state.path[0] ? fopen(state.path, "rb") : nullptr;
+  if (!file) {
+    return;
+  }
+  // The ring is oldest first from the slot after the newest record
+  ReadContext context = {visit, user_data};
+  if (read_slots(file, state.next_slot, SYNC_LOG_CAPACITY, visit_record,
+                 &context)) {
+    read_slots(file, 0, state.next_slot, visit_record, &context);
+  }
+  fclose(file);
+}
+
+static bool write_csv_line(const SyncRecord &record, void *user_data) {
+  auto *file = static_cast<FILE *>(user_data);
+  time_t time = (time_t)record.time;
+  struct tm utc;
+  gmtime_r(&time, &utc);
+  char when[24];
+  strftime(when, sizeof(when), "%Y-%m-%dT%H:%M:%SZ", &utc);
+  fprintf(file, "%lu,%s,%lld,%ld,%u,%s\n", (unsigned long)record.sequence,
+          when, (long long)record.offset_us, (long)record.drift_ppb,
+          (unsigned)record.rtt_ms,
+          record.source == SyncSourceSntp ? "sntp" : "other");
+  return true;
+}
+
+bool sync_log_export_csv(const char *path) {
+  FILE *file = fopen(path, "w");
+  if (!file) {
+    ESP_LOGW(TAG, "Cannot create %s", path);
+    return false;
+  }
+  fputs("sequence,time,offset_us,drift_ppb,rtt_ms,source\n", file);
+  sync_log_read(write_csv_line, file);
+  bool written = fclose(file) == 0;
+  ESP_LOGI(TAG, "Exported %d records to %s", state.count, path);
+  return written;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <time.h>
+
+// History of clock corrections for diagnosing drift and lost sync in the
+// field. Records go to a fixed-size ring of slots in one file in the app's
+// user data, so the log never grows past SYNC_LOG_CAPACITY records and
+// successive writes land on successive slots rather than rewriting one spot.
+//
+// Each slot carries a sequence number and a CRC. An append only ever writes
+// the slot after the newest record, so losing power mid-write can at worst
+// leave that one slot torn; it fails its CRC and is skipped, and everything
+// written before it survives.
+constexpr int SYNC_LOG_CAPACITY = 256;
+
+struct SyncRecord {
+  uint32_t sequence;
+  int64_t time;      // Unix time just after the correction
+  int64_t offset_us; // Correction applied, positive when the clock was behind
+  int32_t drift_ppb; // Estimated drift up to this sync, 0 when unknown
+  uint16_t rtt_ms;   // Server round trip, 0 when the source does not report it
+  uint8_t source;    // SyncSource
+};
+
+// Scans the log file (created on first append) for the newest record
+void sync_log_open(const char *path);
+
+bool sync_log_append(const SyncRecord &record);
+
+int sync_log_count();
+
+// Visits the valid records oldest first; return false from `visit` to stop
+void sync_log_read(bool (*visit)(const SyncRecord &record, void *user_data),
+                   void *user_data);
+
+// Writes the log as CSV, one record per line
+bool sync_log_export_csv(const char *path);
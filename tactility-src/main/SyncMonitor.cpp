@@ -0,0 +1,66 @@
+#include "SyncMonitor.h"
+
+#include <esp_log.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+
+#include <sys/time.h>
+
+constexpr auto *TAG = "SyncMonitor";
+
+// Smaller differences are scheduling noise between the two clock reads
+constexpr int64_t STEP_THRESHOLD_US = 1000;
+// Corrections too close together say little about drift
+constexpr int64_t MIN_DRIFT_SPAN_US = 10LL * 60 * 1000000;
+// Setting the clock from nothing (1970) is not drift
+constexpr int64_t MAX_DRIFT_STEP_US = 60LL * 1000000;
+
+static SyncStatus status = {};
+static int64_t baseline_offset_us;
+static bool has_baseline = false;
+
+bool sync_monitor_sample() {
+  struct timeval wall;
+  gettimeofday(&wall, nullptr);
+  int64_t monotonic_us = esp_timer_get_time();
+  int64_t offset_us =
+      (int64_t)wall.tv_sec * 1000000 + wall.tv_usec - monotonic_us;
+
+  if (!has_baseline) {
+    baseline_offset_us = offset_us;
+    has_baseline = true;
+    return false;
+  }
+  int64_t step_us = offset_us - baseline_offset_us;
+  if (step_us > -STEP_THRESHOLD_US && step_us < STEP_THRESHOLD_US) {
+    return false;
+  }
+
+  // The clock was behind by step_us, so it ran slow by that much
+  int64_t span_us = monotonic_us - status.last_sync_us;
+  if (status.sync_count > 0 && span_us >= MIN_DRIFT_SPAN_US &&
+      step_us > -MAX_DRIFT_STEP_US && step_us < MAX_DRIFT_STEP_US) {
+    status.drift_ppm = (float)((double)-step_us * 1e6 / (double)span_us);
+    status.has_drift = true;
+  }
+  status.sync_count++;
+  status.last_sync_us = monotonic_us;
+  status.last_step_us = step_us;
+  // SNTP reports a completed sync once, then resets the status
+  status.last_source = sntp_get_sync_status() == SNTP_SYNC_STATUS_COMPLETED
+                           ? SyncSourceSntp
+                           : SyncSourceOther;
+  baseline_offset_us = offset_us;
+  ESP_LOGI(TAG, "Clock corrected by %lld us (%s)", (long long)step_us,
+           status.last_source == SyncSourceSntp ? "SNTP" : "other");
+  return true;
+}
+
+const SyncStatus &sync_monitor_status() { return status; }
+
+int32_t sync_monitor_age_s() {
+  if (status.sync_count == 0) {
+    return -1;
+  }
+  return (int32_t)((esp_timer_get_time() - status.last_sync_us) / 1000000);
+}
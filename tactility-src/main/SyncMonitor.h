@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+// Watches the wall clock against the monotonic esp_timer. Between time syncs
+// the two advance together, so a jump in their difference is a correction
+// applied by SNTP (or a manual set). The size of a correction over the time
+// since the previous one estimates how fast the local clock drifts.
+// Corrections below one millisecond are not seen.
+enum SyncSource : uint8_t {
+  SyncSourceOther = 0, // Manual set, another app, or SNTP unreported
+  SyncSourceSntp = 1,
+};
+
+struct SyncStatus {
+  uint32_t sync_count;     // Corrections seen, including the first set
+  int64_t last_sync_us;    // esp_timer time of the last correction
+  int64_t last_step_us;    // Size of the last correction
+  float drift_ppm;         // Positive when the local clock runs fast
+  bool has_drift;
+  SyncSource last_source;
+};
+
+// Call periodically from one task; returns true when a correction was seen
+bool sync_monitor_sample();
+
+const SyncStatus &sync_monitor_status();
+
+// Seconds since the last correction, or -1 before the first
+int32_t sync_monitor_age_s();
@@ -0,0 +1,989 @@
+// Generated by generate_timezones.py from zone.tab; do not edit.
+// Standard offsets as of 2026; rules from the TZif footers.
+
+#include "Timezones.h"
+
+const char timezone_pool[] =
+    "Africa/Abidjan\0"
+    "GMT0\0"
+    "Africa/Accra\0"
+    "Africa/Addis_Ababa\0"
+    "EAT-3\0"
+    "Africa/Algiers\0"
+    "CET-1\0"
+    "Africa/Asmara\0"
+    "Africa/Bamako\0"
+    "Africa/Bangui\0"
+    "WAT-1\0"
+    "Africa/Banjul\0"
+    "Africa/Bissau\0"
+    "Africa/Blantyre\0"
+    "CAT-2\0"
+    "Africa/Brazzaville\0"
+    "Africa/Bujumbura\0"
+    "Africa/Cairo\0"
+    "EET-2EEST,M4.5.5/0,M10.5.4/24\0"
+    "Africa/Casablanca\0"
+    "<+01>-1\0"
+    "Africa/Ceuta\0"
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "Africa/Conakry\0"
+    "Africa/Dakar\0"
+    "Africa/Dar_es_Salaam\0"
+    "Africa/Djibouti\0"
+    "Africa/Douala\0"
+    "Africa/El_Aaiun\0"
+    "Africa/Freetown\0"
+    "Africa/Gaborone\0"
+    "Africa/Harare\0"
+    "Africa/Johannesburg\0"
+    "SAST-2\0"
+    "Africa/Juba\0"
+    "Africa/Kampala\0"
+    "Africa/Khartoum\0"
+    "Africa/Kigali\0"
+    "Africa/Kinshasa\0"
+    "Africa/Lagos\0"
+    "Africa/Libreville\0"
+    "Africa/Lome\0"
+    "Africa/Luanda\0"
+    "Africa/Lubumbashi\0"
+    "Africa/Lusaka\0"
+    "Africa/Malabo\0"
+    "Africa/Maputo\0"
+    "Africa/Maseru\0"
+    "Africa/Mbabane\0"
+    "Africa/Mogadishu\0"
+    "Africa/Monrovia\0"
+    "Africa/Nairobi\0"
+    "Africa/Ndjamena\0"
+    "Africa/Niamey\0"
+    "Africa/Nouakchott\0"
+    "Africa/Ouagadougou\0"
+    "Africa/Porto-Novo\0"
+    "Africa/Sao_Tome\0"
+    "Africa/Tripoli\0"
+    "EET-2\0"
+    "Africa/Tunis\0"
+    "Africa/Windhoek\0"
+    "America/Adak\0"
+    "HST10HDT,M3.2.0,M11.1.0\0"
+    "America/Anchorage\0"
+    "AKST9AKDT,M3.2.0,M11.1.0\0"
+    "America/Anguilla\0"
+    "AST4\0"
+    "America/Antigua\0"
+    "America/Araguaina\0"
+    "<-03>3\0"
+    "America/Argentina/Buenos_Aires\0"
+    "America/Argentina/Catamarca\0"
+    "America/Argentina/Cordoba\0"
+    "America/Argentina/Jujuy\0"
+    "America/Argentina/La_Rioja\0"
+    "America/Argentina/Mendoza\0"
+    "America/Argentina/Rio_Gallegos\0"
+    "America/Argentina/Salta\0"
+    "America/Argentina/San_Juan\0"
+    "America/Argentina/San_Luis\0"
+    "America/Argentina/Tucuman\0"
+    "America/Argentina/Ushuaia\0"
+    "America/Aruba\0"
+    "America/Asuncion\0"
+    "America/Atikokan\0"
+    "EST5\0"
+    "America/Bahia\0"
+    "America/Bahia_Banderas\0"
+    "CST6\0"
+    "America/Barbados\0"
+    "America/Belem\0"
+    "America/Belize\0"
+    "America/Blanc-Sablon\0"
+    "America/Boa_Vista\0"
+    "<-04>4\0"
+    "America/Bogota\0"
+    "<-05>5\0"
+    "America/Boise\0"
+    "MST7MDT,M3.2.0,M11.1.0\0"
+    "America/Cambridge_Bay\0"
+    "America/Campo_Grande\0"
+    "America/Cancun\0"
+    "America/Caracas\0"
+    "America/Cayenne\0"
+    "America/Cayman\0"
+    "America/Chicago\0"
+    "CST6CDT,M3.2.0,M11.1.0\0"
+    "America/Chihuahua\0"
+    "America/Ciudad_Juarez\0"
+    "America/Costa_Rica\0"
+    "America/Coyhaique\0"
+    "America/Creston\0"
+    "MST7\0"
+    "America/Cuiaba\0"
+    "America/Curacao\0"
+    "America/Danmarkshavn\0"
+    "America/Dawson\0"
+    "America/Dawson_Creek\0"
+    "America/Denver\0"
+    "America/Detroit\0"
+    "EST5EDT,M3.2.0,M11.1.0\0"
+    "America/Dominica\0"
+    "America/Edmonton\0"
+    "America/Eirunepe\0"
+    "America/El_Salvador\0"
+    "America/Fort_Nelson\0"
+    "America/Fortaleza\0"
+    "America/Glace_Bay\0"
+    "AST4ADT,M3.2.0,M11.1.0\0"
+    "America/Goose_Bay\0"
+    "America/Grand_Turk\0"
+    "America/Grenada\0"
+    "America/Guadeloupe\0"
+    "America/Guatemala\0"
+    "America/Guayaquil\0"
+    "America/Guyana\0"
+    "America/Halifax\0"
+    "America/Havana\0"
+    "CST5CDT,M3.2.0/0,M11.1.0/1\0"
+    "America/Hermosillo\0"
+    "America/Indiana/Indianapolis\0"
+    "America/Indiana/Knox\0"
+    "America/Indiana/Marengo\0"
+    "America/Indiana/Petersburg\0"
+    "America/Indiana/Tell_City\0"
+    "America/Indiana/Vevay\0"
+    "America/Indiana/Vincennes\0"
+    "America/Indiana/Winamac\0"
+    "America/Inuvik\0"
+    "America/Iqaluit\0"
+    "America/Jamaica\0"
+    "America/Juneau\0"
+    "America/Kentucky/Louisville\0"
+    "America/Kentucky/Monticello\0"
+    "America/Kralendijk\0"
+    "America/La_Paz\0"
+    "America/Lima\0"
+    "America/Los_Angeles\0"
+    "PST8PDT,M3.2.0,M11.1.0\0"
+    "America/Lower_Princes\0"
+    "America/Maceio\0"
+    "America/Managua\0"
+    "America/Manaus\0"
+    "America/Marigot\0"
+    "America/Martinique\0"
+    "America/Matamoros\0"
+    "America/Mazatlan\0"
+    "America/Menominee\0"
+    "America/Merida\0"
+    "America/Metlakatla\0"
+    "America/Mexico_City\0"
+    "America/Miquelon\0"
+    "<-03>3<-02>,M3.2.0,M11.1.0\0"
+    "America/Moncton\0"
+    "America/Monterrey\0"
+    "America/Montevideo\0"
+    "America/Montserrat\0"
+    "America/Nassau\0"
+    "America/New_York\0"
+    "America/Nome\0"
+    "America/Noronha\0"
+    "<-02>2\0"
+    "America/North_Dakota/Beulah\0"
+    "America/North_Dakota/Center\0"
+    "America/North_Dakota/New_Salem\0"
+    "America/Nuuk\0"
+    "<-02>2<-01>,M3.5.0/-1,M10.5.0/0\0"
+    "America/Ojinaga\0"
+    "America/Panama\0"
+    "America/Paramaribo\0"
+    "America/Phoenix\0"
+    "America/Port_of_Spain\0"
+    "America/Port-au-Prince\0"
+    "America/Porto_Velho\0"
+    "America/Puerto_Rico\0"
+    "America/Punta_Arenas\0"
+    "America/Rankin_Inlet\0"
+    "America/Recife\0"
+    "America/Regina\0"
+    "America/Resolute\0"
+    "America/Rio_Branco\0"
+    "America/Santarem\0"
+    "America/Santiago\0"
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24\0"
+    "America/Santo_Domingo\0"
+    "America/Sao_Paulo\0"
+    "America/Scoresbysund\0"
+    "America/Sitka\0"
+    "America/St_Barthelemy\0"
+    "America/St_Johns\0"
+    "NST3:30NDT,M3.2.0,M11.1.0\0"
+    "America/St_Kitts\0"
+    "America/St_Lucia\0"
+    "America/St_Thomas\0"
+    "America/St_Vincent\0"
+    "America/Swift_Current\0"
+    "America/Tegucigalpa\0"
+    "America/Thule\0"
+    "America/Tijuana\0"
+    "America/Toronto\0"
+    "America/Tortola\0"
+    "America/Vancouver\0"
+    "America/Whitehorse\0"
+    "America/Winnipeg\0"
+    "America/Yakutat\0"
+    "Antarctica/Casey\0"
+    "<+08>-8\0"
+    "Antarctica/Davis\0"
+    "<+07>-7\0"
+    "Antarctica/DumontDUrville\0"
+    "<+10>-10\0"
+    "Antarctica/Macquarie\0"
+    "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+    "Antarctica/Mawson\0"
+    "<+05>-5\0"
+    "Antarctica/McMurdo\0"
+    "NZST-12NZDT,M9.5.0,M4.1.0/3\0"
+    "Antarctica/Palmer\0"
+    "Antarctica/Rothera\0"
+    "Antarctica/Syowa\0"
+    "<+03>-3\0"
+    "Antarctica/Troll\0"
+    "<+00>0<+02>-2,M3.5.0/1,M10.5.0/3\0"
+    "Antarctica/Vostok\0"
+    "Arctic/Longyearbyen\0"
+    "Asia/Aden\0"
+    "Asia/Almaty\0"
+    "Asia/Amman\0"
+    "Asia/Anadyr\0"
+    "<+12>-12\0"
+    "Asia/Aqtau\0"
+    "Asia/Aqtobe\0"
+    "Asia/Ashgabat\0"
+    "Asia/Atyrau\0"
+    "Asia/Baghdad\0"
+    "Asia/Bahrain\0"
+    "Asia/Baku\0"
+    "<+04>-4\0"
+    "Asia/Bangkok\0"
+    "Asia/Barnaul\0"
+    "Asia/Beirut\0"
+    "EET-2EEST,M3.5.0/0,M10.5.0/0\0"
+    "Asia/Bishkek\0"
+    "<+06>-6\0"
+    "Asia/Brunei\0"
+    "Asia/Chita\0"
+    "<+09>-9\0"
+    "Asia/Colombo\0"
+    "<+0530>-5:30\0"
+    "Asia/Damascus\0"
+    "Asia/Dhaka\0"
+    "Asia/Dili\0"
+    "Asia/Dubai\0"
+    "Asia/Dushanbe\0"
+    "Asia/Famagusta\0"
+    "EET-2EEST,M3.5.0/3,M10.5.0/4\0"
+    "Asia/Gaza\0"
+    "EET-2EEST,M3.4.4/50,M10.4.4/50\0"
+    "Asia/Hebron\0"
+    "Asia/Ho_Chi_Minh\0"
+    "Asia/Hong_Kong\0"
+    "HKT-8\0"
+    "Asia/Hovd\0"
+    "Asia/Irkutsk\0"
+    "Asia/Jakarta\0"
+    "WIB-7\0"
+    "Asia/Jayapura\0"
+    "WIT-9\0"
+    "Asia/Jerusalem\0"
+    "IST-2IDT,M3.4.4/26,M10.5.0\0"
+    "Asia/Kabul\0"
+    "<+0430>-4:30\0"
+    "Asia/Kamchatka\0"
+    "Asia/Karachi\0"
+    "PKT-5\0"
+    "Asia/Kathmandu\0"
+    "<+0545>-5:45\0"
+    "Asia/Khandyga\0"
+    "Asia/Kolkata\0"
+    "IST-5:30\0"
+    "Asia/Krasnoyarsk\0"
+    "Asia/Kuala_Lumpur\0"
+    "Asia/Kuching\0"
+    "Asia/Kuwait\0"
+    "Asia/Macau\0"
+    "CST-8\0"
+    "Asia/Magadan\0"
+    "<+11>-11\0"
+    "Asia/Makassar\0"
+    "WITA-8\0"
+    "Asia/Manila\0"
+    "PST-8\0"
+    "Asia/Muscat\0"
+    "Asia/Nicosia\0"
+    "Asia/Novokuznetsk\0"
+    "Asia/Novosibirsk\0"
+    "Asia/Omsk\0"
+    "Asia/Oral\0"
+    "Asia/Phnom_Penh\0"
+    "Asia/Pontianak\0"
+    "Asia/Pyongyang\0"
+    "KST-9\0"
+    "Asia/Qatar\0"
+    "Asia/Qostanay\0"
+    "Asia/Qyzylorda\0"
+    "Asia/Riyadh\0"
+    "Asia/Sakhalin\0"
+    "Asia/Samarkand\0"
+    "Asia/Seoul\0"
+    "Asia/Shanghai\0"
+    "Asia/Singapore\0"
+    "Asia/Srednekolymsk\0"
+    "Asia/Taipei\0"
+    "Asia/Tashkent\0"
+    "Asia/Tbilisi\0"
+    "Asia/Tehran\0"
+    "<+0330>-3:30\0"
+    "Asia/Thimphu\0"
+    "Asia/Tokyo\0"
+    "JST-9\0"
+    "Asia/Tomsk\0"
+    "Asia/Ulaanbaatar\0"
+    "Asia/Urumqi\0"
+    "Asia/Ust-Nera\0"
+    "Asia/Vientiane\0"
+    "Asia/Vladivostok\0"
+    "Asia/Yakutsk\0"
+    "Asia/Yangon\0"
+    "<+0630>-6:30\0"
+    "Asia/Yekaterinburg\0"
+    "Asia/Yerevan\0"
+    "Atlantic/Azores\0"
+    "<-01>1<+00>,M3.5.0/0,M10.5.0/1\0"
+    "Atlantic/Bermuda\0"
+    "Atlantic/Canary\0"
+    "WET0WEST,M3.5.0/1,M10.5.0\0"
+    "Atlantic/Cape_Verde\0"
+    "<-01>1\0"
+    "Atlantic/Faroe\0"
+    "Atlantic/Madeira\0"
+    "Atlantic/Reykjavik\0"
+    "Atlantic/South_Georgia\0"
+    "Atlantic/St_Helena\0"
+    "Atlantic/Stanley\0"
+    "Australia/Adelaide\0"
+    "ACST-9:30ACDT,M10.1.0,M4.1.0/3\0"
+    "Australia/Brisbane\0"
+    "AEST-10\0"
+    "Australia/Broken_Hill\0"
+    "Australia/Darwin\0"
+    "ACST-9:30\0"
+    "Australia/Eucla\0"
+    "<+0845>-8:45\0"
+    "Australia/Hobart\0"
+    "Australia/Lindeman\0"
+    "Australia/Lord_Howe\0"
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0\0"
+    "Australia/Melbourne\0"
+    "Australia/Perth\0"
+    "AWST-8\0"
+    "Australia/Sydney\0"
+    "Europe/Amsterdam\0"
+    "Europe/Andorra\0"
+    "Europe/Astrakhan\0"
+    "Europe/Athens\0"
+    "Europe/Belgrade\0"
+    "Europe/Berlin\0"
+    "Europe/Bratislava\0"
+    "Europe/Brussels\0"
+    "Europe/Bucharest\0"
+    "Europe/Budapest\0"
+    "Europe/Busingen\0"
+    "Europe/Chisinau\0"
+    "EET-2EEST,M3.5.0,M10.5.0/3\0"
+    "Europe/Copenhagen\0"
+    "Europe/Dublin\0"
+    "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+    "Europe/Gibraltar\0"
+    "Europe/Guernsey\0"
+    "GMT0BST,M3.5.0/1,M10.5.0\0"
+    "Europe/Helsinki\0"
+    "Europe/Isle_of_Man\0"
+    "Europe/Istanbul\0"
+    "Europe/Jersey\0"
+    "Europe/Kaliningrad\0"
+    "Europe/Kirov\0"
+    "MSK-3\0"
+    "Europe/Kyiv\0"
+    "Europe/Lisbon\0"
+    "Europe/Ljubljana\0"
+    "Europe/London\0"
+    "Europe/Luxembourg\0"
+    "Europe/Madrid\0"
+    "Europe/Malta\0"
+    "Europe/Mariehamn\0"
+    "Europe/Minsk\0"
+    "Europe/Monaco\0"
+    "Europe/Moscow\0"
+    "Europe/Oslo\0"
+    "Europe/Paris\0"
+    "Europe/Podgorica\0"
+    "Europe/Prague\0"
+    "Europe/Riga\0"
+    "Europe/Rome\0"
+    "Europe/Samara\0"
+    "Europe/San_Marino\0"
+    "Europe/Sarajevo\0"
+    "Europe/Saratov\0"
+    "Europe/Simferopol\0"
+    "Europe/Skopje\0"
+    "Europe/Sofia\0"
+    "Europe/Stockholm\0"
+    "Europe/Tallinn\0"
+    "Europe/Tirane\0"
+    "Europe/Ulyanovsk\0"
+    "Europe/Vaduz\0"
+    "Europe/Vatican\0"
+    "Europe/Vienna\0"
+    "Europe/Vilnius\0"
+    "Europe/Volgograd\0"
+    "Europe/Warsaw\0"
+    "Europe/Zagreb\0"
+    "Europe/Zurich\0"
+    "Indian/Antananarivo\0"
+    "Indian/Chagos\0"
+    "Indian/Christmas\0"
+    "Indian/Cocos\0"
+    "Indian/Comoro\0"
+    "Indian/Kerguelen\0"
+    "Indian/Mahe\0"
+    "Indian/Maldives\0"
+    "Indian/Mauritius\0"
+    "Indian/Mayotte\0"
+    "Indian/Reunion\0"
+    "Pacific/Apia\0"
+    "<+13>-13\0"
+    "Pacific/Auckland\0"
+    "Pacific/Bougainville\0"
+    "Pacific/Chatham\0"
+    "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45\0"
+    "Pacific/Chuuk\0"
+    "Pacific/Easter\0"
+    "<-06>6<-05>,M9.1.6/22,M4.1.6/22\0"
+    "Pacific/Efate\0"
+    "Pacific/Fakaofo\0"
+    "Pacific/Fiji\0"
+    "Pacific/Funafuti\0"
+    "Pacific/Galapagos\0"
+    "<-06>6\0"
+    "Pacific/Gambier\0"
+    "<-09>9\0"
+    "Pacific/Guadalcanal\0"
+    "Pacific/Guam\0"
+    "ChST-10\0"
+    "Pacific/Honolulu\0"
+    "HST10\0"
+    "Pacific/Kanton\0"
+    "Pacific/Kiritimati\0"
+    "<+14>-14\0"
+    "Pacific/Kosrae\0"
+    "Pacific/Kwajalein\0"
+    "Pacific/Majuro\0"
+    "Pacific/Marquesas\0"
+    "<-0930>9:30\0"
+    "Pacific/Midway\0"
+    "SST11\0"
+    "Pacific/Nauru\0"
+    "Pacific/Niue\0"
+    "<-11>11\0"
+    "Pacific/Norfolk\0"
+    "<+11>-11<+12>,M10.1.0,M4.1.0/3\0"
+    "Pacific/Noumea\0"
+    "Pacific/Pago_Pago\0"
+    "Pacific/Palau\0"
+    "Pacific/Pitcairn\0"
+    "<-08>8\0"
+    "Pacific/Pohnpei\0"
+    "Pacific/Port_Moresby\0"
+    "Pacific/Rarotonga\0"
+    "<-10>10\0"
+    "Pacific/Saipan\0"
+    "Pacific/Tahiti\0"
+    "Pacific/Tarawa\0"
+    "Pacific/Tongatapu\0"
+    "Pacific/Wake\0"
+    "Pacific/Wallis\0"
+    "UTC\0"
+    "UTC0\0";
+
+const TimezoneInfo timezones[] = {
+    {0, 7, 0, 15},
+    {20, 7, 0, 15},
+    {33, 7, 180, 52},
+    {58, 7, 60, 73},
+    {79, 7, 180, 52},
+    {93, 7, 0, 15},
+    {107, 7, 60, 121},
+    {127, 7, 0, 15},
+    {141, 7, 0, 15},
+    {155, 7, 120, 171},
+    {177, 7, 60, 121},
+    {196, 7, 120, 171},
+    {213, 7, 120, 226},
+    {256, 7, 60, 274},
+    {282, 7, 60, 295},
+    {322, 7, 0, 15},
+    {337, 7, 0, 15},
+    {350, 7, 180, 52},
+    {371, 7, 180, 52},
+    {387, 7, 60, 121},
+    {401, 7, 60, 274},
+    {417, 7, 0, 15},
+    {433, 7, 120, 171},
+    {449, 7, 120, 171},
+    {463, 7, 120, 483},
+    {490, 7, 120, 171},
+    {502, 7, 180, 52},
+    {517, 7, 120, 171},
+    {533, 7, 120, 171},
+    {547, 7, 60, 121},
+    {563, 7, 60, 121},
+    {576, 7, 60, 121},
+    {594, 7, 0, 15},
+    {606, 7, 60, 121},
+    {620, 7, 120, 171},
+    {638, 7, 120, 171},
+    {652, 7, 60, 121},
+    {666, 7, 120, 171},
+    {680, 7, 120, 483},
+    {694, 7, 120, 483},
+    {709, 7, 180, 52},
+    {726, 7, 0, 15},
+    {742, 7, 180, 52},
+    {757, 7, 60, 121},
+    {773, 7, 60, 121},
+    {787, 7, 0, 15},
+    {805, 7, 0, 15},
+    {824, 7, 60, 121},
+    {842, 7, 0, 15},
+    {858, 7, 120, 873},
+    {879, 7, 60, 73},
+    {892, 7, 120, 171},
+    {908, 8, -600, 921},
+    {945, 8, -540, 963},
+    {988, 8, -240, 1005},
+    {1010, 8, -240, 1005},
+    {1026, 8, -180, 1044},
+    {1051, 18, -180, 1044},
+    {1082, 18, -180, 1044},
+    {1110, 18, -180, 1044},
+    {1136, 18, -180, 1044},
+    {1160, 18, -180, 1044},
+    {1187, 18, -180, 1044},
+    {1213, 18, -180, 1044},
+    {1244, 18, -180, 1044},
+    {1268, 18, -180, 1044},
+    {1295, 18, -180, 1044},
+    {1322, 18, -180, 1044},
+    {1348, 18, -180, 1044},
+    {1374, 8, -240, 1005},
+    {1388, 8, -180, 1044},
+    {1405, 8, -300, 1422},
+    {1427, 8, -180, 1044},
+    {1441, 8, -360, 1464},
+    {1469, 8, -240, 1005},
+    {1486, 8, -180, 1044},
+    {1500, 8, -360, 1464},
+    {1515, 8, -240, 1005},
+    {1536, 8, -240, 1554},
+    {1561, 8, -300, 1576},
+    {1583, 8, -420, 1597},
+    {1620, 8, -420, 1597},
+    {1642, 8, -240, 1554},
+    {1663, 8, -300, 1422},
+    {1678, 8, -240, 1554},
+    {1694, 8, -180, 1044},
+    {1710, 8, -300, 1422},
+    {1725, 8, -360, 1741},
+    {1764, 8, -360, 1464},
+    {1782, 8, -420, 1597},
+    {1804, 8, -360, 1464},
+    {1823, 8, -180, 1044},
+    {1841, 8, -420, 1857},
+    {1862, 8, -240, 1554},
+    {1877, 8, -240, 1005},
+    {1893, 8, 0, 15},
+    {1914, 8, -420, 1857},
+    {1929, 8, -420, 1857},
+    {1950, 8, -420, 1597},
+    {1965, 8, -300, 1981},
+    {2004, 8, -240, 1005},
+    {2021, 8, -420, 1597},
+    {2038, 8, -300, 1576},
+    {2055, 8, -360, 1464},
+    {2075, 8, -420, 1857},
+    {2095, 8, -180, 1044},
+    {2113, 8, -240, 2131},
+    {2154, 8, -240, 2131},
+    {2172, 8, -300, 1981},
+    {2191, 8, -240, 1005},
+    {2207, 8, -240, 1005},
+    {2226, 8, -360, 1464},
+    {2244, 8, -300, 1576},
+    {2262, 8, -240, 1554},
+    {2277, 8, -240, 2131},
+    {2293, 8, -300, 2308},
+    {2335, 8, -420, 1857},
+    {2354, 16, -300, 1981},
+    {2383, 16, -360, 1741},
+    {2404, 16, -300, 1981},
+    {2428, 16, -300, 1981},
+    {2455, 16, -360, 1741},
+    {2481, 16, -300, 1981},
+    {2503, 16, -300, 1981},
+    {2529, 16, -300, 1981},
+    {2553, 8, -420, 1597},
+    {2568, 8, -300, 1981},
+    {2584, 8, -300, 1422},
+    {2600, 8, -540, 963},
+    {2615, 17, -300, 1981},
+    {2643, 17, -300, 1981},
+    {2671, 8, -240, 1005},
+    {2690, 8, -240, 1554},
+    {2705, 8, -300, 1576},
+    {2718, 8, -480, 2738},
+    {2761, 8, -240, 1005},
+    {2783, 8, -180, 1044},
+    {2798, 8, -360, 1464},
+    {2814, 8, -240, 1554},
+    {2829, 8, -240, 1005},
+    {2845, 8, -240, 1005},
+    {2864, 8, -360, 1741},
+    {2882, 8, -420, 1857},
+    {2899, 8, -360, 1741},
+    {2917, 8, -360, 1464},
+    {2932, 8, -540, 963},
+    {2951, 8, -360, 1464},
+    {2971, 8, -180, 2988},
+    {3015, 8, -240, 2131},
+    {3031, 8, -360, 1464},
+    {3049, 8, -180, 1044},
+    {3068, 8, -240, 1005},
+    {3087, 8, -300, 1981},
+    {3102, 8, -300, 1981},
+    {3119, 8, -540, 963},
+    {3132, 8, -120, 3148},
+    {3155, 21, -360, 1741},
+    {3183, 21, -360, 1741},
+    {3211, 21, -360, 1741},
+    {3242, 8, -120, 3255},
+    {3287, 8, -360, 1741},
+    {3303, 8, -300, 1422},
+    {3318, 8, -180, 1044},
+    {3337, 8, -420, 1857},
+    {3353, 8, -240, 1005},
+    {3375, 8, -300, 1981},
+    {3398, 8, -240, 1554},
+    {3418, 8, -240, 1005},
+    {3438, 8, -180, 1044},
+    {3459, 8, -360, 1741},
+    {3480, 8, -180, 1044},
+    {3495, 8, -360, 1464},
+    {3510, 8, -360, 1741},
+    {3527, 8, -300, 1576},
+    {3546, 8, -180, 1044},
+    {3563, 8, -240, 3580},
+    {3612, 8, -240, 1005},
+    {3634, 8, -180, 1044},
+    {3652, 8, -120, 3255},
+    {3673, 8, -540, 963},
+    {3687, 8, -240, 1005},
+    {3709, 8, -210, 3726},
+    {3752, 8, -240, 1005},
+    {3769, 8, -240, 1005},
+    {3786, 8, -240, 1005},
+    {3804, 8, -240, 1005},
+    {3823, 8, -360, 1464},
+    {3845, 8, -360, 1464},
+    {3865, 8, -240, 2131},
+    {3879, 8, -480, 2738},
+    {3895, 8, -300, 1981},
+    {3911, 8, -240, 1005},
+    {3927, 8, -480, 2738},
+    {3945, 8, -420, 1857},
+    {3964, 8, -360, 1741},
+    {3981, 8, -540, 963},
+    {3997, 11, 480, 4014},
+    {4022, 11, 420, 4039},
+    {4047, 11, 600, 4073},
+    {4082, 11, 600, 4103},
+    {4132, 11, 300, 4150},
+    {4158, 11, 720, 4177},
+    {4205, 11, -180, 1044},
+    {4223, 11, -180, 1044},
+    {4242, 11, 180, 4259},
+    {4267, 11, 0, 4284},
+    {4317, 11, 300, 4150},
+    {4335, 7, 60, 295},
+    {4355, 5, 180, 4259},
+    {4365, 5, 300, 4150},
+    {4377, 5, 180, 4259},
+    {4388, 5, 720, 4400},
+    {4409, 5, 300, 4150},
+    {4420, 5, 300, 4150},
+    {4432, 5, 300, 4150},
+    {4446, 5, 300, 4150},
+    {4458, 5, 180, 4259},
+    {4471, 5, 180, 4259},
+    {4484, 5, 240, 4494},
+    {4502, 5, 420, 4039},
+    {4515, 5, 420, 4039},
+    {4528, 5, 120, 4540},
+    {4569, 5, 360, 4582},
+    {4590, 5, 480, 4014},
+    {4602, 5, 540, 4613},
+    {4621, 5, 330, 4634},
+    {4647, 5, 180, 4259},
+    {4661, 5, 360, 4582},
+    {4672, 5, 540, 4613},
+    {4682, 5, 240, 4494},
+    {4693, 5, 300, 4150},
+    {4707, 5, 120, 4722},
+    {4751, 5, 120, 4761},
+    {4792, 5, 120, 4761},
+    {4804, 5, 420, 4039},
+    {4821, 5, 480, 4836},
+    {4842, 5, 420, 4039},
+    {4852, 5, 480, 4014},
+    {4865, 5, 420, 4878},
+    {4884, 5, 540, 4898},
+    {4904, 5, 120, 4919},
+    {4946, 5, 270, 4957},
+    {4970, 5, 720, 4400},
+    {4985, 5, 300, 4998},
+    {5004, 5, 345, 5019},
+    {5032, 5, 540, 4613},
+    {5046, 5, 330, 5059},
+    {5068, 5, 420, 4039},
+    {5085, 5, 480, 4014},
+    {5103, 5, 480, 4014},
+    {5116, 5, 180, 4259},
+    {5128, 5, 480, 5139},
+    {5145, 5, 660, 5158},
+    {5167, 5, 480, 5181},
+    {5188, 5, 480, 5200},
+    {5206, 5, 240, 4494},
+    {5218, 5, 120, 4722},
+    {5231, 5, 420, 4039},
+    {5249, 5, 420, 4039},
+    {5266, 5, 360, 4582},
+    {5276, 5, 300, 4150},
+    {5286, 5, 420, 4039},
+    {5302, 5, 420, 4878},
+    {5317, 5, 540, 5332},
+    {5338, 5, 180, 4259},
+    {5349, 5, 300, 4150},
+    {5363, 5, 300, 4150},
+    {5378, 5, 180, 4259},
+    {5390, 5, 660, 5158},
+    {5404, 5, 300, 4150},
+    {5419, 5, 540, 5332},
+    {5430, 5, 480, 5139},
+    {5444, 5, 480, 4014},
+    {5459, 5, 660, 5158},
+    {5478, 5, 480, 5139},
+    {5490, 5, 300, 4150},
+    {5504, 5, 240, 4494},
+    {5517, 5, 210, 5529},
+    {5542, 5, 360, 4582},
+    {5555, 5, 540, 5566},
+    {5572, 5, 420, 4039},
+    {5583, 5, 480, 4014},
+    {5600, 5, 360, 4582},
+    {5612, 5, 600, 4073},
+    {5626, 5, 420, 4039},
+    {5641, 5, 600, 4073},
+    {5658, 5, 540, 4613},
+    {5671, 5, 390, 5683},
+    {5696, 5, 300, 4150},
+    {5715, 5, 240, 4494},
+    {5728, 9, -60, 5744},
+    {5775, 9, -240, 2131},
+    {5792, 9, 0, 5808},
+    {5834, 9, -60, 5854},
+    {5861, 9, 0, 5808},
+    {5876, 9, 0, 5808},
+    {5893, 9, 0, 15},
+    {5912, 9, -120, 3148},
+    {5935, 9, 0, 15},
+    {5954, 9, -180, 1044},
+    {5971, 10, 570, 5990},
+    {6021, 10, 600, 6040},
+    {6048, 10, 570, 5990},
+    {6070, 10, 570, 6087},
+    {6097, 10, 525, 6113},
+    {6126, 10, 600, 4103},
+    {6143, 10, 600, 6040},
+    {6162, 10, 630, 6182},
+    {6219, 10, 600, 4103},
+    {6239, 10, 480, 6255},
+    {6262, 10, 600, 4103},
+    {6279, 7, 60, 295},
+    {6296, 7, 60, 295},
+    {6311, 7, 240, 4494},
+    {6328, 7, 120, 4722},
+    {6342, 7, 60, 295},
+    {6358, 7, 60, 295},
+    {6372, 7, 60, 295},
+    {6390, 7, 60, 295},
+    {6406, 7, 120, 4722},
+    {6423, 7, 60, 295},
+    {6439, 7, 60, 295},
+    {6455, 7, 120, 6471},
+    {6498, 7, 60, 295},
+    {6516, 7, 0, 6530},
+    {6557, 7, 60, 295},
+    {6574, 7, 0, 6590},
+    {6615, 7, 120, 4722},
+    {6631, 7, 0, 6590},
+    {6650, 7, 180, 4259},
+    {6666, 7, 0, 6590},
+    {6680, 7, 120, 873},
+    {6699, 7, 180, 6712},
+    {6718, 7, 120, 4722},
+    {6730, 7, 0, 5808},
+    {6744, 7, 60, 295},
+    {6761, 7, 0, 6590},
+    {6775, 7, 60, 295},
+    {6793, 7, 60, 295},
+    {6807, 7, 60, 295},
+    {6820, 7, 120, 4722},
+    {6837, 7, 180, 4259},
+    {6850, 7, 60, 295},
+    {6864, 7, 180, 6712},
+    {6878, 7, 60, 295},
+    {6890, 7, 60, 295},
+    {6903, 7, 60, 295},
+    {6920, 7, 60, 295},
+    {6934, 7, 120, 4722},
+    {6946, 7, 60, 295},
+    {6958, 7, 240, 4494},
+    {6972, 7, 60, 295},
+    {6990, 7, 60, 295},
+    {7006, 7, 240, 4494},
+    {7021, 7, 180, 6712},
+    {7039, 7, 60, 295},
+    {7053, 7, 120, 4722},
+    {7066, 7, 60, 295},
+    {7083, 7, 120, 4722},
+    {7098, 7, 60, 295},
+    {7112, 7, 240, 4494},
+    {7129, 7, 60, 295},
+    {7142, 7, 60, 295},
+    {7157, 7, 60, 295},
+    {7171, 7, 120, 4722},
+    {7186, 7, 180, 6712},
+    {7203, 7, 60, 295},
+    {7217, 7, 60, 295},
+    {7231, 7, 60, 295},
+    {7245, 7, 180, 52},
+    {7265, 7, 360, 4582},
+    {7279, 7, 420, 4039},
+    {7296, 7, 390, 5683},
+    {7309, 7, 180, 52},
+    {7323, 7, 300, 4150},
+    {7340, 7, 240, 4494},
+    {7352, 7, 300, 4150},
+    {7368, 7, 240, 4494},
+    {7385, 7, 180, 52},
+    {7400, 7, 240, 4494},
+    {7415, 8, 780, 7428},
+    {7437, 8, 720, 4177},
+    {7454, 8, 660, 5158},
+    {7475, 8, 765, 7491},
+    {7536, 8, 600, 4073},
+    {7550, 8, -360, 7565},
+    {7597, 8, 660, 5158},
+    {7611, 8, 780, 7428},
+    {7627, 8, 720, 4400},
+    {7640, 8, 720, 4400},
+    {7657, 8, -360, 7675},
+    {7682, 8, -540, 7698},
+    {7705, 8, 660, 5158},
+    {7725, 8, 600, 7738},
+    {7746, 8, -600, 7763},
+    {7769, 8, 780, 7428},
+    {7784, 8, 840, 7803},
+    {7812, 8, 660, 5158},
+    {7827, 8, 720, 4400},
+    {7845, 8, 720, 4400},
+    {7860, 8, -570, 7878},
+    {7890, 8, -660, 7905},
+    {7911, 8, 720, 4400},
+    {7925, 8, -660, 7938},
+    {7946, 8, 660, 7962},
+    {7993, 8, 660, 5158},
+    {8008, 8, -660, 7905},
+    {8026, 8, 540, 4613},
+    {8040, 8, -480, 8057},
+    {8064, 8, 660, 5158},
+    {8080, 8, 600, 4073},
+    {8101, 8, -600, 8119},
+    {8127, 8, 600, 7738},
+    {8142, 8, -600, 8119},
+    {8157, 8, 720, 4400},
+    {8172, 8, 780, 7428},
+    {8190, 8, 720, 4400},
+    {8203, 8, 720, 4400},
+    {8218, 0, 0, 8222},
+};
+
+const uint16_t timezone_count = 419;
+
+const uint16_t timezone_city_order[] = {
+    0, 1, 52, 2, 300, 208, 3, 209, 210, 311, 211, 53,
+    312, 54, 369, 55, 380, 212, 213, 56, 69, 214, 4, 313,
+    70, 314, 71, 215, 381, 290, 216, 72, 73, 217, 218, 5,
+    219, 6, 7, 74, 220, 221, 75, 315, 76, 316, 291, 156,
+    222, 8, 77, 9, 78, 79, 80, 382, 317, 10, 301, 302,
+    223, 318, 319, 320, 57, 11, 321, 12, 81, 82, 292, 83,
+    293, 84, 13, 196, 58, 85, 86, 157, 14, 370, 383, 87,
+    88, 322, 224, 371, 384, 89, 372, 225, 373, 15, 323, 59,
+    90, 91, 92, 93, 94, 16, 226, 95, 17, 303, 197, 96,
+    97, 98, 99, 227, 228, 18, 100, 19, 229, 324, 198, 230,
+    385, 101, 386, 102, 20, 103, 304, 387, 231, 294, 388, 104,
+    105, 21, 389, 22, 390, 391, 232, 325, 106, 107, 108, 109,
+    392, 110, 393, 111, 112, 326, 113, 114, 23, 115, 233, 327,
+    116, 234, 305, 235, 394, 236, 117, 125, 126, 237, 328, 329,
+    238, 127, 239, 330, 240, 24, 25, 60, 128, 241, 331, 242,
+    26, 395, 243, 244, 374, 245, 27, 28, 29, 396, 332, 118,
+    246, 397, 131, 247, 248, 249, 250, 398, 333, 132, 61, 30,
+    31, 133, 306, 334, 335, 32, 336, 207, 307, 134, 129, 135,
+    33, 34, 35, 337, 251, 136, 199, 295, 338, 252, 375, 399,
+    253, 36, 376, 339, 137, 138, 254, 37, 119, 340, 139, 400,
+    140, 38, 141, 377, 200, 378, 142, 39, 201, 308, 62, 143,
+    144, 145, 146, 401, 341, 147, 40, 342, 148, 41, 149, 150,
+    130, 151, 343, 255, 42, 152, 402, 43, 158, 153, 44, 256,
+    403, 154, 404, 155, 45, 405, 257, 258, 159, 160, 259, 260,
+    344, 46, 406, 407, 202, 161, 162, 345, 309, 120, 261, 163,
+    408, 346, 409, 262, 410, 164, 165, 166, 47, 347, 167, 168,
+    263, 264, 265, 266, 169, 411, 170, 171, 172, 379, 296, 348,
+    173, 63, 267, 349, 203, 412, 268, 64, 350, 269, 65, 66,
+    351, 174, 175, 176, 177, 48, 352, 353, 178, 270, 271, 354,
+    272, 179, 355, 356, 297, 273, 180, 298, 181, 182, 183, 184,
+    185, 299, 357, 186, 310, 204, 413, 274, 358, 414, 275, 276,
+    187, 277, 121, 278, 188, 189, 359, 279, 280, 415, 190, 191,
+    49, 205, 67, 50, 281, 360, 282, 68, 283, 418, 361, 192,
+    362, 122, 363, 284, 364, 123, 285, 365, 206, 416, 417, 366,
+    193, 124, 51, 194, 195, 286, 287, 288, 289, 367, 368,
+};
+
+const uint16_t timezone_name_index[27] = {
+    0, 311, 311, 311, 311, 369, 369, 369, 369,
+    380, 380, 380, 380, 380, 380, 380, 418, 418,
+    418, 418, 418, 419, 419, 419, 419, 419, 419,
+};
+
+const uint16_t timezone_city_index[27] = {
+    0, 30, 67, 101, 120, 127, 135, 151, 162,
+    168, 177, 201, 220, 268, 285, 290, 313, 316,
+    329, 366, 388, 394, 405, 412, 412, 417, 419,
+};
@@ -0,0 +1,226 @@
+#include "TimezonePicker.h"
+#include "Timezones.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include <cstdint>
+
+constexpr auto *TAG = "TimezonePicker";
+
+constexpr int MAX_ROWS = 16;
+constexpr lv_coord_t ROW_PADDING = 8;
+
+struct PickerState {
+  lv_obj_t *overlay;
+  lv_obj_t *search_field;
+  lv_obj_t *keyboard;
+  lv_obj_t *list;
+  lv_obj_t *spacer; // Gives the list the scroll height of all results
+  lv_obj_t *rows[MAX_ROWS];
+  lv_obj_t *labels[MAX_ROWS];
+  int row_zones[MAX_ROWS];
+  int row_count;
+  lv_coord_t row_height;
+  int first_result; // Result shown in rows[0], -1 to force a re-bind
+  TimezoneSearch search;
+  TimezonePickerCallback callback;
+  void *user_data;
+};
+
+static PickerState picker = {};
+
+static void bind_row(int row, int result) {
+  lv_obj_t *button = picker.rows[row];
+  if (result >= picker.search.count) {
+    lv_obj_add_flag(button, LV_OBJ_FLAG_HIDDEN);
+    return;
+  }
+  int zone = timezone_search_get(&picker.search, result);
+  picker.row_zones[row] = zone;
+
+  char name[48];
+  size_t length = 0;
+  for (const char *c = timezone_name(zone); *c && length + 1 < sizeof(name);
+       c++) {
+    name[length++] = *c == '_' ? ' ' : *c;
+  }
+  name[length] = '\0';
+  char offset[16];
+  timezone_format_offset(timezones[zone].offset_minutes, offset,
+                         sizeof(offset));
+  lv_label_set_text_fmt(picker.labels[row], "%s  %s", name, offset);
+  lv_obj_set_y(button, (lv_coord_t)(result * picker.row_height));
+  lv_obj_clear_flag(button, LV_OBJ_FLAG_HIDDEN);
+}
+
+// Point the row pool at the results under the current scroll position
+static void bind_rows() {
+  int first = (int)(lv_obj_get_scroll_y(picker.list) / picker.row_height);
+  first = LV_MAX(first, 0);
+  if (first == picker.first_result) {
+    return;
+  }
+  picker.first_result = first;
+  for (int i = 0; i < picker.row_count; i++) {
+    bind_row(i, first + i);
+  }
+}
+
+static void run_search() {
+  int64_t start = esp_timer_get_time();
+  timezone_search_update(&picker.search,
+                         lv_textarea_get_text(picker.search_field));
+  lv_obj_set_height(picker.spacer,
+                    (lv_coord_t)(LV_MAX(picker.search.count, 1) *
+                                 picker.row_height));
+  lv_obj_scroll_to_y(picker.list, 0, LV_ANIM_OFF);
+  picker.first_result = -1;
+  bind_rows();
+  ESP_LOGD(TAG, "\"%s\": %u zones in %lld us", picker.search.query,
+           (unsigned)picker.search.count,
+           (long long)(esp_timer_get_time() - start));
+}
+
+static void search_changed_cb(lv_event_t *e) { run_search(); }
+
+static void search_focused_cb(lv_event_t *e) {
+  lv_obj_clear_flag(picker.keyboard, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void keyboard_cb(lv_event_t *e) {
+  if (lv_event_get_code(e) == LV_EVENT_READY) {
+    // Hide the keyboard to see more results
+    lv_obj_add_flag(picker.keyboard, LV_OBJ_FLAG_HIDDEN);
+  } else if (lv_event_get_code(e) == LV_EVENT_CANCEL) {
+    timezone_picker_close();
+  }
+}
+
+static void list_scroll_cb(lv_event_t *e) { bind_rows(); }
+
+static void row_clicked_cb(lv_event_t *e) {
+  auto row = (int)(intptr_t)lv_event_get_user_data(e);
+  int zone = picker.row_zones[row];
+  TimezonePickerCallback callback = picker.callback;
+  void *user_data = picker.user_data;
+  timezone_picker_close();
+  callback(zone, user_data);
+}
+
+static void close_clicked_cb(lv_event_t *e) { timezone_picker_close(); }
+
+static void overlay_delete_cb(lv_event_t *e) {
+  // Also reached when the parent goes away with the picker still open
+  if (lv_event_get_target(e) == picker.overlay) {
+    picker = {};
+  }
+}
+
+static lv_obj_t *create_list(lv_obj_t *parent) {
+  lv_obj_t *list = lv_obj_create(parent);
+  lv_obj_set_width(list, LV_PCT(100));
+  lv_obj_set_flex_grow(list, 1);
+  lv_obj_set_style_pad_all(list, 0, 0);
+  lv_obj_set_style_border_width(list, 0, 0);
+  lv_obj_set_scroll_dir(list, LV_DIR_VER);
+  lv_obj_add_event_cb(list, list_scroll_cb, LV_EVENT_SCROLL, nullptr);
+
+  picker.spacer = lv_obj_create(list);
+  lv_obj_remove_style_all(picker.spacer);
+  lv_obj_set_size(picker.spacer, 1, picker.row_height);
+  lv_obj_clear_flag(picker.spacer, LV_OBJ_FLAG_CLICKABLE);
+
+  // Enough rows to fill the list at full height, with the keyboard hidden
+  lv_coord_t height = lv_obj_get_height(parent);
+  picker.row_count = LV_MIN(MAX_ROWS, height / picker.row_height + 2);
+  for (int i = 0; i < picker.row_count; i++) {
+    lv_obj_t *button = lv_btn_create(list);
+    lv_obj_set_size(button, LV_PCT(100), picker.row_height);
+    lv_obj_set_style_radius(button, 0, 0);
+    lv_obj_set_style_bg_color(button, lv_color_hex(0x1E1E1E), 0);
+    lv_obj_set_style_bg_color(button, lv_color_hex(0x007BFF), LV_STATE_PRESSED);
+    lv_obj_set_style_pad_hor(button, ROW_PADDING, 0);
+    lv_obj_add_flag(button, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(button, row_clicked_cb, LV_EVENT_CLICKED,
+                        (void *)(intptr_t)i);
+
+    lv_obj_t *label = lv_label_create(button);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+    lv_obj_set_width(label, LV_PCT(100));
+    lv_obj_align(label, LV_ALIGN_LEFT_MID, 0, 0);
+    picker.rows[i] = button;
+    picker.labels[i] = label;
+  }
+  return list;
+}
+
+void timezone_picker_open(lv_obj_t *parent, TimezonePickerCallback callback,
+                          void *user_data) {
+  timezone_picker_close();
+  picker.callback = callback;
+  picker.user_data = user_data;
+  picker.row_height = (lv_coord_t)(
+      lv_font_get_line_height(lv_font_get_default()) + 2 * ROW_PADDING);
+  timezone_search_reset(&picker.search);
+
+  lv_obj_t *overlay = lv_obj_create(parent);
+  picker.overlay = overlay;
+  lv_obj_set_size(overlay, LV_PCT(100), LV_PCT(100));
+  lv_obj_add_flag(overlay, LV_OBJ_FLAG_FLOATING);
+  lv_obj_set_style_radius(overlay, 0, 0);
+  lv_obj_set_style_border_width(overlay, 0, 0);
+  lv_obj_set_style_pad_all(overlay, 4, 0);
+  lv_obj_set_style_pad_row(overlay, 4, 0);
+  lv_obj_clear_flag(overlay, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_layout(overlay, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(overlay, LV_FLEX_FLOW_COLUMN);
+  lv_obj_add_event_cb(overlay, overlay_delete_cb, LV_EVENT_DELETE, nullptr);
+  lv_obj_update_layout(overlay);
+
+  // Search field and close button
+  lv_obj_t *header = lv_obj_create(overlay);
+  lv_obj_remove_style_all(header);
+  lv_obj_set_size(header, LV_PCT(100), LV_SIZE_CONTENT);
+  lv_obj_set_layout(header, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(header, LV_FLEX_FLOW_ROW);
+  lv_obj_set_flex_align(header, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER,
+                        LV_FLEX_ALIGN_CENTER);
+  lv_obj_set_style_pad_column(header, 4, 0);
+
+  picker.search_field = lv_textarea_create(header);
+  lv_textarea_set_one_line(picker.search_field, true);
+  lv_textarea_set_placeholder_text(picker.search_field, "City or Area/City");
+  lv_obj_set_flex_grow(picker.search_field, 1);
+  lv_obj_add_event_cb(picker.search_field, search_changed_cb,
+                      LV_EVENT_VALUE_CHANGED, nullptr);
+  lv_obj_add_event_cb(picker.search_field, search_focused_cb,
+                      LV_EVENT_FOCUSED, nullptr);
+
+  lv_obj_t *close_button = lv_btn_create(header);
+  lv_obj_t *close_label = lv_label_create(close_button);
+  lv_label_set_text(close_label, LV_SYMBOL_CLOSE);
+  lv_obj_center(close_label);
+  lv_obj_add_event_cb(close_button, close_clicked_cb, LV_EVENT_CLICKED,
+                      nullptr);
+
+  picker.list = create_list(overlay);
+
+  picker.keyboard = lv_keyboard_create(overlay);
+  lv_obj_set_size(picker.keyboard, LV_PCT(100), LV_PCT(45));
+  lv_keyboard_set_textarea(picker.keyboard, picker.search_field);
+  lv_obj_add_event_cb(picker.keyboard, keyboard_cb, LV_EVENT_ALL, nullptr);
+  lv_obj_add_state(picker.search_field, LV_STATE_FOCUSED);
+
+  run_search();
+}
+
+void timezone_picker_close() {
+  if (!picker.overlay) {
+    return;
+  }
+  // Often called from an event of one of the picker's own children
+  lv_obj_t *overlay = picker.overlay;
+  picker = {};
+  lv_obj_delete_async(overlay);
+}
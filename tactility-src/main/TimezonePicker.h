@@ -0,0 +1,16 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Called with the chosen zone (an index into timezones[])
+typedef void (*TimezonePickerCallback)(int zone, void *user_data);
+
+// Full-screen zone picker over `parent`: a search field with an on-screen
+// keyboard and a result list. The list is virtualized: only enough rows to
+// fill the viewport exist and are re-bound to results while scrolling, so
+// typing or scrolling never creates objects. Closes itself once a zone is
+// chosen or on cancel; only one picker is open at a time.
+void timezone_picker_open(lv_obj_t *parent, TimezonePickerCallback callback,
+                          void *user_data);
+
+void timezone_picker_close();
@@ -0,0 +1,107 @@
+#include "Timezones.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static int search_key(char c) {
+  if (c >= 'A' && c <= 'Z') {
+    return c - 'A' + 'a';
+  }
+  return c == '_' ? ' ' : (unsigned char)c;
+}
+
+// <0, 0 or >0 as `text` sorts before, starts with or sorts after `prefix`
+static int compare_prefix(const char *text, const char *prefix) {
+  for (; *prefix; text++, prefix++) {
+    int a = *text ? search_key(*text) : 0;
+    int b = search_key(*prefix);
+    if (a != b) {
+      return a - b;
+    }
+  }
+  return 0;
+}
+
+static const char *key_at(bool by_city, int position) {
+  return by_city ? timezone_city(timezone_city_order[position])
+                 : timezone_name(position);
+}
+
+// First position in [first, last) whose key does not sort before `query`
+// (`or_after` false) or after it (true)
+static int bound(bool by_city, int first, int last, const char *query,
+                 bool or_after) {
+  while (first < last) {
+    int middle = first + (last - first) / 2;
+    int order = compare_prefix(key_at(by_city, middle), query);
+    if (order < 0 || (or_after && order == 0)) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+int timezone_find(const char *name) {
+  // A name sorts before every longer name it is a prefix of
+  int zone = bound(false, 0, timezone_count, name, false);
+  if (zone < timezone_count && strcmp(timezone_name(zone), name) == 0) {
+    return zone;
+  }
+  return -1;
+}
+
+void timezone_format_offset(int32_t offset_minutes, char *out, size_t size) {
+  int32_t magnitude = abs(offset_minutes);
+  snprintf(out, size, "UTC%c%02ld:%02ld", offset_minutes < 0 ? '-' : '+',
+           (long)(magnitude / 60), (long)(magnitude % 60));
+}
+
+void timezone_search_reset(TimezoneSearch *search) {
+  search->query[0] = '\0';
+  search->by_city = false;
+  search->first = 0;
+  search->count = timezone_count;
+}
+
+void timezone_search_update(TimezoneSearch *search, const char *query) {
+  bool by_city = strchr(query, '/') == nullptr;
+  size_t previous_length = strlen(search->query);
+  if (strlen(query) >= sizeof(search->query)) {
+    // Longer than any zone name. Forget the query too, so shortening it
+    // again searches from scratch.
+    search->query[0] = '\0';
+    search->first = 0;
+    search->count = 0;
+    return;
+  }
+
+  int first = 0;
+  int last = timezone_count;
+  if (by_city == search->by_city && previous_length > 0 &&
+      compare_prefix(query, search->query) == 0) {
+    // Narrowing: the new matches are a subset of the current ones
+    first = search->first;
+    last = search->first + search->count;
+  } else {
+    int letter = search_key(query[0]) - 'a';
+    if (letter >= 0 && letter < 26) {
+      const uint16_t *index = by_city ? timezone_city_index : timezone_name_index;
+      first = index[letter];
+      last = index[letter + 1];
+    }
+  }
+
+  strcpy(search->query, query);
+  search->by_city = by_city;
+  if (!query[0]) {
+    timezone_search_reset(search);
+    return;
+  }
+  first = bound(by_city, first, last, query, false);
+  last = bound(by_city, first, last, query, true);
+  search->first = (uint16_t)first;
+  search->count = (uint16_t)(last - first);
+}
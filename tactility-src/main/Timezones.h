@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// The IANA zone table, generated into flash by generate_timezones.py
+// (TimezoneData.cpp). Zones are sorted by name; timezone_city_order lists them
+// sorted by city. Both orders are sorted by the search key: ASCII lower case
+// with '_' read as a space.
+struct TimezoneInfo {
+  uint16_t name;          // Offset into timezone_pool
+  uint8_t city;           // Offset of the city within the name
+  int16_t offset_minutes; // Standard time, east of UTC
+  uint16_t rule;          // Offset of the POSIX TZ rule in timezone_pool
+};
+
+extern const char timezone_pool[];
+extern const TimezoneInfo timezones[];
+extern const uint16_t timezone_count;
+extern const uint16_t timezone_city_order[];
+// Start of each first letter a..z in either order; entry 26 is the count
+extern const uint16_t timezone_name_index[27];
+extern const uint16_t timezone_city_index[27];
+
+inline const char *timezone_name(int zone) {
+  return timezone_pool + timezones[zone].name;
+}
+
+// "New_York" for "America/New_York"
+inline const char *timezone_city(int zone) {
+  return timezone_name(zone) + timezones[zone].city;
+}
+
+// e.g. "EST5EDT,M3.2.0,M11.1.0" for "America/New_York"
+inline const char *timezone_rule(int zone) {
+  return timezone_pool + timezones[zone].rule;
+}
+
+// Zone with the IANA name `name`, or -1
+int timezone_find(const char *name);
+
+// e.g. "UTC+05:30"
+void timezone_format_offset(int32_t offset_minutes, char *out, size_t size);
+
+// Prefix search. Without a '/' the query matches cities, otherwise full
+// names, so the matches are always one contiguous run of one order and the
+// result list can be read by position without copying it. A query that
+// extends the previous one only searches within the previous matches.
+struct TimezoneSearch {
+  char query[32];
+  bool by_city;
+  uint16_t first; // Position in the searched order
+  uint16_t count;
+};
+
+// Match everything, in name order
+void timezone_search_reset(TimezoneSearch *search);
+
+// A query longer than any zone name matches nothing
+void timezone_search_update(TimezoneSearch *search, const char *query);
+
+// Zone of the `index`th match
+inline int timezone_search_get(const TimezoneSearch *search, int index) {
+  int position = search->first + index;
+  return search->by_city ? timezone_city_order[position] : position;
+}
@@ -0,0 +1,147 @@
+#include "WeatherFetch.h"
+
+#include "HttpFetch.h"
+#include "JsonStream.h"
+
+#include <esp_log.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+
+constexpr auto *TAG = "Weather";
+
+constexpr int HTTP_TIMEOUT_MS = 10000;
+constexpr int READ_CHUNK_SIZE = 256;
+
+// Validators on the response being read. A redirect is a response of its
+// own, so they are cleared whenever a request goes out, and fetch() keeps
+// them only from a final 200 that parses.
+struct WeatherHeaders {
+  char etag[WEATHER_VALIDATOR_SIZE];
+  char last_modified[WEATHER_VALIDATOR_SIZE];
+};
+
+struct WeatherParse {
+  const WeatherConfig *config;
+  WeatherReading *reading;
+};
+
+static esp_err_t header_event_cb(esp_http_client_event_t *evt) {
+  auto *headers = static_cast<WeatherHeaders *>(evt->user_data);
+  if (evt->event_id == HTTP_EVENT_HEADERS_SENT) {
+    *headers = {};
+    return ESP_OK;
+  }
+  if (evt->event_id != HTTP_EVENT_ON_HEADER) {
+    return ESP_OK;
+  }
+  if (strcasecmp(evt->header_key, "ETag") == 0) {
+    snprintf(headers->etag, sizeof(headers->etag), "%s", evt->header_value);
+  } else if (strcasecmp(evt->header_key, "Last-Modified") == 0) {
+    snprintf(headers->last_modified, sizeof(headers->last_modified), "%s",
+             evt->header_value);
+  }
+  return ESP_OK;
+}
+
+static void weather_value_cb(const char *path, JsonValueType type,
+                             const char *text, void *user_data) {
+  auto *parse = static_cast<WeatherParse *>(user_data);
+  if (type != JsonValueNumber) {
+    return;
+  }
+  if (strcmp(path, parse->config->temperature_path) == 0) {
+    parse->reading->temperature = strtof(text, nullptr);
+    parse->reading->has_temperature = true;
+  } else if (strcmp(path, parse->config->code_path) == 0) {
+    parse->reading->code = (int32_t)strtol(text, nullptr, 10);
+  }
+}
+
+// Streams the body through the tokenizer; nothing is buffered beyond one chunk
+static bool read_body(esp_http_client_handle_t client, WeatherFetch *fetch,
+                      WeatherReading *reading) {
+  WeatherParse parse = {&fetch->config, reading};
+  JsonStream stream;
+  json_stream_init(&stream, weather_value_cb, &parse);
+  char chunk[READ_CHUNK_SIZE];
+  while (!*fetch->stop) {
+    int length = esp_http_client_read(client, chunk, sizeof(chunk));
+    if (length < 0) {
+      ESP_LOGW(TAG, "Read failed");
+      return false;
+    }
+    if (length == 0) {
+      break;
+    }
+    if (!json_stream_feed(&stream, chunk, (size_t)length)) {
+      break;
+    }
+  }
+  if (*fetch->stop) {
+    return false;
+  }
+  if (!json_stream_finish(&stream)) {
+    ESP_LOGW(TAG, "Malformed response (error %d)", (int)stream.error);
+    return false;
+  }
+  if (!reading->has_temperature) {
+    ESP_LOGW(TAG, "Response has no %s", fetch->config.temperature_path);
+    return false;
+  }
+  return true;
+}
+
+void weather_fetch_init(WeatherFetch *fetch, const WeatherConfig &config,
+                        const std::atomic<bool> *stop) {
+  *fetch = {};
+  fetch->config = config;
+  fetch->stop = stop;
+  fetch_schedule_init(&fetch->schedule);
+}
+
+FetchResult weather_fetch(WeatherFetch *fetch, WeatherReading *reading) {
+  *reading = {false, 0.0f, -1};
+  WeatherHeaders headers = {};
+  esp_http_client_config_t http_config;
+  http_config_init(&http_config, fetch->config.url, HTTP_TIMEOUT_MS);
+  http_config.event_handler = header_event_cb;
+  http_config.user_data = &headers;
+
+  esp_http_client_handle_t client = esp_http_client_init(&http_config);
+  if (!client) {
+    return FetchFailed;
+  }
+  if (fetch->etag[0]) {
+    esp_http_client_set_header(client, "If-None-Match", fetch->etag);
+  }
+  if (fetch->last_modified[0]) {
+    esp_http_client_set_header(client, "If-Modified-Since",
+                               fetch->last_modified);
+  }
+
+  FetchResult result = FetchFailed;
+  int status = http_open(client, TAG);
+  if (status == 304) {
+    result = FetchNotModified;
+  } else if (status == 200) {
+    if (read_body(client, fetch, reading)) {
+      memcpy(fetch->etag, headers.etag, sizeof(fetch->etag));
+      memcpy(fetch->last_modified, headers.last_modified,
+             sizeof(fetch->last_modified));
+      result = FetchUpdated;
+    }
+  } else if (status > 0) {
+    ESP_LOGW(TAG, "HTTP status %d", status);
+  }
+  esp_http_client_close(client);
+  esp_http_client_cleanup(client);
+  return result;
+}
+
+uint32_t weather_fetch_next(WeatherFetch *fetch, FetchResult result) {
+  return fetch_schedule_next(&fetch->schedule, result,
+                             fetch->config.interval_s);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "FetchSchedule.h"
+#include "WeatherService.h"
+
+#include <atomic>
+
+// One weather fetch and its schedule, without the task around it: a
+// conditional GET, the body streamed through the tokenizer, and the
+// validators to send next time. Needs only the HTTP client, so it builds on
+// a host against a stand-in client.
+constexpr int WEATHER_VALIDATOR_SIZE = 64;
+
+struct WeatherFetch {
+  WeatherConfig config;
+  // From the last 200 that parsed; sent as If-None-Match / If-Modified-Since
+  char etag[WEATHER_VALIDATOR_SIZE];
+  char last_modified[WEATHER_VALIDATOR_SIZE];
+  FetchSchedule schedule;
+  const std::atomic<bool> *stop; // Abandons a body being read once set
+};
+
+struct WeatherReading {
+  bool has_temperature;
+  float temperature;
+  int32_t code; // -1 when absent
+};
+
+void weather_fetch_init(WeatherFetch *fetch, const WeatherConfig &config,
+                        const std::atomic<bool> *stop);
+
+// `reading` is filled for FetchUpdated only
+FetchResult weather_fetch(WeatherFetch *fetch, WeatherReading *reading);
+
+// Seconds until the next fetch after `result`: the configured interval, or
+// backing off while fetches fail
+uint32_t weather_fetch_next(WeatherFetch *fetch, FetchResult result);
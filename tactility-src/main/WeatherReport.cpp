@@ -0,0 +1,47 @@
+#include "WeatherService.h"
+
+// The parts of the weather service without ESP-IDF dependencies
+
+void weather_report_apply(WeatherReport *report, FetchResult result,
+                          float temperature, int32_t code, time_t now) {
+  if (result == FetchFailed) {
+    return;
+  }
+  if (result == FetchUpdated &&
+      (!report->valid || report->temperature != temperature ||
+       report->code != code)) {
+    report->valid = true;
+    report->temperature = temperature;
+    report->code = code;
+    report->version++;
+  }
+  report->fetched_at = now;
+}
+
+const char *weather_code_text(int32_t code) {
+  if (code == 0) {
+    return "Clear";
+  }
+  if (code >= 1 && code <= 2) {
+    return "Partly cloudy";
+  }
+  if (code == 3) {
+    return "Overcast";
+  }
+  if (code == 45 || code == 48) {
+    return "Fog";
+  }
+  if (code >= 51 && code <= 57) {
+    return "Drizzle";
+  }
+  if ((code >= 61 && code <= 67) || (code >= 80 && code <= 82)) {
+    return "Rain";
+  }
+  if ((code >= 71 && code <= 77) || code == 85 || code == 86) {
+    return "Snow";
+  }
+  if (code >= 95 && code <= 99) {
+    return "Storm";
+  }
+  return "";
+}
@@ -0,0 +1,75 @@
+#include "WeatherService.h"
+
+#include "ServiceTask.h"
+#include "WeatherFetch.h"
+
+#include <esp_log.h>
+
+#include <new>
+
+constexpr auto *TAG = "Weather";
+
+static SemaphoreHandle_t report_mutex;
+static WeatherReport report = {false, 0.0f, -1, 0, 0};
+static ServiceTask worker;
+
+static void publish(FetchResult result, const WeatherReading &reading,
+                    time_t now) {
+  xSemaphoreTake(report_mutex, portMAX_DELAY);
+  weather_report_apply(&report, result, reading.temperature, reading.code,
+                       now);
+  xSemaphoreGive(report_mutex);
+}
+
+// The task owns its WeatherFetch and frees it on exit
+static void weather_task(void *param) {
+  auto *fetch = static_cast<WeatherFetch *>(param);
+  while (!worker.stop) {
+    WeatherReading reading;
+    FetchResult result = weather_fetch(fetch, &reading);
+    publish(result, reading, time(nullptr));
+    uint32_t delay_s = weather_fetch_next(fetch, result);
+    ESP_LOGD(TAG, "Next fetch in %u s", (unsigned)delay_s);
+    // Woken early by weather_service_stop()
+    service_task_sleep(&worker, delay_s * 1000);
+  }
+  delete fetch;
+  service_task_exit(&worker);
+}
+
+bool weather_service_start(const WeatherConfig &config) {
+  weather_service_stop();
+  if (!config.url[0]) {
+    return false;
+  }
+  if (!report_mutex) {
+    report_mutex = xSemaphoreCreateMutex();
+    if (!report_mutex) {
+      return false;
+    }
+  }
+
+  auto *fetch = new (std::nothrow) WeatherFetch();
+  if (!fetch) {
+    return false;
+  }
+  weather_fetch_init(fetch, config, &worker.stop);
+  if (!service_task_start(&worker, weather_task, "weather", 6144,
+                          tskIDLE_PRIORITY + 1, tskNO_AFFINITY, fetch)) {
+    delete fetch;
+    return false;
+  }
+  return true;
+}
+
+void weather_service_stop() { service_task_stop(&worker); }
+
+void weather_service_get(WeatherReport *out) {
+  if (!report_mutex) {
+    *out = report;
+    return;
+  }
+  xSemaphoreTake(report_mutex, portMAX_DELAY);
+  *out = report;
+  xSemaphoreGive(report_mutex);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "FetchSchedule.h"
+#include "JsonStream.h"
+
+#include <cstdint>
+#include <ctime>
+
+constexpr int WEATHER_URL_SIZE = 160;
+
+// Where to fetch from and which JSON values to read. The defaults match the
+// Open-Meteo "current" response, but any endpoint returning a temperature and
+// a WMO weather code works.
+struct WeatherConfig {
+  char url[WEATHER_URL_SIZE];
+  char temperature_path[JSON_MAX_PATH];
+  char code_path[JSON_MAX_PATH];
+  uint32_t interval_s;
+};
+
+struct WeatherReport {
+  bool valid;
+  float temperature;
+  int32_t code; // WMO weather interpretation code, -1 when absent
+  time_t fetched_at;
+  uint32_t version; // Bumped whenever the report changes
+};
+
+// Fetches in a background task. Responses are parsed while they stream in,
+// repeat requests are conditional (ETag / Last-Modified) and failures back off
+// exponentially from one minute up to an hour.
+bool weather_service_start(const WeatherConfig &config);
+
+// Returns once the fetch task has exited
+void weather_service_stop();
+
+// Copies the latest report; safe from any task
+void weather_service_get(WeatherReport *report);
+
+// Applies one fetch to `report`: a new reading bumps the version only when it
+// differs, a 304 only refreshes fetched_at and a failure changes nothing.
+// `temperature` and `code` are read for FetchUpdated only.
+void weather_report_apply(WeatherReport *report, FetchResult result,
+                          float temperature, int32_t code, time_t now);
+
+// Short description of a WMO weather code
+const char *weather_code_text(int32_t code);
@@ -0,0 +1,62 @@
+#include "WifiPrompt.h"
+
+void wifi_prompt_create(WifiPrompt *prompt, lv_obj_t *parent,
+                        const ClockLayout *layout, lv_event_cb_t on_connect,
+                        void *user_data) {
+  // Create a card-style container for the WiFi prompt
+  lv_obj_t *card = lv_obj_create(parent);
+  prompt->card = card;
+  lv_obj_set_size(card, LV_PCT(90), LV_SIZE_CONTENT);
+  lv_obj_set_style_radius(card, layout->card_radius, 0);
+  lv_obj_set_layout(card, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(card, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_flex_align(card, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER,
+                        LV_FLEX_ALIGN_CENTER);
+  lv_obj_set_style_bg_color(card, lv_color_hex(0x333333), 0);
+  lv_obj_set_style_bg_opa(card, LV_OPA_10, 0);
+  lv_obj_set_style_border_width(card, 1, 0);
+  lv_obj_set_style_border_color(card, lv_color_hex(0x666666), 0);
+  lv_obj_set_style_border_opa(card, LV_OPA_30, 0);
+  lv_obj_set_style_pad_all(card, layout->card_padding, 0);
+  lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+
+  // WiFi icon
+  lv_obj_t *icon = lv_label_create(card);
+  lv_label_set_text(icon, LV_SYMBOL_WIFI);
+  lv_obj_align(icon, LV_ALIGN_TOP_MID, 0, 0);
+  lv_obj_set_style_text_font(icon, lv_font_get_default(), 0);
+  lv_obj_set_style_text_color(icon, lv_color_hex(0xFF9500), 0);
+
+  // Title
+  lv_obj_t *title = lv_label_create(card);
+  prompt->title = title;
+  lv_label_set_text(title, "Time Not Synced");
+  lv_obj_align_to(title, icon, LV_ALIGN_OUT_BOTTOM_MID, 0, layout->title_gap);
+  lv_obj_set_style_text_font(title, lv_font_get_default(), 0);
+  lv_obj_set_style_text_align(title, LV_TEXT_ALIGN_CENTER, 0);
+
+  // Subtitle
+  lv_obj_t *subtitle = lv_label_create(card);
+  lv_label_set_text(subtitle, "Connect to Wi-Fi to sync time");
+  lv_obj_align_to(subtitle, title, LV_ALIGN_OUT_BOTTOM_MID, 0, 4);
+  lv_obj_set_style_text_font(subtitle, lv_font_get_default(), 0);
+  lv_obj_set_style_text_color(subtitle, lv_color_hex(0x888888), 0);
+  lv_obj_set_style_text_align(subtitle, LV_TEXT_ALIGN_CENTER, 0);
+
+  // Connect button
+  lv_obj_t *button = lv_btn_create(card);
+  prompt->button = button;
+  lv_obj_set_size(button, LV_PCT(80), layout->button_height);
+  lv_obj_align_to(button, subtitle, LV_ALIGN_OUT_BOTTOM_MID, 0,
+                  layout->button_gap);
+  lv_obj_set_style_radius(button, layout->button_radius, 0);
+  lv_obj_set_style_bg_color(button, lv_color_hex(0x007BFF), 0);
+
+  lv_obj_t *button_label = lv_label_create(button);
+  lv_label_set_text(button_label, "Connect to Wi-Fi");
+  lv_obj_center(button_label);
+  lv_obj_set_style_text_font(button_label, lv_font_get_default(), 0);
+  lv_obj_set_style_text_color(button_label, lv_color_hex(0xFFFFFF), 0);
+
+  lv_obj_add_event_cb(button, on_connect, LV_EVENT_CLICKED, user_data);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "ClockLayout.h"
+
+#include <lvgl.h>
+
+// Card shown instead of a face until the clock is synced: an icon, a title,
+// a hint and a button that opens the Wi-Fi settings
+struct WifiPrompt {
+  lv_obj_t *card;
+  lv_obj_t *title; // The app puts the sync status here
+  lv_obj_t *button;
+};
+
+// `on_connect` gets LV_EVENT_CLICKED from the button with `user_data`
+void wifi_prompt_create(WifiPrompt *prompt, lv_obj_t *parent,
+                        const ClockLayout *layout, lv_event_cb_t on_connect,
+                        void *user_data);
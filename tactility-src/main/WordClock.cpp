@@ -0,0 +1,191 @@
+#include "WordClock.h"
+
+static const char *const letters[WORD_CLOCK_ROWS] = {
+    "ITLISASAMPM",
+    "ACQUARTERDC",
+    "TWENTYFIVEX",
+    "HALFSTENFTO",
+    "PASTERUNINE",
+    "ONESIXTHREE",
+    "FOURFIVETWO",
+    "EIGHTELEVEN",
+    "SEVENTWELVE",
+    "TENSEOCLOCK",
+};
+
+// Null-terminated single letters for lv_draw_label
+static const char letter_text[26][2] = {
+    "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M",
+    "N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z",
+};
+
+struct Word {
+  uint8_t row;
+  uint8_t column;
+  uint8_t length;
+};
+
+constexpr Word WORD_IT = {0, 0, 2};
+constexpr Word WORD_IS = {0, 3, 2};
+constexpr Word WORD_A = {1, 0, 1};
+constexpr Word WORD_QUARTER = {1, 2, 7};
+constexpr Word WORD_TWENTY = {2, 0, 6};
+constexpr Word WORD_FIVE_MINUTES = {2, 6, 4};
+constexpr Word WORD_HALF = {3, 0, 4};
+constexpr Word WORD_TEN_MINUTES = {3, 5, 3};
+constexpr Word WORD_TO = {3, 9, 2};
+constexpr Word WORD_PAST = {4, 0, 4};
+constexpr Word WORD_OCLOCK = {9, 5, 6};
+constexpr Word NO_WORD = {0, 0, 0};
+
+// Indexed by hour % 12
+constexpr Word hour_words[12] = {
+    {8, 5, 6}, // TWELVE
+    {5, 0, 3}, // ONE
+    {6, 8, 3}, // TWO
+    {5, 6, 5}, // THREE
+    {6, 0, 4}, // FOUR
+    {6, 4, 4}, // FIVE
+    {5, 3, 3}, // SIX
+    {8, 0, 5}, // SEVEN
+    {7, 0, 5}, // EIGHT
+    {4, 7, 4}, // NINE
+    {9, 0, 3}, // TEN
+    {7, 5, 6}, // ELEVEN
+};
+
+// Indexed by minute / 5. From 35 past on the phrase refers to the next hour.
+struct Phrase {
+  Word words[3];
+  bool next_hour;
+};
+
+constexpr Phrase phrases[12] = {
+    {{WORD_OCLOCK, NO_WORD, NO_WORD}, false},
+    {{WORD_FIVE_MINUTES, WORD_PAST, NO_WORD}, false},
+    {{WORD_TEN_MINUTES, WORD_PAST, NO_WORD}, false},
+    {{WORD_A, WORD_QUARTER, WORD_PAST}, false},
+    {{WORD_TWENTY, WORD_PAST, NO_WORD}, false},
+    {{WORD_TWENTY, WORD_FIVE_MINUTES, WORD_PAST}, false},
+    {{WORD_HALF, WORD_PAST, NO_WORD}, false},
+    {{WORD_TWENTY, WORD_FIVE_MINUTES, WORD_TO}, true},
+    {{WORD_TWENTY, WORD_TO, NO_WORD}, true},
+    {{WORD_A, WORD_QUARTER, WORD_TO}, true},
+    {{WORD_TEN_MINUTES, WORD_TO, NO_WORD}, true},
+    {{WORD_FIVE_MINUTES, WORD_TO, NO_WORD}, true},
+};
+
+constexpr int MASK_COUNT = 12 * 12;
+
+struct MaskTable {
+  uint16_t rows[MASK_COUNT][WORD_CLOCK_ROWS];
+};
+
+constexpr void light_word(uint16_t *rows, Word word) {
+  for (int i = 0; i < word.length; i++) {
+    rows[word.row] |= (uint16_t)(1u << (word.column + i));
+  }
+}
+
+constexpr MaskTable build_mask_table() {
+  MaskTable table = {};
+  for (int hour = 0; hour < 12; hour++) {
+    for (int interval = 0; interval < 12; interval++) {
+      uint16_t *rows = table.rows[hour * 12 + interval];
+      const Phrase &phrase = phrases[interval];
+      light_word(rows, WORD_IT);
+      light_word(rows, WORD_IS);
+      for (const Word &word : phrase.words) {
+        light_word(rows, word);
+      }
+      light_word(rows, hour_words[(hour + (phrase.next_hour ? 1 : 0)) % 12]);
+    }
+  }
+  return table;
+}
+
+// Evaluated at compile time and placed in flash
+static constexpr MaskTable mask_table = build_mask_table();
+
+static void grid_draw_cb(lv_event_t *e) {
+  auto *clock = static_cast<WordClock *>(lv_event_get_user_data(e));
+  if (!clock->layout || !clock->lit) {
+    return;
+  }
+
+  lv_layer_t *layer = lv_event_get_layer(e);
+  lv_area_t coords;
+  lv_obj_get_coords(clock->grid, &coords);
+  lv_coord_t cell_width = clock->layout->word_cell_width;
+  lv_coord_t cell_height = clock->layout->word_cell_height;
+  const lv_font_t *font = lv_font_get_default();
+  lv_coord_t text_offset = (cell_height - lv_font_get_line_height(font)) / 2;
+
+  lv_draw_label_dsc_t dsc;
+  lv_draw_label_dsc_init(&dsc);
+  dsc.font = font;
+  dsc.align = LV_TEXT_ALIGN_CENTER;
+
+  for (int row = 0; row < WORD_CLOCK_ROWS; row++) {
+    for (int column = 0; column < WORD_CLOCK_COLUMNS; column++) {
+      bool lit = clock->lit[row] & (1u << column);
+      dsc.color = lv_color_hex(lit ? 0xFFFFFF : 0x333333);
+      dsc.text = letter_text[letters[row][column] - 'A'];
+      lv_area_t cell = {
+          coords.x1 + column * cell_width,
+          coords.y1 + row * cell_height + text_offset,
+          coords.x1 + (column + 1) * cell_width - 1,
+          coords.y1 + (row + 1) * cell_height - 1,
+      };
+      lv_draw_label(layer, &dsc, &cell);
+    }
+  }
+}
+
+void word_clock_create(WordClock *clock, lv_obj_t *parent) {
+  *clock = {};
+  clock->shown_index = -1;
+
+  lv_obj_t *grid = lv_obj_create(parent);
+  clock->grid = grid;
+  lv_obj_remove_style_all(grid);
+  lv_obj_clear_flag(grid, LV_OBJ_FLAG_SCROLLABLE);
+  // Let presses reach the container so the carousel can be swiped
+  lv_obj_clear_flag(grid, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_event_cb(grid, grid_draw_cb, LV_EVENT_DRAW_MAIN, clock);
+}
+
+void word_clock_apply_layout(WordClock *clock, const ClockLayout *layout) {
+  clock->layout = layout;
+  lv_obj_set_size(clock->grid, WORD_CLOCK_COLUMNS * layout->word_cell_width,
+                  WORD_CLOCK_ROWS * layout->word_cell_height);
+  lv_obj_invalidate(clock->grid);
+}
+
+void word_clock_set_time(WordClock *clock, int hour, int minute) {
+  int index = (hour % 12) * 12 + minute / 5;
+  if (index == clock->shown_index) {
+    return;
+  }
+  const uint16_t *previous = clock->lit;
+  clock->shown_index = index;
+  clock->lit = mask_table.rows[index];
+
+  if (!previous || !clock->layout) {
+    lv_obj_invalidate(clock->grid);
+    return;
+  }
+
+  // Only the rows whose letters changed need to be redrawn
+  lv_area_t coords;
+  lv_obj_get_coords(clock->grid, &coords);
+  lv_coord_t cell_height = clock->layout->word_cell_height;
+  for (int row = 0; row < WORD_CLOCK_ROWS; row++) {
+    if (previous[row] == clock->lit[row]) {
+      continue;
+    }
+    lv_area_t area = {coords.x1, coords.y1 + row * cell_height, coords.x2,
+                      coords.y1 + (row + 1) * cell_height - 1};
+    lv_obj_invalidate_area(clock->grid, &area);
+  }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ClockLayout.h"
+
+#include <lvgl.h>
+
+#include <cstdint>
+
+constexpr int WORD_CLOCK_ROWS = 10;
+constexpr int WORD_CLOCK_COLUMNS = 11;
+
+// "IT IS TWENTY FIVE PAST TEN" on an 11 x 10 letter grid. Every (hour,
+// 5-minute interval) pair has a precomputed lit-letter mask in flash with one
+// bit per letter. The grid is a single object drawn in one DRAW_MAIN pass;
+// a time change invalidates only the rows whose mask changed.
+struct WordClock {
+  lv_obj_t *grid;
+  const ClockLayout *layout;
+  const uint16_t *lit; // One row mask per grid row, bit n = column n
+  int shown_index;     // Table index on display, -1 before the first update
+};
+
+void word_clock_create(WordClock *clock, lv_obj_t *parent);
+
+void word_clock_apply_layout(WordClock *clock, const ClockLayout *layout);
+
+// Rounds down to the 5-minute interval; only redraws when it changes
+void word_clock_set_time(WordClock *clock, int hour, int minute);
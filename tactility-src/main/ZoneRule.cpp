@@ -0,0 +1,232 @@
+#include "ZoneRule.h"
+
+constexpr int32_t HOUR_S = 3600;
+constexpr int32_t DAY_S = 24 * HOUR_S;
+
+static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+static bool is_alpha(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Zone abbreviation: three or more letters, or anything in angle brackets
+static bool parse_name(const char **text) {
+  const char *c = *text;
+  if (*c == '<') {
+    for (c++; *c && *c != '>'; c++) {
+    }
+    if (*c != '>' || c - *text < 4) {
+      return false;
+    }
+    *text = c + 1;
+    return true;
+  }
+  while (is_alpha(*c)) {
+    c++;
+  }
+  if (c - *text < 3) {
+    return false;
+  }
+  *text = c;
+  return true;
+}
+
+static bool parse_number(const char **text, int32_t max, int32_t *value) {
+  if (!is_digit(**text)) {
+    return false;
+  }
+  int32_t result = 0;
+  for (; is_digit(**text); (*text)++) {
+    result = result * 10 + (**text - '0');
+    if (result > max) {
+      return false;
+    }
+  }
+  *value = result;
+  return true;
+}
+
+// [+-]hh[:mm[:ss]] in seconds
+static bool parse_time(const char **text, int32_t max_hours, int32_t *value) {
+  int32_t sign = 1;
+  if (**text == '+' || **text == '-') {
+    sign = **text == '-' ? -1 : 1;
+    (*text)++;
+  }
+  int32_t hours;
+  int32_t minutes = 0;
+  int32_t seconds = 0;
+  if (!parse_number(text, max_hours, &hours)) {
+    return false;
+  }
+  if (**text == ':') {
+    (*text)++;
+    if (!parse_number(text, 59, &minutes)) {
+      return false;
+    }
+    if (**text == ':') {
+      (*text)++;
+      if (!parse_number(text, 59, &seconds)) {
+        return false;
+      }
+    }
+  }
+  *value = sign * (hours * HOUR_S + minutes * 60 + seconds);
+  return true;
+}
+
+static bool parse_date(const char **text, ZoneRuleDate *date) {
+  int32_t value;
+  if (**text == 'M') {
+    int32_t week;
+    int32_t weekday;
+    (*text)++;
+    if (!parse_number(text, 12, &value) || value < 1 || **text != '.') {
+      return false;
+    }
+    (*text)++;
+    if (!parse_number(text, 5, &week) || week < 1 || **text != '.') {
+      return false;
+    }
+    (*text)++;
+    if (!parse_number(text, 6, &weekday)) {
+      return false;
+    }
+    date->kind = ZoneRuleMonthWeek;
+    date->month = (uint8_t)value;
+    date->week = (uint8_t)week;
+    date->weekday = (uint8_t)weekday;
+  } else if (**text == 'J') {
+    (*text)++;
+    if (!parse_number(text, 365, &value) || value < 1) {
+      return false;
+    }
+    date->kind = ZoneRuleJulian;
+    date->day = (uint16_t)value;
+  } else {
+    if (!parse_number(text, 365, &value)) {
+      return false;
+    }
+    date->kind = ZoneRuleDayOfYear;
+    date->day = (uint16_t)value;
+  }
+  date->time_s = 2 * HOUR_S;
+  if (**text == '/') {
+    (*text)++;
+    return parse_time(text, 167, &date->time_s);
+  }
+  return true;
+}
+
+bool zone_rule_parse(const char *text, ZoneRule *rule) {
+  ZoneRule result = {};
+  int32_t offset;
+  if (!parse_name(&text) || !parse_time(&text, 24, &offset)) {
+    return false;
+  }
+  result.standard_offset_s = -offset;
+  if (!*text) {
+    *rule = result;
+    return true;
+  }
+
+  if (!parse_name(&text)) {
+    return false;
+  }
+  result.has_daylight = true;
+  result.daylight_offset_s = result.standard_offset_s + HOUR_S;
+  if (*text && *text != ',') {
+    if (!parse_time(&text, 24, &offset)) {
+      return false;
+    }
+    result.daylight_offset_s = -offset;
+  }
+  if (!*text) {
+    // No dates: the US rules, as POSIX leaves it to the implementation
+    result.start = {ZoneRuleMonthWeek, 3, 2, 0, 0, 2 * HOUR_S};
+    result.end = {ZoneRuleMonthWeek, 11, 1, 0, 0, 2 * HOUR_S};
+  } else if (*text++ != ',' || !parse_date(&text, &result.start) ||
+             *text++ != ',' || !parse_date(&text, &result.end) || *text) {
+    return false;
+  }
+  *rule = result;
+  return true;
+}
+
+void zone_rule_fixed(ZoneRule *rule, int32_t offset_s) {
+  *rule = {};
+  rule->standard_offset_s = offset_s;
+}
+
+static bool is_leap(int64_t year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+// Days since 1970-01-01 of a proleptic Gregorian date
+static int64_t days_from_civil(int64_t year, int32_t month, int32_t day) {
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t year_of_era = year - era * 400;
+  int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int64_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+static int64_t year_of(int64_t days) {
+  days += 719468;
+  int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  int64_t day_of_era = days - era * 146097;
+  int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 -
+                         day_of_era / 146096) /
+                        365;
+  int64_t day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  int64_t month_index = (5 * day_of_year + 2) / 153;
+  return year_of_era + era * 400 + (month_index >= 10);
+}
+
+// Seconds since the epoch of `date` in `year`, as a local time
+static int64_t local_time_of(const ZoneRuleDate &date, int64_t year) {
+  int64_t days = days_from_civil(year, 1, 1);
+  switch (date.kind) {
+  case ZoneRuleJulian:
+    days += date.day - 1 + (is_leap(year) && date.day >= 60);
+    break;
+  case ZoneRuleDayOfYear:
+    days += date.day;
+    break;
+  case ZoneRuleMonthWeek: {
+    static const int32_t month_days[12] = {31, 28, 31, 30, 31, 30,
+                                           31, 31, 30, 31, 30, 31};
+    int64_t first = days_from_civil(year, date.month, 1);
+    // 1970-01-01 was a Thursday
+    auto first_weekday = (int32_t)(((first + 4) % 7 + 7) % 7);
+    int32_t day = 1 + (date.weekday - first_weekday + 7) % 7 +
+                  (date.week - 1) * 7;
+    int32_t length = month_days[date.month - 1] +
+                     (date.month == 2 && is_leap(year) ? 1 : 0);
+    while (day > length) {
+      day -= 7;
+    }
+    days = first + day - 1;
+    break;
+  }
+  }
+  return days * DAY_S + date.time_s;
+}
+
+int32_t zone_rule_offset(const ZoneRule &rule, time_t utc) {
+  if (!rule.has_daylight) {
+    return rule.standard_offset_s;
+  }
+  auto standard = (int64_t)utc + rule.standard_offset_s;
+  int64_t year = year_of(standard >= 0 ? standard / DAY_S
+                                       : (standard - DAY_S + 1) / DAY_S);
+  int64_t start = local_time_of(rule.start, year) - rule.standard_offset_s;
+  int64_t end = local_time_of(rule.end, year) - rule.daylight_offset_s;
+  auto now = (int64_t)utc;
+  bool in_daylight = start < end ? (now >= start && now < end)
+                                 : (now < end || now >= start);
+  return in_daylight ? rule.daylight_offset_s : rule.standard_offset_s;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <time.h>
+
+// A POSIX TZ rule such as "EST5EDT,M3.2.0,M11.1.0", as generate_timezones.py
+// stores one per zone. Evaluated directly rather than through setenv("TZ"),
+// which would change the device's own local time.
+enum ZoneRuleDateKind : uint8_t {
+  ZoneRuleJulian,    // Jn: day 1..365, February 29 never counted
+  ZoneRuleDayOfYear, // n: day 0..365
+  ZoneRuleMonthWeek, // Mm.w.d: weekday d of week w (5 = last) of month m
+};
+
+struct ZoneRuleDate {
+  ZoneRuleDateKind kind;
+  uint8_t month;   // 1..12
+  uint8_t week;    // 1..5
+  uint8_t weekday; // 0 = Sunday
+  uint16_t day;
+  int32_t time_s; // Local time of the change, may be negative or past 24 h
+};
+
+// Offsets are seconds east of UTC (the opposite sign to the TZ string). A
+// zeroed rule is UTC.
+struct ZoneRule {
+  int32_t standard_offset_s;
+  int32_t daylight_offset_s;
+  bool has_daylight;
+  ZoneRuleDate start; // Daylight time begins, in standard time
+  ZoneRuleDate end;   // and ends, in daylight time
+};
+
+// False when `text` is not a valid rule; `rule` is then left unchanged
+bool zone_rule_parse(const char *text, ZoneRule *rule);
+
+// A fixed offset without daylight saving time
+void zone_rule_fixed(ZoneRule *rule, int32_t offset_s);
+
+// Offset from UTC in effect at `utc`
+int32_t zone_rule_offset(const ZoneRule &rule, time_t utc);
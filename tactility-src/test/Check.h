@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdio>
+
+// Minimal assertions for the host tests: a failed check is reported and
+// counted, and the test's main returns check_result()
+
+inline int check_failures = 0;
+
+#define CHECK(condition)                                                       \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__,         \
+              #condition);                                                     \
+      check_failures++;                                                        \
+    }                                                                          \
+  } while (0)
+
+#define CHECK_EQ(actual, expected)                                             \
+  do {                                                                         \
+    long long actual_value = (long long)(actual);                              \
+    long long expected_value = (long long)(expected);                          \
+    if (actual_value != expected_value) {                                      \
+      fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__,          \
+              __LINE__, #actual, actual_value, expected_value);                \
+      check_failures++;                                                        \
+    }                                                                          \
+  } while (0)
+
+inline int check_result() {
+  if (check_failures) {
+    fprintf(stderr, "%d checks failed\n", check_failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,62 @@
+#include "Check.h"
+
+#include "ClockFrame.h"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+// The precompute thread's lifecycle: frames appear for the current second,
+// stopping joins and forgets them, and restarting never leaves two running
+
+static const ClockFrame *wait_for_frame() {
+  for (int i = 0; i < 300; i++) {
+    const ClockFrame *frame = clock_frame_get(time(nullptr));
+    if (frame) {
+      return frame;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return nullptr;
+}
+
+static void test_frames() {
+  const LocaleInfo *locale = locale_default();
+  CHECK(clock_frame_get(time(nullptr)) == nullptr);
+  CHECK(clock_frames_start(locale));
+
+  const ClockFrame *frame = wait_for_frame();
+  CHECK(frame != nullptr);
+  if (frame) {
+    ClockFrame expected;
+    clock_frame_compute(&expected, frame->second, locale);
+    CHECK(frame->locale == locale);
+    CHECK_EQ(frame->timeinfo.tm_sec, expected.timeinfo.tm_sec);
+    CHECK(strcmp(frame->texts.time_24, expected.texts.time_24) == 0);
+    CHECK(clock_frame_matching(frame->timeinfo) == frame);
+  }
+
+  clock_frames_stop();
+  CHECK(clock_frame_get(time(nullptr)) == nullptr);
+  // Stopping twice is harmless
+  clock_frames_stop();
+}
+
+static void test_restart() {
+  // Each start stops and joins the previous loop first
+  for (int i = 0; i < 200; i++) {
+    CHECK(clock_frames_start(locale_default()));
+  }
+  CHECK(wait_for_frame() != nullptr);
+  for (int i = 0; i < 200; i++) {
+    CHECK(clock_frames_start(locale_default()));
+    clock_frames_stop();
+  }
+  CHECK(clock_frame_get(time(nullptr)) == nullptr);
+}
+
+int main() {
+  test_frames();
+  test_restart();
+  return check_result();
+}
@@ -0,0 +1,325 @@
+#include "Check.h"
+
+#include "ClockWidget.h"
+#include "FaceHost.h"
+#include "LvglHost.h"
+#include "RleDecoder.h"
+#include "RleEncoder.h"
+#include "Timezones.h"
+#include "WifiPrompt.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Every face rendered at fixed times and container sizes and compared with
+// the reference frames in golden/, plus the Wi-Fi prompt. Frames come from
+// the host LVGL stand-in, so they approximate the device's rather than match
+// LVGL pixel for pixel; a small per-channel difference and a few differing
+// pixels are tolerated, so anti-aliasing and float noise across compilers do
+// not fail the test while a moved hand or missing label does.
+//
+// Run with --update to rewrite the goldens after an intended visual change.
+// Failing cases leave <name>_actual.ppm and <name>_diff.ppm in the working
+// directory. How long each face took to create, tick and render is printed
+// and written to face_render_times.csv, so a slower face shows up next to
+// the frames it drew.
+
+// 2024-03-09 23:58:47 UTC; the second frame crosses midnight, so dates,
+// hands and digits all change between the two
+constexpr time_t FIRST_TIME = 1710028727;
+constexpr time_t SECOND_TIME = FIRST_TIME + 265;
+constexpr int64_t UPTIME_US = 5LL * 3600 * 1000000 + 42LL * 60 * 1000000;
+
+// Per-channel difference a pixel may have and still match; covers the
+// golden's RGB565 rounding and anti-aliasing noise
+constexpr int CHANNEL_TOLERANCE = 24;
+// Share of pixels that may differ beyond that, in parts per ten thousand
+constexpr size_t DIFFERING_PER_10K = 2;
+
+// Containers of a 320 x 240 and a 480 x 320 display under the toolbar
+struct FrameSize {
+  int32_t width;
+  int32_t height;
+};
+
+constexpr FrameSize FRAME_SIZES[] = {{320, 218}, {480, 280}};
+
+static bool update_goldens = false;
+static FILE *times_file = nullptr;
+
+// Golden files use the TCIM format of convert_images.py: RGB565 pixels,
+// run-length encoded in 2-byte units
+constexpr uint8_t GOLDEN_VERSION = 1;
+constexpr uint8_t GOLDEN_COLOR_FORMAT = LV_COLOR_FORMAT_RGB565;
+constexpr size_t GOLDEN_HEADER_SIZE = 24;
+
+using Frame = std::vector<uint8_t>; // RGB888
+
+static std::string golden_path(const std::string &name) {
+  return std::string(GOLDEN_DIR) + "/" + name + ".bin";
+}
+
+static void put_u16(std::vector<uint8_t> *out, uint32_t value) {
+  out->push_back((uint8_t)(value & 0xFF));
+  out->push_back((uint8_t)((value >> 8) & 0xFF));
+}
+
+static void put_u32(std::vector<uint8_t> *out, uint32_t value) {
+  put_u16(out, value & 0xFFFF);
+  put_u16(out, value >> 16);
+}
+
+static uint32_t get_u16(const uint8_t *data) {
+  return (uint32_t)(data[0] | data[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t *data) {
+  return get_u16(data) | get_u16(data + 2) << 16;
+}
+
+static bool write_golden(const std::string &name, const Frame &frame,
+                         const FrameSize &size) {
+  std::vector<uint8_t> pixels(frame.size() / 3 * 2);
+  rgb565_pack(frame.data(), frame.size() / 3, 3, pixels.data());
+  std::vector<uint8_t> payload = rle_encode(pixels.data(), pixels.size(), 2);
+  auto width = (uint32_t)size.width;
+  std::vector<uint8_t> file = {'T', 'C', 'I', 'M', GOLDEN_VERSION,
+                               GOLDEN_COLOR_FORMAT, 2, 0};
+  put_u16(&file, width);
+  put_u16(&file, (uint32_t)size.height);
+  put_u16(&file, width * 2);
+  put_u16(&file, 0);
+  put_u32(&file, (uint32_t)pixels.size());
+  put_u32(&file, (uint32_t)payload.size());
+  file.insert(file.end(), payload.begin(), payload.end());
+
+  FILE *out = fopen(golden_path(name).c_str(), "wb");
+  if (!out) {
+    return false;
+  }
+  bool written = fwrite(file.data(), 1, file.size(), out) == file.size();
+  return fclose(out) == 0 && written;
+}
+
+// Returns an empty frame when the golden is missing or malformed
+static Frame read_golden(const std::string &name, const FrameSize &size) {
+  FILE *in = fopen(golden_path(name).c_str(), "rb");
+  if (!in) {
+    return {};
+  }
+  std::vector<uint8_t> file;
+  uint8_t chunk[4096];
+  size_t length;
+  while ((length = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+    file.insert(file.end(), chunk, chunk + length);
+  }
+  fclose(in);
+
+  const uint8_t *header = file.data();
+  auto pixel_count = (size_t)size.width * (size_t)size.height;
+  if (file.size() < GOLDEN_HEADER_SIZE || memcmp(header, "TCIM", 4) != 0 ||
+      header[5] != GOLDEN_COLOR_FORMAT || header[6] != 2 ||
+      get_u16(header + 8) != (uint32_t)size.width ||
+      get_u16(header + 10) != (uint32_t)size.height ||
+      get_u32(header + 16) != pixel_count * 2) {
+    return {};
+  }
+  std::vector<uint8_t> pixels(pixel_count * 2);
+  RleDecoder decoder;
+  rle_decoder_init(&decoder, pixels.data(), pixels.size(), 2);
+  rle_decode(&decoder, file.data() + GOLDEN_HEADER_SIZE,
+             file.size() - GOLDEN_HEADER_SIZE);
+  if (!rle_decoder_complete(&decoder)) {
+    return {};
+  }
+
+  Frame frame(pixel_count * 3);
+  for (size_t i = 0; i < pixel_count; i++) {
+    uint32_t value = get_u16(&pixels[i * 2]);
+    frame[i * 3] = (uint8_t)((value >> 11) * 255 / 31);
+    frame[i * 3 + 1] = (uint8_t)(((value >> 5) & 0x3F) * 255 / 63);
+    frame[i * 3 + 2] = (uint8_t)((value & 0x1F) * 255 / 31);
+  }
+  return frame;
+}
+
+static void write_ppm(const std::string &path, const Frame &frame,
+                      const FrameSize &size) {
+  FILE *out = fopen(path.c_str(), "wb");
+  if (out) {
+    fprintf(out, "P6\n%ld %ld\n255\n", (long)size.width, (long)size.height);
+    fwrite(frame.data(), 1, frame.size(), out);
+    fclose(out);
+  }
+}
+
+// Compares with the golden, or replaces it under --update
+static void check_frame(const std::string &name, const Frame &frame,
+                        const FrameSize &size) {
+  if (update_goldens) {
+    CHECK(write_golden(name, frame, size));
+    return;
+  }
+  Frame golden = read_golden(name, size);
+  if (golden.empty()) {
+    fprintf(stderr, "%s: no usable golden at %s; run with --update\n",
+            name.c_str(), golden_path(name).c_str());
+    check_failures++;
+    return;
+  }
+
+  Frame diff(frame.size(), 0);
+  size_t differing = 0;
+  for (size_t i = 0; i < frame.size(); i += 3) {
+    int largest = 0;
+    for (size_t channel = 0; channel < 3; channel++) {
+      largest = std::max(largest, abs(frame[i + channel] - golden[i + channel]));
+    }
+    if (largest > CHANNEL_TOLERANCE) {
+      differing++;
+      diff[i] = 255;
+    }
+  }
+  size_t allowed = frame.size() / 3 * DIFFERING_PER_10K / 10000;
+  if (differing > allowed) {
+    fprintf(stderr, "%s: %zu pixels differ from the golden, %zu allowed\n",
+            name.c_str(), differing, allowed);
+    write_ppm(name + "_actual.ppm", frame, size);
+    write_ppm(name + "_diff.ppm", diff, size);
+    check_failures++;
+  }
+}
+
+static int64_t elapsed_us(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// Into the frame rendered last, so later frames only redraw what the face
+// invalidated, as on the device
+static const Frame &render(Frame *frame, int64_t *render_us) {
+  auto start = std::chrono::steady_clock::now();
+  lv_host_render(frame->data());
+  *render_us = elapsed_us(start);
+  return *frame;
+}
+
+static void record_times(const std::string &name, int64_t create_us,
+                         int64_t update_us, int64_t render_us) {
+  printf("%-28s create %6lld us  update %6lld us  render %6lld us\n",
+         name.c_str(), (long long)create_us, (long long)update_us,
+         (long long)render_us);
+  if (times_file) {
+    fprintf(times_file, "%s,%lld,%lld,%lld\n", name.c_str(),
+            (long long)create_us, (long long)update_us, (long long)render_us);
+  }
+}
+
+// A screen with the clock container of Clock.cpp filling it
+static lv_obj_t *create_container(const FrameSize &size) {
+  lv_obj_t *screen = lv_host_screen_create(size.width, size.height);
+  lv_obj_t *container = lv_obj_create(screen);
+  lv_obj_set_size(container, size.width, size.height);
+  lv_obj_set_style_border_width(container, 0, 0);
+  lv_obj_set_style_pad_all(container, 0, 0);
+  lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_layout(container, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(container, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_flex_align(container, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER,
+                        LV_FLEX_ALIGN_CENTER);
+  return container;
+}
+
+static std::string case_name(const char *subject, const FrameSize &size) {
+  char name[64];
+  snprintf(name, sizeof(name), "%s_%ldx%ld", subject, (long)size.width,
+           (long)size.height);
+  return name;
+}
+
+static ClockFaceSettings face_settings() {
+  ClockFaceSettings settings = {};
+  settings.ui_scale = UiScaleDefault;
+  settings.locale = locale_default();
+  strcpy(settings.dashboard_zones[0].name, "UTC");
+  zone_rule_fixed(&settings.dashboard_zones[0].rule, 0);
+  strcpy(settings.dashboard_zones[1].name, "Tokyo");
+  int tokyo = timezone_find("Asia/Tokyo");
+  CHECK(tokyo >= 0);
+  if (tokyo >= 0) {
+    CHECK(zone_rule_parse(timezone_rule(tokyo),
+                          &settings.dashboard_zones[1].rule));
+  }
+  return settings;
+}
+
+// The face as created at FIRST_TIME, then after a tick at SECOND_TIME
+static void test_face(int face, const FrameSize &size) {
+  std::string name = case_name(clock_faces[face].name, size);
+  lv_obj_t *container = create_container(size);
+  clock_tick_set_fixed_time(FIRST_TIME);
+
+  auto start = std::chrono::steady_clock::now();
+  lv_obj_t *widget = clock_widget_create(container, face, face_settings());
+  lv_obj_update_layout(container);
+  int64_t create_us = elapsed_us(start);
+  CHECK(widget != nullptr);
+  Frame frame((size_t)size.width * (size_t)size.height * 3);
+  int64_t render_us;
+  check_frame(name + "_first", render(&frame, &render_us), size);
+
+  clock_tick_set_fixed_time(SECOND_TIME);
+  start = std::chrono::steady_clock::now();
+  face_host_tick();
+  int64_t update_us = elapsed_us(start);
+  // A change the face forgot to invalidate leaves a stale area here
+  check_frame(name + "_second", render(&frame, &render_us), size);
+  record_times(name, create_us, update_us, render_us);
+
+  lv_host_screen_delete();
+}
+
+static void test_wifi_prompt(const FrameSize &size) {
+  std::string name = case_name("wifi_prompt", size);
+  lv_obj_t *container = create_container(size);
+  auto start = std::chrono::steady_clock::now();
+  WifiPrompt prompt;
+  wifi_prompt_create(&prompt, container,
+                     clock_layout_get(size.width, size.height, UiScaleDefault),
+                     nullptr, nullptr);
+  lv_obj_update_layout(container);
+  int64_t create_us = elapsed_us(start);
+  CHECK(prompt.button != nullptr);
+  Frame frame((size_t)size.width * (size_t)size.height * 3);
+  int64_t render_us;
+  check_frame(name, render(&frame, &render_us), size);
+  record_times(name, create_us, 0, render_us);
+  lv_host_screen_delete();
+}
+
+int main(int argc, char **argv) {
+  update_goldens = argc > 1 && strcmp(argv[1], "--update") == 0;
+  setenv("TZ", "UTC", 1);
+  tzset();
+  face_host_set_24_hour(true);
+  face_host_set_uptime(UPTIME_US);
+
+  times_file = fopen("face_render_times.csv", "w");
+  if (times_file) {
+    fprintf(times_file, "case,create_us,update_us,render_us\n");
+  }
+  for (const FrameSize &size : FRAME_SIZES) {
+    for (int face = 0; face < ClockFaceCount; face++) {
+      test_face(face, size);
+    }
+    test_wifi_prompt(size);
+  }
+  if (times_file) {
+    fclose(times_file);
+  }
+  return check_result();
+}
@@ -0,0 +1,81 @@
+#include "FaceHost.h"
+
+#include "FaceAssets.h"
+
+#include <esp_timer.h>
+#include <tt_time.h>
+
+#include <time.h>
+
+struct Subscriber {
+  ClockTickCallback callback;
+  void *user_data;
+};
+
+static Subscriber subscribers[CLOCK_TICK_MAX_SUBSCRIBERS] = {};
+static int subscriber_count = 0;
+static time_t fixed_time = 0;
+static bool hours_24 = true;
+static int64_t uptime_us = 0;
+
+bool clock_tick_subscribe(ClockTickCallback callback, void *user_data) {
+  if (subscriber_count == CLOCK_TICK_MAX_SUBSCRIBERS) {
+    return false;
+  }
+  subscribers[subscriber_count++] = {callback, user_data};
+  return true;
+}
+
+void clock_tick_unsubscribe(ClockTickCallback callback, void *user_data) {
+  for (int i = 0; i < subscriber_count; i++) {
+    if (subscribers[i].callback == callback &&
+        subscribers[i].user_data == user_data) {
+      for (int j = i + 1; j < subscriber_count; j++) {
+        subscribers[j - 1] = subscribers[j];
+      }
+      subscribers[--subscriber_count] = {};
+      return;
+    }
+  }
+}
+
+void clock_tick_set_paused(bool paused) {}
+
+time_t clock_tick_time() { return fixed_time ? fixed_time : time(nullptr); }
+
+void clock_tick_set_fixed_time(time_t time) { fixed_time = time; }
+
+void clock_tick_set_interval(uint32_t seconds) {}
+
+void clock_tick_attach(lv_display_t *display, ClockTickMode mode) {}
+
+void clock_tick_detach() {}
+
+void face_host_tick() {
+  time_t now = clock_tick_time();
+  struct tm timeinfo;
+  localtime_r(&now, &timeinfo);
+  // Copied, as callbacks may unsubscribe
+  Subscriber current[CLOCK_TICK_MAX_SUBSCRIBERS];
+  int count = subscriber_count;
+  for (int i = 0; i < count; i++) {
+    current[i] = subscribers[i];
+  }
+  for (int i = 0; i < count; i++) {
+    current[i].callback(now, timeinfo, current[i].user_data);
+  }
+}
+
+FaceAsset face_asset_acquire(const char *name, int32_t size) {
+  return {nullptr, 0};
+}
+
+void face_asset_release(lv_draw_buf_t *buffer) {}
+
+bool tt_timezone_is_format_24_hour() { return hours_24; }
+
+void face_host_set_24_hour(bool enabled) { hours_24 = enabled; }
+
+int64_t esp_timer_get_time() { return uptime_us; }
+
+void face_host_set_uptime(int64_t us) { uptime_us = us; }
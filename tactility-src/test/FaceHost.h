@@ -0,0 +1,17 @@
+#pragma once
+
+#include "ClockTick.h"
+
+#include <cstdint>
+
+// Host stand-ins for what the faces use beyond LVGL: the shared tick, face
+// images, the 12/24-hour setting and the uptime. Ticks fire only when asked,
+// no face images are found, and time and uptime stay wherever they are set,
+// so frames are the same on every run.
+
+// Fires every subscriber once with clock_tick_time()
+void face_host_tick();
+
+void face_host_set_24_hour(bool enabled);
+
+void face_host_set_uptime(int64_t us);
@@ -0,0 +1,128 @@
+#include "Check.h"
+
+#include "ClockWidget.h"
+#include "FaceHost.h"
+#include "LvglHost.h"
+
+#include <cstdint>
+#include <cstring>
+
+// Heap fragmentation from swiping through the faces, with and without
+// FaceArena. Every face is created and destroyed through ClockWidget
+// thousands of times the way the carousel does it: the next face is created
+// while the previous one is still alive, ticks a few times, and replaces it.
+// Meanwhile the rest of the app keeps churning long-lived allocations of
+// varying size (a status label and a ring of strings standing in for
+// weather and calendar texts), so face blocks get interleaved with them.
+//
+// The LVGL stand-in's heap is a first-fit pool like LVGL's own (see
+// lvgl/LvglHost.cpp). For both modes the free total and largest free block
+// at the soak's worst point are printed, with the most free blocks (holes)
+// seen. The check is that nothing a face allocated outlives it; how the two
+// modes compare is for the reader, as it depends on the faces' allocations.
+
+constexpr int ROUNDS = 1000; // Through all faces each
+constexpr int TICKS_PER_FACE = 3;
+constexpr int RING_SIZE = 8;
+constexpr time_t SOAK_TIME = 1710028727; // 2024-03-09 23:58:47 UTC
+constexpr int32_t WIDTH = 320;
+constexpr int32_t HEIGHT = 218;
+
+struct SoakResult {
+  lv_mem_monitor_t worst; // When the largest free block was smallest
+  size_t most_holes;      // Most free blocks seen
+  lv_mem_monitor_t after; // Everything deleted
+};
+
+static void sample(SoakResult *result) {
+  lv_mem_monitor_t monitor;
+  lv_mem_monitor(&monitor);
+  if (monitor.free_biggest_size < result->worst.free_biggest_size) {
+    result->worst = monitor;
+  }
+  result->most_holes = LV_MAX(result->most_holes, monitor.free_cnt);
+}
+
+static void print_result(const char *mode, const SoakResult &result) {
+  const lv_mem_monitor_t &worst = result.worst;
+  printf("%-6s worst: free %7zu  largest block %7zu  fragmented %3u%%  "
+         "blocks in use %4zu;  up to %zu free blocks\n",
+         mode, worst.free_size, worst.free_biggest_size,
+         (unsigned)worst.frag_pct, worst.used_cnt, result.most_holes);
+}
+
+static SoakResult soak(bool use_arena) {
+  clock_widget_set_arena_enabled(use_arena);
+  ClockFaceSettings settings = {};
+  settings.ui_scale = UiScaleDefault;
+  settings.locale = locale_default();
+  for (DashboardZone &zone : settings.dashboard_zones) {
+    strcpy(zone.name, "UTC");
+    zone_rule_fixed(&zone.rule, 0);
+  }
+
+  lv_obj_t *screen = lv_host_screen_create(WIDTH, HEIGHT);
+  lv_obj_t *container = lv_obj_create(screen);
+  lv_obj_set_size(container, WIDTH, HEIGHT);
+  lv_obj_t *status = lv_label_create(screen);
+  lv_obj_add_flag(status, LV_OBJ_FLAG_FLOATING);
+  void *ring[RING_SIZE] = {};
+
+  SoakResult result = {};
+  result.worst.free_biggest_size = SIZE_MAX;
+  time_t now = SOAK_TIME;
+  lv_obj_t *live = nullptr;
+  for (int round = 0; round < ROUNDS; round++) {
+    for (int face = 0; face < ClockFaceCount; face++) {
+      clock_tick_set_fixed_time(now);
+      lv_obj_t *next = clock_widget_create(container, face, settings);
+      CHECK(next != nullptr);
+      lv_obj_update_layout(container);
+      sample(&result);
+      if (live) {
+        lv_obj_delete(live);
+      }
+      live = next;
+      for (int tick = 0; tick < TICKS_PER_FACE; tick++) {
+        clock_tick_set_fixed_time(++now);
+        face_host_tick();
+      }
+
+      int step = round * ClockFaceCount + face;
+      char text[64];
+      snprintf(text, sizeof(text), "%.*s", step % 48 + 1,
+               "Synced 12:00, next sync in 59 minutes, 42 seconds");
+      lv_label_set_text(status, text);
+      void *&slot = ring[step % RING_SIZE];
+      lv_free(slot);
+      slot = lv_malloc((size_t)(24 + step * 37 % 200));
+      sample(&result);
+    }
+  }
+
+  for (void *block : ring) {
+    lv_free(block);
+  }
+  lv_host_screen_delete();
+  lv_mem_monitor(&result.after);
+  clock_widget_set_arena_enabled(true);
+  return result;
+}
+
+int main() {
+  face_host_set_24_hour(true);
+  lv_mem_monitor_t before;
+  lv_mem_monitor(&before);
+
+  SoakResult heap = soak(false);
+  SoakResult arena = soak(true);
+  print_result("heap", heap);
+  print_result("arena", arena);
+
+  // Nothing a face allocated outlives it
+  CHECK_EQ(heap.after.free_size, before.free_size);
+  CHECK_EQ(heap.after.used_cnt, before.used_cnt);
+  CHECK_EQ(arena.after.free_size, before.free_size);
+  CHECK_EQ(arena.after.used_cnt, before.used_cnt);
+  return check_result();
+}
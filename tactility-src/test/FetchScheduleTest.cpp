@@ -0,0 +1,79 @@
+#include "Check.h"
+
+#include "FetchSchedule.h"
+#include "WeatherService.h"
+
+// Backoff after failed fetches and what a 304 does to the schedule and the
+// weather report
+
+static void test_backoff() {
+  FetchSchedule schedule;
+  fetch_schedule_init(&schedule);
+  CHECK(!schedule.backing_off);
+  CHECK_EQ(fetch_schedule_next(&schedule, FetchUpdated, 900), 900);
+
+  // Doubles from a minute up to an hour, then stays there
+  const uint32_t expected[] = {60, 120, 240, 480, 960, 1920, 3600, 3600};
+  for (uint32_t delay_s : expected) {
+    CHECK_EQ(fetch_schedule_next(&schedule, FetchFailed, 900), delay_s);
+    CHECK(schedule.backing_off);
+  }
+
+  // One success starts the backoff over
+  CHECK_EQ(fetch_schedule_next(&schedule, FetchUpdated, 900), 900);
+  CHECK(!schedule.backing_off);
+  CHECK_EQ(fetch_schedule_next(&schedule, FetchFailed, 900), 60);
+}
+
+static void test_not_modified_schedule() {
+  FetchSchedule schedule;
+  fetch_schedule_init(&schedule);
+  fetch_schedule_next(&schedule, FetchFailed, 900);
+  fetch_schedule_next(&schedule, FetchFailed, 900);
+  // A 304 is a success: back to the normal interval and a fresh backoff
+  CHECK_EQ(fetch_schedule_next(&schedule, FetchNotModified, 900), 900);
+  CHECK(!schedule.backing_off);
+  CHECK_EQ(fetch_schedule_next(&schedule, FetchFailed, 900), 60);
+}
+
+static void test_report() {
+  WeatherReport report = {false, 0.0f, -1, 0, 0};
+
+  weather_report_apply(&report, FetchFailed, 1.0f, 2, 1000);
+  CHECK(!report.valid);
+  CHECK_EQ(report.version, 0);
+
+  weather_report_apply(&report, FetchUpdated, 12.5f, 3, 1000);
+  CHECK(report.valid);
+  CHECK(report.temperature == 12.5f);
+  CHECK_EQ(report.code, 3);
+  CHECK_EQ(report.fetched_at, 1000);
+  CHECK_EQ(report.version, 1);
+
+  // The same reading again only refreshes the time
+  weather_report_apply(&report, FetchUpdated, 12.5f, 3, 1900);
+  CHECK_EQ(report.version, 1);
+  CHECK_EQ(report.fetched_at, 1900);
+
+  // 304: still current, nothing else changes
+  weather_report_apply(&report, FetchNotModified, 0.0f, -1, 2800);
+  CHECK_EQ(report.version, 1);
+  CHECK_EQ(report.fetched_at, 2800);
+  CHECK(report.temperature == 12.5f);
+  CHECK_EQ(report.code, 3);
+
+  // A failure keeps the last report and its age
+  weather_report_apply(&report, FetchFailed, 0.0f, -1, 3700);
+  CHECK_EQ(report.fetched_at, 2800);
+  CHECK(report.valid);
+
+  weather_report_apply(&report, FetchUpdated, 11.0f, 3, 4600);
+  CHECK_EQ(report.version, 2);
+}
+
+int main() {
+  test_backoff();
+  test_not_modified_schedule();
+  test_report();
+  return check_result();
+}
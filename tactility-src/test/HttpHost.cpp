@@ -0,0 +1,175 @@
+#include "HttpHost.h"
+
+#include <esp_crt_bundle.h>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <strings.h>
+
+struct esp_http_client {
+  esp_http_client_config_t config;
+  std::string url;
+  HttpHeaders headers;
+  HttpCannedResponse response;
+  bool has_response;
+  size_t body_read;
+};
+
+static std::deque<HttpCannedResponse> responses;
+static std::vector<HttpRequest> requests;
+
+void http_host_reset() {
+  responses.clear();
+  requests.clear();
+}
+
+void http_host_respond(const HttpCannedResponse &response) {
+  responses.push_back(response);
+}
+
+const std::vector<HttpRequest> &http_host_requests() { return requests; }
+
+size_t http_host_pending() { return responses.size(); }
+
+static const std::string *find_header(const HttpHeaders &headers,
+                                      const char *key) {
+  for (const auto &header : headers) {
+    if (strcasecmp(header.first.c_str(), key) == 0) {
+      return &header.second;
+    }
+  }
+  return nullptr;
+}
+
+const char *http_host_request_header(const HttpRequest &request,
+                                     const char *key) {
+  const std::string *value = find_header(request.headers, key);
+  return value ? value->c_str() : nullptr;
+}
+
+static void dispatch(esp_http_client_handle_t client,
+                     esp_http_client_event_id_t event_id,
+                     const std::string *key, const std::string *value) {
+  if (!client->config.event_handler) {
+    return;
+  }
+  // The handler may not keep these, as on the device
+  std::string key_copy = key ? *key : "";
+  std::string value_copy = value ? *value : "";
+  esp_http_client_event_t event = {};
+  event.event_id = event_id;
+  event.client = client;
+  event.user_data = client->config.user_data;
+  event.header_key = key ? &key_copy[0] : nullptr;
+  event.header_value = value ? &value_copy[0] : nullptr;
+  client->config.event_handler(&event);
+}
+
+const char *esp_err_to_name(esp_err_t code) {
+  return code == ESP_OK ? "ESP_OK" : "ESP_FAIL";
+}
+
+esp_err_t esp_crt_bundle_attach(void *conf) { return ESP_OK; }
+
+esp_http_client_handle_t
+esp_http_client_init(const esp_http_client_config_t *config) {
+  auto *client = new esp_http_client();
+  client->config = *config;
+  client->url = config->url ? config->url : "";
+  return client;
+}
+
+esp_err_t esp_http_client_set_header(esp_http_client_handle_t client,
+                                     const char *key, const char *value) {
+  auto &headers = client->headers;
+  headers.erase(std::remove_if(headers.begin(), headers.end(),
+                               [key](const auto &header) {
+                                 return strcasecmp(header.first.c_str(),
+                                                   key) == 0;
+                               }),
+                headers.end());
+  headers.emplace_back(key, value);
+  return ESP_OK;
+}
+
+esp_err_t esp_http_client_open(esp_http_client_handle_t client,
+                               int write_len) {
+  client->has_response = false;
+  if (responses.empty()) {
+    return ESP_FAIL;
+  }
+  client->response = responses.front();
+  responses.pop_front();
+  requests.push_back({client->url, client->headers});
+  if (client->response.connect_fails) {
+    return ESP_FAIL;
+  }
+  client->has_response = true;
+  client->body_read = 0;
+  dispatch(client, HTTP_EVENT_HEADERS_SENT, nullptr, nullptr);
+  return ESP_OK;
+}
+
+int64_t esp_http_client_fetch_headers(esp_http_client_handle_t client) {
+  if (!client->has_response) {
+    return ESP_FAIL;
+  }
+  for (const auto &header : client->response.headers) {
+    dispatch(client, HTTP_EVENT_ON_HEADER, &header.first, &header.second);
+  }
+  return (int64_t)client->response.body.size();
+}
+
+int esp_http_client_get_status_code(esp_http_client_handle_t client) {
+  return client->has_response ? client->response.status : 0;
+}
+
+int esp_http_client_read(esp_http_client_handle_t client, char *buffer,
+                         int len) {
+  if (!client->has_response) {
+    return -1;
+  }
+  const HttpCannedResponse &response = client->response;
+  size_t end = response.body.size();
+  if (response.read_error_at >= 0) {
+    if (client->body_read >= (size_t)response.read_error_at) {
+      return -1;
+    }
+    end = std::min(end, (size_t)response.read_error_at);
+  }
+  size_t length = std::min({end - client->body_read, (size_t)len,
+                            (size_t)response.chunk_size});
+  memcpy(buffer, response.body.data() + client->body_read, length);
+  client->body_read += length;
+  return (int)length;
+}
+
+esp_err_t esp_http_client_flush_response(esp_http_client_handle_t client,
+                                         int *len) {
+  if (client->has_response) {
+    client->body_read = client->response.body.size();
+  }
+  return ESP_OK;
+}
+
+esp_err_t esp_http_client_set_redirection(esp_http_client_handle_t client) {
+  const std::string *location =
+      client->has_response ? find_header(client->response.headers, "Location")
+                           : nullptr;
+  if (!location) {
+    return ESP_FAIL;
+  }
+  client->url = *location;
+  return ESP_OK;
+}
+
+esp_err_t esp_http_client_close(esp_http_client_handle_t client) {
+  client->has_response = false;
+  return ESP_OK;
+}
+
+esp_err_t esp_http_client_cleanup(esp_http_client_handle_t client) {
+  delete client;
+  return ESP_OK;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <esp_http_client.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// Canned HTTP responses behind the esp_http_client stand-in, so the
+// services' fetches run on the host without a network. Each
+// esp_http_client_open() takes the next queued response and records the
+// request it answers. Header events reach the client's event handler as on
+// the device: HTTP_EVENT_HEADERS_SENT per request, then HTTP_EVENT_ON_HEADER
+// per response header.
+
+using HttpHeaders = std::vector<std::pair<std::string, std::string>>;
+
+struct HttpCannedResponse {
+  int status;
+  HttpHeaders headers; // Redirects carry a Location
+  std::string body;
+  bool connect_fails = false; // esp_http_client_open() fails instead
+  // Reads fail once this much of the body was read; -1 never
+  int read_error_at = -1;
+  // Most bytes one read returns, so bodies arrive in pieces
+  int chunk_size = 100;
+};
+
+struct HttpRequest {
+  std::string url;
+  HttpHeaders headers;
+};
+
+// Drops queued responses and recorded requests
+void http_host_reset();
+
+void http_host_respond(const HttpCannedResponse &response);
+
+// Requests answered since the last reset, oldest first
+const std::vector<HttpRequest> &http_host_requests();
+
+// Responses queued but not asked for
+size_t http_host_pending();
+
+// The request's header, or nullptr when it was not sent
+const char *http_host_request_header(const HttpRequest &request,
+                                     const char *key);
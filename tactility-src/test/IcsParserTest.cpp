@@ -0,0 +1,178 @@
+#include "Check.h"
+
+#include "IcsParser.h"
+
+#include <cstdlib>
+#include <cstring>
+
+// The parser must build the same index however the calendar is chunked,
+// including splits inside CRLF pairs and folded lines
+
+static const char CALENDAR[] =
+    "BEGIN:VCALENDAR\r\n"
+    "VERSION:2.0\r\n"
+    "BEGIN:VEVENT\r\n"
+    "DTSTART:20261019T090000Z\r\n"
+    "SUMMARY:Stand-up\\, team\r\n"
+    "RRULE:FREQ=DAILY;COUNT=5\r\n"
+    "BEGIN:VALARM\r\n"
+    "SUMMARY:Not the event\r\n"
+    "END:VALARM\r\n"
+    "END:VEVENT\r\n"
+    "BEGIN:VEVENT\r\n"
+    "SUMMARY:Quarterly plan\r\n"
+    " ning review\r\n"
+    "DTSTART:20261021T133000Z\r\n"
+    "END:VEVENT\r\n"
+    "BEGIN:VEVENT\r\n"
+    "DTSTART;VALUE=DATE:20261024\r\n"
+    "SUMMARY:Holiday\r\n"
+    "END:VEVENT\r\n"
+    "BEGIN:VEVENT\r\n"
+    "DTSTART:20250101T120000Z\r\n"
+    "SUMMARY:Long past\r\n"
+    "END:VEVENT\r\n"
+    "BEGIN:VEVENT\n"
+    "DTSTART:20261018T070000Z\n"
+    "SUMMARY:Bare newlines\n"
+    "RRULE:FREQ=WEEKLY;INTERVAL=2;UNTIL=20261201T000000Z\n"
+    "END:VEVENT\n"
+    "END:VCALENDAR";
+
+// 2026-10-17 00:00 UTC, two months ahead
+constexpr time_t WINDOW_START = 1792195200;
+constexpr time_t WINDOW_END = WINDOW_START + 61 * 24 * 60 * 60;
+
+static CalendarIndex parse(size_t first, size_t chunk) {
+  static IcsParser parser;
+  CalendarIndex index;
+  calendar_index_clear(&index);
+  ics_parser_init(&parser, &index, WINDOW_START, WINDOW_END);
+  size_t length = strlen(CALENDAR);
+  for (size_t offset = 0; offset < length;) {
+    size_t piece = offset == 0 ? first : chunk;
+    if (piece > length - offset) {
+      piece = length - offset;
+    }
+    ics_parser_feed(&parser, CALENDAR + offset, piece);
+    offset += piece;
+  }
+  ics_parser_finish(&parser);
+  return index;
+}
+
+static bool same_index(const CalendarIndex &a, const CalendarIndex &b) {
+  if (a.count != b.count) {
+    return false;
+  }
+  for (int i = 0; i < a.count; i++) {
+    if (a.events[i].start != b.events[i].start ||
+        a.events[i].all_day != b.events[i].all_day ||
+        strcmp(a.events[i].summary, b.events[i].summary) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void test_whole() {
+  CalendarIndex index = parse(strlen(CALENDAR), strlen(CALENDAR));
+  // 5 stand-ups, planning, holiday and 4 fortnightly events up to UNTIL
+  CHECK_EQ(index.count, 11);
+  if (index.count != 11) {
+    return;
+  }
+  CHECK_EQ(index.events[0].start, 1792306800); // 2026-10-18 07:00Z
+  CHECK(strcmp(index.events[0].summary, "Bare newlines") == 0);
+  CHECK_EQ(index.events[1].start, 1792400400); // 2026-10-19 09:00Z
+  CHECK(strcmp(index.events[1].summary, "Stand-up, team") == 0);
+  CHECK_EQ(index.events[4].start, 1792589400); // 2026-10-21 13:30Z
+  CHECK(strcmp(index.events[4].summary, "Quarterly planning review") == 0);
+  int holidays = 0;
+  for (int i = 0; i < index.count; i++) {
+    if (index.events[i].all_day) {
+      holidays++;
+      CHECK(strcmp(index.events[i].summary, "Holiday") == 0);
+    }
+    CHECK(strcmp(index.events[i].summary, "Not the event") != 0);
+    CHECK(strcmp(index.events[i].summary, "Long past") != 0);
+  }
+  CHECK_EQ(holidays, 1);
+}
+
+static CalendarIndex parse_window(const char *calendar, time_t start,
+                                  time_t end) {
+  static IcsParser parser;
+  CalendarIndex index;
+  calendar_index_clear(&index);
+  ics_parser_init(&parser, &index, start, end);
+  ics_parser_feed(&parser, calendar, strlen(calendar));
+  ics_parser_finish(&parser);
+  return index;
+}
+
+// COUNT counts occurrences, not periods: dates a month or year lacks are
+// skipped without using one up, also when the window starts later
+static void test_count_skipping_dates() {
+  const char *monthly = "BEGIN:VEVENT\r\n"
+                        "DTSTART:20270131T090000Z\r\n"
+                        "SUMMARY:Month end\r\n"
+                        "RRULE:FREQ=MONTHLY;COUNT=3\r\n"
+                        "END:VEVENT\r\n";
+  constexpr time_t JAN_1 = 1798761600;  // 2027-01-01
+  constexpr time_t APR_1 = 1806537600;  // 2027-04-01
+  constexpr time_t JUN_1 = 1811808000;  // 2027-06-01
+  constexpr time_t DEC_31 = 1830211200; // 2027-12-31
+  CalendarIndex index = parse_window(monthly, JAN_1, DEC_31);
+  CHECK_EQ(index.count, 3);
+  if (index.count == 3) {
+    CHECK_EQ(index.events[0].start, 1801386000); // Jan 31
+    CHECK_EQ(index.events[1].start, 1806483600); // Mar 31
+    CHECK_EQ(index.events[2].start, 1811754000); // May 31
+  }
+  index = parse_window(monthly, APR_1, DEC_31);
+  CHECK_EQ(index.count, 1);
+  if (index.count == 1) {
+    CHECK_EQ(index.events[0].start, 1811754000);
+  }
+  // The fourth, July 31, is past the count
+  index = parse_window(monthly, JUN_1, DEC_31);
+  CHECK_EQ(index.count, 0);
+
+  const char *leap_day = "BEGIN:VEVENT\r\n"
+                         "DTSTART:20240229T080000Z\r\n"
+                         "SUMMARY:Leap day\r\n"
+                         "RRULE:FREQ=YEARLY;COUNT=2\r\n"
+                         "END:VEVENT\r\n";
+  constexpr time_t YEAR_2027 = 1798761600;
+  constexpr time_t YEAR_2033 = YEAR_2027 + 6LL * 365 * 24 * 60 * 60;
+  index = parse_window(leap_day, YEAR_2027, YEAR_2033);
+  CHECK_EQ(index.count, 1);
+  if (index.count == 1) {
+    CHECK_EQ(index.events[0].start, 1835424000); // 2028-02-29
+  }
+}
+
+static void test_chunking() {
+  size_t length = strlen(CALENDAR);
+  CalendarIndex whole = parse(length, length);
+  for (size_t split = 1; split < length; split++) {
+    if (!same_index(parse(split, length), whole)) {
+      fprintf(stderr, "Split at %zu differs\n", split);
+      CHECK(false);
+    }
+  }
+  CHECK(same_index(parse(1, 1), whole));
+  CHECK(same_index(parse(2, 3), whole));
+  CHECK(same_index(parse(100, 17), whole));
+}
+
+int main() {
+  // Floating times and all-day dates are local time
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  test_whole();
+  test_count_skipping_dates();
+  test_chunking();
+  return check_result();
+}
@@ -0,0 +1,123 @@
+#include "Check.h"
+
+#include "JsonStream.h"
+
+#include <cstring>
+#include <string>
+
+// The tokenizer must report the same values however the input is chunked,
+// and reject numbers outside the JSON grammar
+
+static const char DOCUMENT[] =
+    "{\"latitude\":52.52,\"current\":{\"time\":\"2026-10-17T14:00\","
+    "\"temperature_2m\":-3.25e1,\"weather_code\":61,\"is_day\":true},"
+    "\"hourly\":{\"time\":[\"a\\\"b\",\"caf\\u00e9\"],\"rain\":[0,0.5,null]},"
+    "\"empty\":{},\"list\":[]}";
+
+static const char EXPECTED[] = "latitude=n:52.52\n"
+                               "current.time=s:2026-10-17T14:00\n"
+                               "current.temperature_2m=n:-3.25e1\n"
+                               "current.weather_code=n:61\n"
+                               "current.is_day=b:true\n"
+                               "hourly.time.0=s:a\"b\n"
+                               "hourly.time.1=s:caf\xc3\xa9\n"
+                               "hourly.rain.0=n:0\n"
+                               "hourly.rain.1=n:0.5\n"
+                               "hourly.rain.2=0:null\n";
+
+static void record_value(const char *path, JsonValueType type,
+                         const char *text, void *user_data) {
+  auto *out = static_cast<std::string *>(user_data);
+  const char types[] = {'s', 'n', 'b', '0'};
+  *out += path;
+  *out += '=';
+  *out += types[type];
+  *out += ':';
+  *out += text;
+  *out += '\n';
+}
+
+// Values reported for `text` fed in pieces of at most `chunk` bytes, with
+// the first piece `first` bytes long; empty when parsing fails
+static std::string parse(const char *text, size_t first, size_t chunk) {
+  std::string out;
+  JsonStream stream;
+  json_stream_init(&stream, record_value, &out);
+  size_t length = strlen(text);
+  size_t offset = 0;
+  while (offset < length) {
+    size_t piece = offset == 0 ? first : chunk;
+    if (piece > length - offset) {
+      piece = length - offset;
+    }
+    if (!json_stream_feed(&stream, text + offset, piece)) {
+      return "";
+    }
+    offset += piece;
+  }
+  return json_stream_finish(&stream) ? out : "";
+}
+
+static bool valid(const char *text) {
+  std::string out;
+  JsonStream stream;
+  json_stream_init(&stream, record_value, &out);
+  return json_stream_feed(&stream, text, strlen(text)) &&
+         json_stream_finish(&stream);
+}
+
+static void test_chunking() {
+  size_t length = strlen(DOCUMENT);
+  CHECK(parse(DOCUMENT, length, length) == EXPECTED);
+  // Every split point, then byte by byte and in small odd chunks
+  for (size_t split = 1; split <= length; split++) {
+    if (parse(DOCUMENT, split, length) != EXPECTED) {
+      fprintf(stderr, "Split at %zu differs\n", split);
+      CHECK(false);
+    }
+  }
+  CHECK(parse(DOCUMENT, 1, 1) == EXPECTED);
+  CHECK(parse(DOCUMENT, 3, 7) == EXPECTED);
+}
+
+static void test_numbers() {
+  const char *accepted[] = {
+      "0",         "-0",           "12",          "-12.5",
+      "1e5",       "1E+5",         "2.5e-3",      "{\"a\":-0.5E+10}",
+      "[0,-1,2]",  "{\"a\":1 }",   "[1.0e0]",
+  };
+  for (const char *text : accepted) {
+    if (!valid(text)) {
+      fprintf(stderr, "Rejected %s\n", text);
+      CHECK(false);
+    }
+  }
+  const char *rejected[] = {
+      "{\"a\":-}",  "{\"a\":1-2}", "{\"a\":01}",  "{\"a\":1.}",
+      "{\"a\":1e}", "{\"a\":1e+}", "{\"a\":.5}",  "{\"a\":--1}",
+      "{\"a\":+1}", "[1.e5]",      "[1e5.0]",     "[1ee5]",
+      "-",          "1.",          "1.5e",        "2e-",
+  };
+  for (const char *text : rejected) {
+    if (valid(text)) {
+      fprintf(stderr, "Accepted %s\n", text);
+      CHECK(false);
+    }
+  }
+}
+
+static void test_structure() {
+  CHECK(!valid("{\"a\":1"));
+  CHECK(!valid("{\"a\" 1}"));
+  CHECK(!valid("[1,]x"));
+  CHECK(!valid("[1] [2]"));
+  CHECK(!valid("{\"a\":tru}"));
+  CHECK(valid(" [true, false, null] "));
+}
+
+int main() {
+  test_chunking();
+  test_numbers();
+  test_structure();
+  return check_result();
+}
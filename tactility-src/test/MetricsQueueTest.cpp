@@ -0,0 +1,295 @@
+#include "Check.h"
+
+#include "MetricsQueue.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// The metrics queue against a stand-in collector: batching, backing off
+// while the collector fails, dropping the oldest windows when the queue is
+// full, and a reconnect that delivers what is left exactly once.
+
+constexpr uint32_t PUSH_S = 300;
+constexpr time_t START_TIME = 1710028727;
+
+struct Collector {
+  bool up = true;
+  std::vector<std::string> payloads;
+  std::vector<uint32_t> sequences; // Every window received, in order
+  // Called while a post is in flight, before the collector answers
+  void (*during_post)(void *user_data) = nullptr;
+  void *during_post_data = nullptr;
+};
+
+static bool collect(const char *payload, size_t length, void *user_data) {
+  auto *collector = static_cast<Collector *>(user_data);
+  if (collector->during_post) {
+    collector->during_post(collector->during_post_data);
+  }
+  if (!collector->up) {
+    return false;
+  }
+  std::string body(payload, length);
+  collector->payloads.push_back(body);
+  for (size_t at = body.find("\"seq\":"); at != std::string::npos;
+       at = body.find("\"seq\":", at + 1)) {
+    collector->sequences.push_back(
+        (uint32_t)strtoul(body.c_str() + at + 6, nullptr, 10));
+  }
+  return true;
+}
+
+static int windows_in(const std::string &payload) {
+  int windows = 0;
+  for (size_t at = payload.find("\"seq\":"); at != std::string::npos;
+       at = payload.find("\"seq\":", at + 1)) {
+    windows++;
+  }
+  return windows;
+}
+
+static bool is_complete(const std::string &payload) {
+  return payload.rfind("{\"id\":\"clock-1\"", 0) == 0 &&
+         payload.size() >= 2 &&
+         payload.compare(payload.size() - 2, 2, "]}") == 0;
+}
+
+struct Fixture {
+  MetricsQueue queue{};
+  MetricsPush push{};
+  Collector collector;
+  uint32_t next_sequence = 0;
+
+  Fixture() {
+    snprintf(push.device_id, sizeof(push.device_id), "clock-1");
+    push.post = collect;
+    push.user_data = &collector;
+    fetch_schedule_init(&push.schedule);
+  }
+
+  MetricsWindow window(int32_t value) {
+    MetricsWindow window = {};
+    window.sequence = next_sequence;
+    window.start = START_TIME + 60 * (time_t)next_sequence;
+    window.seconds = 60;
+    next_sequence++;
+    metrics_window_record(&window, MetricRenderCost, value);
+    metrics_window_record(&window, MetricRenderCost, value + 10);
+    return window;
+  }
+
+  bool add(int32_t value = 1000) {
+    return metrics_queue_add(&queue, window(value));
+  }
+
+  uint32_t step() { return metrics_push_step(&queue, &push, PUSH_S); }
+};
+
+static void test_aggregate() {
+  MetricsWindow window = {};
+  CHECK(!metrics_window_has_samples(window));
+  metrics_window_record(&window, MetricDrift, 5);
+  metrics_window_record(&window, MetricDrift, -3);
+  metrics_window_record(&window, MetricDrift, 10);
+  CHECK(metrics_window_has_samples(window));
+  const MetricAggregate &drift = window.metrics[MetricDrift];
+  CHECK_EQ(drift.count, 3);
+  CHECK_EQ(drift.min, -3);
+  CHECK_EQ(drift.max, 10);
+  CHECK_EQ(drift.sum, 12);
+}
+
+static void test_batches() {
+  Fixture fixture;
+  // Below a batch the push task is left to its timer
+  for (int i = 0; i < METRICS_BATCH_SIZE - 1; i++) {
+    CHECK(!fixture.add());
+  }
+  CHECK(fixture.add());
+  for (int i = 0; i < 2 * METRICS_BATCH_SIZE + 2; i++) {
+    fixture.add();
+  }
+  CHECK_EQ(fixture.queue.count, 3 * METRICS_BATCH_SIZE + 2);
+
+  // Full batches follow each other a second apart, the rest waits
+  CHECK_EQ(fixture.step(), 1);
+  CHECK_EQ(fixture.step(), 1);
+  CHECK_EQ(fixture.step(), PUSH_S);
+  CHECK_EQ(fixture.queue.count, 2);
+  CHECK_EQ(fixture.step(), PUSH_S);
+  CHECK_EQ(fixture.queue.count, 0);
+  // Nothing queued is not a failure
+  CHECK_EQ(fixture.step(), PUSH_S);
+
+  const Collector &collector = fixture.collector;
+  CHECK_EQ(collector.payloads.size(), 4);
+  CHECK_EQ(windows_in(collector.payloads[0]), METRICS_BATCH_SIZE);
+  CHECK_EQ(windows_in(collector.payloads[3]), 2);
+  CHECK_EQ(collector.sequences.size(), fixture.next_sequence);
+  for (size_t i = 0; i < collector.sequences.size(); i++) {
+    CHECK_EQ(collector.sequences[i], i);
+  }
+  for (const std::string &payload : collector.payloads) {
+    CHECK(is_complete(payload));
+  }
+  CHECK(collector.payloads[0].find("\"render_us\":[2,1000,1010,1005]") !=
+        std::string::npos);
+  MetricsCounters counters = metrics_queue_counters(&fixture.queue);
+  CHECK_EQ(counters.windows_sent, fixture.next_sequence);
+  CHECK_EQ(counters.windows_dropped, 0);
+  CHECK_EQ(counters.posts_failed, 0);
+}
+
+// Down for a while, then back: backoff, drops, and a clean catch-up
+static void test_outage() {
+  Fixture fixture;
+  fixture.collector.up = false;
+  for (int i = 0; i < METRICS_BATCH_SIZE - 1; i++) {
+    fixture.add();
+  }
+  CHECK(fixture.add());
+
+  // Backs off from a minute, and full batches stop waking the task
+  CHECK_EQ(fixture.step(), FETCH_BACKOFF_MIN_S);
+  CHECK(fixture.queue.backing_off);
+  CHECK(!fixture.add());
+  CHECK_EQ(fixture.step(), 2 * FETCH_BACKOFF_MIN_S);
+  CHECK_EQ(fixture.queue.count, METRICS_BATCH_SIZE + 1);
+
+  // The queue fills and the oldest windows go
+  const int extra = 5;
+  while (fixture.next_sequence < METRICS_QUEUE_SIZE + extra) {
+    CHECK(!fixture.add());
+  }
+  CHECK_EQ(fixture.queue.count, METRICS_QUEUE_SIZE);
+  CHECK_EQ(fixture.queue.windows[fixture.queue.head].sequence, extra);
+  MetricsCounters counters = metrics_queue_counters(&fixture.queue);
+  CHECK_EQ(counters.windows_dropped, extra);
+  CHECK_EQ(counters.posts_failed, 2);
+  CHECK_EQ(counters.windows_sent, 0);
+  CHECK(fixture.collector.payloads.empty());
+
+  // Back up: full batches drain a second apart, then the normal interval
+  fixture.collector.up = true;
+  CHECK_EQ(fixture.step(), 1);
+  CHECK(!fixture.queue.backing_off);
+  CHECK(fixture.collector.payloads[0].find("\"dropped\":5,\"failed\":2") !=
+        std::string::npos);
+  uint32_t delay_s = 1;
+  int steps = 0;
+  while (delay_s == 1 && steps++ < METRICS_QUEUE_SIZE) {
+    delay_s = fixture.step();
+  }
+  CHECK_EQ(delay_s, PUSH_S);
+  CHECK_EQ(fixture.queue.count, 0);
+
+  // Every surviving window arrived once, in order
+  const std::vector<uint32_t> &sequences = fixture.collector.sequences;
+  CHECK_EQ(sequences.size(), METRICS_QUEUE_SIZE);
+  for (size_t i = 0; i < sequences.size(); i++) {
+    CHECK_EQ(sequences[i], extra + (int)i);
+  }
+  counters = metrics_queue_counters(&fixture.queue);
+  CHECK_EQ(counters.windows_sent, METRICS_QUEUE_SIZE);
+  // Full batches wake the task again
+  for (int i = 0; i < METRICS_BATCH_SIZE - 1; i++) {
+    fixture.add();
+  }
+  CHECK(fixture.add());
+}
+
+static void overflow_queue(void *user_data) {
+  auto *fixture = static_cast<Fixture *>(user_data);
+  fixture->collector.during_post = nullptr;
+  for (int i = 0; i < METRICS_QUEUE_SIZE - METRICS_BATCH_SIZE; i++) {
+    fixture->add();
+  }
+}
+
+// Windows dropped while a post is in flight: only the sent windows leave the
+// queue, by sequence, and none is sent twice
+static void test_drop_during_post() {
+  Fixture fixture;
+  for (int i = 0; i < METRICS_BATCH_SIZE + 4; i++) {
+    fixture.add();
+  }
+  fixture.collector.during_post = overflow_queue;
+  fixture.collector.during_post_data = &fixture;
+  bool more;
+  CHECK(metrics_push_batch(&fixture.queue, &fixture.push, &more));
+  CHECK(more);
+
+  // 12 + 24 windows for 32 slots drop the first 4 of the 8 being sent; the
+  // other 4 leave on success and the 28 after them stay
+  MetricsCounters counters = metrics_queue_counters(&fixture.queue);
+  CHECK_EQ(counters.windows_dropped, 4);
+  CHECK_EQ(counters.windows_sent, 4);
+  CHECK_EQ(fixture.queue.count, METRICS_QUEUE_SIZE - 4);
+  CHECK_EQ(fixture.queue.windows[fixture.queue.head].sequence,
+           METRICS_BATCH_SIZE);
+
+  while (fixture.queue.count) {
+    fixture.step();
+  }
+  const std::vector<uint32_t> &sequences = fixture.collector.sequences;
+  CHECK_EQ(sequences.size(), fixture.next_sequence);
+  for (size_t i = 0; i < sequences.size(); i++) {
+    CHECK_EQ(sequences[i], i);
+  }
+}
+
+// A batch that does not fit the payload is sent in parts
+static void test_truncation() {
+  Fixture fixture;
+  for (int i = 0; i < METRICS_BATCH_SIZE; i++) {
+    MetricsWindow window = fixture.window(INT32_MIN);
+    window.seconds = UINT32_MAX;
+    for (int metric = 0; metric < MetricCount; metric++) {
+      metrics_window_record(&window, (MetricId)metric, INT32_MIN);
+    }
+    metrics_queue_add(&fixture.queue, window);
+  }
+  // The rest is less than a batch and waits for the next push
+  CHECK_EQ(fixture.step(), PUSH_S);
+  const std::string &first = fixture.collector.payloads[0];
+  int included = windows_in(first);
+  CHECK(included > 0 && included < METRICS_BATCH_SIZE);
+  CHECK(first.size() < METRICS_PAYLOAD_SIZE);
+  CHECK(is_complete(first));
+  CHECK_EQ(fixture.queue.count, METRICS_BATCH_SIZE - included);
+  while (fixture.queue.count) {
+    fixture.step();
+  }
+  CHECK_EQ(fixture.collector.sequences.size(), METRICS_BATCH_SIZE);
+
+  // One window fits, then only the envelope, then not even that
+  MetricsWindow batch[1] = {fixture.window(7)};
+  MetricsCounters counters = {};
+  char payload[160];
+  size_t length;
+  CHECK_EQ(metrics_payload_build(payload, sizeof(payload), "clock-1", batch, 1,
+                                 counters, &length),
+           1);
+  CHECK_EQ(length, strlen(payload));
+  CHECK(is_complete(payload));
+  CHECK_EQ(metrics_payload_build(payload, 64, "clock-1", batch, 1, counters,
+                                 &length),
+           0);
+  CHECK(strcmp(payload, "{\"id\":\"clock-1\",\"dropped\":0,\"failed\":0,"
+               "\"windows\":[]}") == 0);
+  CHECK_EQ(metrics_payload_build(payload, 16, "clock-1", batch, 1, counters,
+                                 &length),
+           0);
+}
+
+int main() {
+  test_aggregate();
+  test_batches();
+  test_outage();
+  test_drop_during_post();
+  test_truncation();
+  return check_result();
+}
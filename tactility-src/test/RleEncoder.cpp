@@ -0,0 +1,58 @@
+#include "RleEncoder.h"
+
+#include <cstring>
+
+constexpr size_t MAX_RUN = 127;
+
+std::vector<uint8_t> rle_encode(const uint8_t *data, size_t size,
+                                size_t unit) {
+  std::vector<uint8_t> out;
+  size_t units = size / unit;
+  auto same = [&](size_t a, size_t b) {
+    return memcmp(data + a * unit, data + b * unit, unit) == 0;
+  };
+  size_t literal_start = 0;
+  size_t literal_count = 0;
+  auto flush_literal = [&]() {
+    while (literal_count) {
+      size_t count = literal_count < MAX_RUN ? literal_count : MAX_RUN;
+      out.push_back((uint8_t)(0x80 | count));
+      out.insert(out.end(), data + literal_start * unit,
+                 data + (literal_start + count) * unit);
+      literal_start += count;
+      literal_count -= count;
+    }
+  };
+  for (size_t i = 0; i < units;) {
+    size_t run = 1;
+    while (i + run < units && run < MAX_RUN && same(i, i + run)) {
+      run++;
+    }
+    if (run >= 3) {
+      flush_literal();
+      out.push_back((uint8_t)run);
+      out.insert(out.end(), data + i * unit, data + (i + 1) * unit);
+      i += run;
+      literal_start = i;
+    } else {
+      if (!literal_count) {
+        literal_start = i;
+      }
+      literal_count++;
+      i++;
+    }
+  }
+  flush_literal();
+  return out;
+}
+
+void rgb565_pack(const uint8_t *pixels, size_t count, size_t pixel_size,
+                 uint8_t *out) {
+  for (size_t i = 0; i < count; i++) {
+    const uint8_t *p = pixels + i * pixel_size;
+    auto value =
+        (uint16_t)(((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3));
+    out[i * 2] = (uint8_t)value;
+    out[i * 2 + 1] = (uint8_t)(value >> 8);
+  }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Host-side counterpart of RleDecoder.h, for tests and benchmarks that write
+// images: the same runs and literals as convert_images.py's rle_encode(),
+// and its RGB565 conversion.
+
+// Encodes `size` bytes of `unit`-byte units; runs of three or more equal
+// units are repeated, everything else goes out as literals
+std::vector<uint8_t> rle_encode(const uint8_t *data, size_t size, size_t unit);
+
+// Little-endian RGB565 from 8-bit channels, `pixel_size` bytes apart in
+// `pixels` (3 for RGB, 4 for RGBA); writes `count` * 2 bytes
+void rgb565_pack(const uint8_t *pixels, size_t count, size_t pixel_size,
+                 uint8_t *out);
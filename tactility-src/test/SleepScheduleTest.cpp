@@ -0,0 +1,33 @@
+#include "Check.h"
+
+#include "SleepSchedule.h"
+
+// When ScreenSleep takes the panel to be off and when it looks again
+
+static void test_check() {
+  // Awake: the next check is when the timeout could first expire
+  SleepCheck check = sleep_schedule_check(60000, 0);
+  CHECK(!check.asleep);
+  CHECK_EQ(check.next_check_ms, 60000);
+  check = sleep_schedule_check(60000, 45000);
+  CHECK(!check.asleep);
+  CHECK_EQ(check.next_check_ms, 15000);
+
+  // Asleep from the timeout on, polling slowly
+  check = sleep_schedule_check(60000, 60000);
+  CHECK(check.asleep);
+  CHECK_EQ(check.next_check_ms, SLEEP_POLL_MS);
+  check = sleep_schedule_check(60000, 8 * 3600 * 1000);
+  CHECK(check.asleep);
+  CHECK_EQ(check.next_check_ms, SLEEP_POLL_MS);
+
+  // Input since the last check: awake again
+  check = sleep_schedule_check(60000, 200);
+  CHECK(!check.asleep);
+  CHECK_EQ(check.next_check_ms, 59800);
+}
+
+int main() {
+  test_check();
+  return check_result();
+}
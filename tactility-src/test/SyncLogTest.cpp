@@ -0,0 +1,135 @@
+#include "Check.h"
+
+#include "SyncLog.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <vector>
+
+// Torn writes: the newest slot is cut short or corrupted as if power was
+// lost mid-append. Reopening must keep every older record and carry on from
+// the right sequence number.
+
+constexpr long SLOT_SIZE = 32;
+
+static char path[] = "/tmp/sync_log_testXXXXXX";
+
+static SyncRecord make_record(int64_t time) {
+  SyncRecord record = {};
+  record.time = time;
+  record.offset_us = time * 1000 - 5;
+  record.drift_ppb = -1200;
+  record.rtt_ms = 42;
+  record.source = 1;
+  return record;
+}
+
+static void write_log(int records) {
+  truncate(path, 0);
+  sync_log_open(path);
+  for (int i = 1; i <= records; i++) {
+    CHECK(sync_log_append(make_record(1700000000 + i)));
+  }
+}
+
+static bool collect(const SyncRecord &record, void *user_data) {
+  static_cast<std::vector<SyncRecord> *>(user_data)->push_back(record);
+  return true;
+}
+
+static std::vector<SyncRecord> read_log() {
+  std::vector<SyncRecord> records;
+  sync_log_read(collect, &records);
+  return records;
+}
+
+// Records `first`..`last` in order, with their fields intact
+static void check_sequences(const std::vector<SyncRecord> &records,
+                            uint32_t first, uint32_t last) {
+  CHECK_EQ(records.size(), last - first + 1);
+  for (size_t i = 0; i < records.size(); i++) {
+    uint32_t sequence = first + (uint32_t)i;
+    CHECK_EQ(records[i].sequence, sequence);
+    SyncRecord expected = make_record(1700000000 + sequence);
+    CHECK_EQ(records[i].time, expected.time);
+    CHECK_EQ(records[i].offset_us, expected.offset_us);
+    CHECK_EQ(records[i].drift_ppb, expected.drift_ppb);
+    CHECK_EQ(records[i].rtt_ms, expected.rtt_ms);
+  }
+}
+
+static void corrupt_byte(long offset) {
+  FILE *file = fopen(path, "r+b");
+  CHECK(file != nullptr);
+  if (!file) {
+    return;
+  }
+  fseek(file, offset, SEEK_SET);
+  int value = fgetc(file);
+  fseek(file, offset, SEEK_SET);
+  fputc(value ^ 0x5A, file);
+  fclose(file);
+}
+
+static void test_truncated_newest() {
+  write_log(10);
+  // The tenth append stopped partway through its slot
+  CHECK(truncate(path, 9 * SLOT_SIZE + 13) == 0);
+  sync_log_open(path);
+  CHECK_EQ(sync_log_count(), 9);
+  check_sequences(read_log(), 1, 9);
+
+  // The next append reuses the torn slot and the lost sequence number
+  CHECK(sync_log_append(make_record(1700000010)));
+  CHECK_EQ(sync_log_count(), 10);
+  check_sequences(read_log(), 1, 10);
+}
+
+static void test_corrupted_newest() {
+  write_log(10);
+  corrupt_byte(9 * SLOT_SIZE + 6);
+  sync_log_open(path);
+  CHECK_EQ(sync_log_count(), 9);
+  check_sequences(read_log(), 1, 9);
+  CHECK(sync_log_append(make_record(1700000010)));
+  check_sequences(read_log(), 1, 10);
+}
+
+static void test_corrupted_newest_after_wrap() {
+  // Slots 0-4 hold the second lap; the newest (261) is in slot 4
+  write_log(SYNC_LOG_CAPACITY + 5);
+  corrupt_byte(4 * SLOT_SIZE + 30);
+  sync_log_open(path);
+  CHECK_EQ(sync_log_count(), SYNC_LOG_CAPACITY - 1);
+  check_sequences(read_log(), 6, SYNC_LOG_CAPACITY + 4);
+
+  // Rewrites slot 4 and then replaces the oldest record
+  CHECK(sync_log_append(make_record(1700000000 + SYNC_LOG_CAPACITY + 5)));
+  CHECK(sync_log_append(make_record(1700000000 + SYNC_LOG_CAPACITY + 6)));
+  CHECK_EQ(sync_log_count(), SYNC_LOG_CAPACITY);
+  check_sequences(read_log(), 7, SYNC_LOG_CAPACITY + 6);
+}
+
+static void test_reopen_intact() {
+  write_log(3);
+  sync_log_open(path);
+  CHECK_EQ(sync_log_count(), 3);
+  CHECK(sync_log_append(make_record(1700000004)));
+  check_sequences(read_log(), 1, 4);
+}
+
+int main() {
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    perror("mkstemp");
+    return 1;
+  }
+  close(fd);
+  test_reopen_intact();
+  test_truncated_newest();
+  test_corrupted_newest();
+  test_corrupted_newest_after_wrap();
+  unlink(path);
+  return check_result();
+}
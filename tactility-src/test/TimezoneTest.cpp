@@ -0,0 +1,142 @@
+#include "Check.h"
+
+#include "Timezones.h"
+#include "ZoneRule.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+// The zone table's daylight saving rules against the C library evaluating the
+// same TZ strings, plus the lookups the dashboard and picker use
+
+static ZoneRule rule_of(const char *name) {
+  ZoneRule rule = {};
+  int zone = timezone_find(name);
+  CHECK(zone >= 0);
+  if (zone >= 0) {
+    CHECK(zone_rule_parse(timezone_rule(zone), &rule));
+  }
+  return rule;
+}
+
+static time_t utc(int year, int month, int day, int hour, int minute) {
+  struct tm timeinfo = {};
+  timeinfo.tm_year = year - 1900;
+  timeinfo.tm_mon = month - 1;
+  timeinfo.tm_mday = day;
+  timeinfo.tm_hour = hour;
+  timeinfo.tm_min = minute;
+  return timegm(&timeinfo);
+}
+
+static void test_transitions() {
+  // New York: EDT from 2026-03-08 07:00Z to 2026-11-01 06:00Z
+  ZoneRule new_york = rule_of("America/New_York");
+  CHECK_EQ(zone_rule_offset(new_york, utc(2026, 1, 15, 12, 0)), -5 * 3600);
+  CHECK_EQ(zone_rule_offset(new_york, utc(2026, 3, 8, 6, 59)), -5 * 3600);
+  CHECK_EQ(zone_rule_offset(new_york, utc(2026, 3, 8, 7, 0)), -4 * 3600);
+  CHECK_EQ(zone_rule_offset(new_york, utc(2026, 11, 1, 5, 59)), -4 * 3600);
+  CHECK_EQ(zone_rule_offset(new_york, utc(2026, 11, 1, 6, 0)), -5 * 3600);
+
+  // Southern hemisphere: Sydney is on daylight time over the new year
+  ZoneRule sydney = rule_of("Australia/Sydney");
+  CHECK_EQ(zone_rule_offset(sydney, utc(2026, 1, 1, 0, 0)), 11 * 3600);
+  CHECK_EQ(zone_rule_offset(sydney, utc(2026, 7, 1, 0, 0)), 10 * 3600);
+
+  // Dublin's rule has negative daylight saving: GMT in winter
+  ZoneRule dublin = rule_of("Europe/Dublin");
+  CHECK_EQ(zone_rule_offset(dublin, utc(2026, 1, 15, 12, 0)), 0);
+  CHECK_EQ(zone_rule_offset(dublin, utc(2026, 7, 15, 12, 0)), 3600);
+
+  // Half-hour zones and zones without daylight time
+  CHECK_EQ(zone_rule_offset(rule_of("Asia/Kolkata"), utc(2026, 7, 1, 0, 0)),
+           5 * 3600 + 1800);
+  CHECK_EQ(zone_rule_offset(rule_of("Asia/Tokyo"), utc(2026, 7, 1, 0, 0)),
+           9 * 3600);
+  CHECK_EQ(zone_rule_offset(rule_of("UTC"), utc(2026, 7, 1, 0, 0)), 0);
+}
+
+static void test_parse() {
+  ZoneRule rule;
+  CHECK(zone_rule_parse("<+0545>-5:45", &rule));
+  CHECK_EQ(rule.standard_offset_s, 5 * 3600 + 45 * 60);
+  CHECK(!rule.has_daylight);
+
+  // Julian days and a time past midnight
+  CHECK(zone_rule_parse("AAA3BBB,J60/25,300", &rule));
+  CHECK_EQ(rule.start.kind, ZoneRuleJulian);
+  CHECK_EQ(rule.start.time_s, 25 * 3600);
+  CHECK_EQ(rule.end.kind, ZoneRuleDayOfYear);
+  CHECK_EQ(rule.daylight_offset_s, -2 * 3600);
+
+  const char *invalid[] = {"", "AB1", "EST", "EST5EDT,M3.2.0",
+                           "EST5EDT,M13.2.0,M11.1.0", "<+05-5", "EST5x"};
+  for (const char *text : invalid) {
+    CHECK(!zone_rule_parse(text, &rule));
+  }
+}
+
+// Every rule in the table, hourly through two years, against glibc
+static void test_table_against_libc() {
+  time_t from = utc(2026, 1, 1, 0, 30);
+  time_t to = utc(2028, 1, 1, 0, 0);
+  for (int zone = 0; zone < timezone_count; zone++) {
+    const char *text = timezone_rule(zone);
+    ZoneRule rule;
+    if (!zone_rule_parse(text, &rule)) {
+      CHECK(!"rule does not parse");
+      continue;
+    }
+    setenv("TZ", text, 1);
+    tzset();
+    for (time_t t = from; t < to; t += 3600) {
+      struct tm local;
+      localtime_r(&t, &local);
+      if (zone_rule_offset(rule, t) != local.tm_gmtoff) {
+        CHECK_EQ(zone_rule_offset(rule, t), local.tm_gmtoff);
+        break;
+      }
+    }
+  }
+  unsetenv("TZ");
+  tzset();
+}
+
+static void test_find() {
+  CHECK(timezone_find("UTC") >= 0);
+  int zone = timezone_find("America/New_York");
+  CHECK(zone >= 0 && strcmp(timezone_name(zone), "America/New_York") == 0);
+  // A prefix of other names, a wrong case and a city alone are not zones
+  CHECK_EQ(timezone_find("America/Indiana"), -1);
+  CHECK_EQ(timezone_find("america/new_york"), -1);
+  CHECK_EQ(timezone_find("Tokyo"), -1);
+}
+
+static void test_search() {
+  TimezoneSearch search;
+  timezone_search_reset(&search);
+  timezone_search_update(&search, "tok");
+  CHECK_EQ(search.count, 1);
+  CHECK(strcmp(timezone_name(timezone_search_get(&search, 0)), "Asia/Tokyo") ==
+        0);
+
+  // Too long for any zone: no results, and the next query starts over
+  char query[64];
+  memset(query, 'a', sizeof(query) - 1);
+  query[sizeof(query) - 1] = '\0';
+  timezone_search_update(&search, query);
+  CHECK_EQ(search.count, 0);
+  timezone_search_update(&search, "new");
+  CHECK(search.count >= 1);
+  CHECK(strncmp(timezone_city(timezone_search_get(&search, 0)), "New", 3) == 0);
+}
+
+int main() {
+  test_transitions();
+  test_parse();
+  test_table_against_libc();
+  test_find();
+  test_search();
+  return check_result();
+}
@@ -0,0 +1,218 @@
+#include "Check.h"
+
+#include "HttpFetch.h"
+#include "HttpHost.h"
+#include "WeatherFetch.h"
+
+#include <cstring>
+
+// Weather fetches against canned HTTP responses: the conditional request
+// round trip, 304s, redirects, bodies that are malformed or cut short, and
+// backing off while fetches fail.
+
+constexpr uint32_t INTERVAL_S = 900;
+constexpr const char *URL = "https://api.example.com/v1/forecast";
+constexpr const char *MOVED_URL = "https://eu.example.com/v1/forecast";
+constexpr const char *BODY =
+    "{\"current\":{\"time\":\"2024-03-10T00:00\",\"temperature_2m\":12.5,"
+    "\"weather_code\":3}}";
+constexpr const char *LAST_MODIFIED = "Sun, 10 Mar 2024 00:00:00 GMT";
+
+static std::atomic<bool> stop_requested;
+
+static WeatherConfig weather_config() {
+  WeatherConfig config = {};
+  snprintf(config.url, sizeof(config.url), "%s", URL);
+  snprintf(config.temperature_path, sizeof(config.temperature_path),
+           "current.temperature_2m");
+  snprintf(config.code_path, sizeof(config.code_path), "current.weather_code");
+  config.interval_s = INTERVAL_S;
+  return config;
+}
+
+static HttpCannedResponse ok(const char *etag, const char *body = BODY) {
+  HttpCannedResponse response = {200, {}, body};
+  if (etag) {
+    response.headers.emplace_back("ETag", etag);
+    response.headers.emplace_back("Last-Modified", LAST_MODIFIED);
+  }
+  return response;
+}
+
+static HttpCannedResponse status(int code) { return {code, {}, ""}; }
+
+static HttpCannedResponse redirect(const char *etag) {
+  HttpCannedResponse response = {302, {{"Location", MOVED_URL}}, "Moved"};
+  if (etag) {
+    response.headers.emplace_back("ETag", etag);
+    response.headers.emplace_back("Last-Modified", "Thu, 01 Jan 1970");
+  }
+  return response;
+}
+
+static void start(WeatherFetch *fetch) {
+  http_host_reset();
+  stop_requested = false;
+  weather_fetch_init(fetch, weather_config(), &stop_requested);
+}
+
+static FetchResult fetch_once(WeatherFetch *fetch,
+                              const HttpCannedResponse &response) {
+  http_host_respond(response);
+  WeatherReading reading;
+  return weather_fetch(fetch, &reading);
+}
+
+static const HttpRequest &last_request() { return http_host_requests().back(); }
+
+static void test_round_trip() {
+  WeatherFetch fetch;
+  start(&fetch);
+
+  http_host_respond(ok("\"v1\""));
+  WeatherReading reading;
+  CHECK_EQ(weather_fetch(&fetch, &reading), FetchUpdated);
+  CHECK(reading.has_temperature);
+  CHECK(reading.temperature == 12.5f);
+  CHECK_EQ(reading.code, 3);
+  CHECK_EQ(http_host_requests().size(), 1);
+  CHECK(last_request().url == URL);
+  CHECK(!http_host_request_header(last_request(), "If-None-Match"));
+  CHECK(!http_host_request_header(last_request(), "If-Modified-Since"));
+  CHECK(strcmp(fetch.etag, "\"v1\"") == 0);
+  CHECK(strcmp(fetch.last_modified, LAST_MODIFIED) == 0);
+
+  // The next request is conditional, and a 304 keeps the validators
+  CHECK_EQ(fetch_once(&fetch, status(304)), FetchNotModified);
+  const char *etag = http_host_request_header(last_request(), "If-None-Match");
+  const char *since =
+      http_host_request_header(last_request(), "If-Modified-Since");
+  CHECK(etag && strcmp(etag, "\"v1\"") == 0);
+  CHECK(since && strcmp(since, LAST_MODIFIED) == 0);
+  CHECK(strcmp(fetch.etag, "\"v1\"") == 0);
+
+  // New content replaces them
+  CHECK_EQ(fetch_once(&fetch, ok("\"v2\"")), FetchUpdated);
+  CHECK_EQ(fetch_once(&fetch, status(304)), FetchNotModified);
+  etag = http_host_request_header(last_request(), "If-None-Match");
+  CHECK(etag && strcmp(etag, "\"v2\"") == 0);
+
+  // A 200 without validators clears them
+  CHECK_EQ(fetch_once(&fetch, ok(nullptr)), FetchUpdated);
+  CHECK_EQ(fetch.etag[0], 0);
+  CHECK_EQ(fetch.last_modified[0], 0);
+  CHECK_EQ(fetch_once(&fetch, ok(nullptr)), FetchUpdated);
+  CHECK(!http_host_request_header(last_request(), "If-None-Match"));
+  CHECK_EQ(http_host_pending(), 0);
+}
+
+// Validators on a redirect belong to the redirect, not the final response
+static void test_redirect() {
+  WeatherFetch fetch;
+  start(&fetch);
+
+  http_host_respond(redirect("\"redirect\""));
+  CHECK_EQ(fetch_once(&fetch, ok(nullptr)), FetchUpdated);
+  CHECK_EQ(http_host_requests().size(), 2);
+  CHECK(last_request().url == MOVED_URL);
+  CHECK_EQ(fetch.etag[0], 0);
+  CHECK_EQ(fetch.last_modified[0], 0);
+
+  // The conditional headers follow the redirect; a final 304 keeps what the
+  // last 200 sent rather than the redirect's
+  CHECK_EQ(fetch_once(&fetch, ok("\"v1\"")), FetchUpdated);
+  http_host_respond(redirect("\"redirect\""));
+  CHECK_EQ(fetch_once(&fetch, status(304)), FetchNotModified);
+  const char *etag = http_host_request_header(last_request(), "If-None-Match");
+  CHECK(etag && strcmp(etag, "\"v1\"") == 0);
+  CHECK(strcmp(fetch.etag, "\"v1\"") == 0);
+  CHECK(strcmp(fetch.last_modified, LAST_MODIFIED) == 0);
+
+  // A redirect as the final answer is a failure
+  for (int i = 0; i <= HTTP_MAX_REDIRECTS; i++) {
+    http_host_respond(redirect(nullptr));
+  }
+  CHECK_EQ(fetch_once(&fetch, redirect(nullptr)), FetchFailed);
+  CHECK_EQ(http_host_pending(), 1);
+}
+
+// Bad bodies fail and leave the validators of the last good response
+static void test_bad_bodies() {
+  WeatherFetch fetch;
+  start(&fetch);
+  CHECK_EQ(fetch_once(&fetch, ok("\"v1\"")), FetchUpdated);
+
+  const char *bodies[] = {
+      // Malformed
+      "{\"current\":{\"temperature_2m\":12.5 \"weather_code\":3}}",
+      "<html>Service Unavailable</html>",
+      // Cut short
+      "{\"current\":{\"temperature_2m\":12.5,\"weather_code\":",
+      "{\"current\":{\"temperature_2m\":12.",
+      "",
+      // Valid but without the temperature
+      "{\"current\":{\"weather_code\":3}}",
+      "{\"current\":{\"temperature_2m\":\"warm\",\"weather_code\":3}}",
+  };
+  for (const char *body : bodies) {
+    WeatherReading reading;
+    http_host_respond(ok("\"bad\"", body));
+    CHECK_EQ(weather_fetch(&fetch, &reading), FetchFailed);
+    CHECK(strcmp(fetch.etag, "\"v1\"") == 0);
+  }
+
+  // The connection drops mid-body
+  HttpCannedResponse dropped = ok("\"bad\"");
+  dropped.read_error_at = 40;
+  CHECK_EQ(fetch_once(&fetch, dropped), FetchFailed);
+  CHECK(strcmp(fetch.etag, "\"v1\"") == 0);
+
+  // Byte by byte still parses
+  HttpCannedResponse trickle = ok("\"v2\"");
+  trickle.chunk_size = 1;
+  CHECK_EQ(fetch_once(&fetch, trickle), FetchUpdated);
+  CHECK(strcmp(fetch.etag, "\"v2\"") == 0);
+
+  // Stopping abandons the body
+  stop_requested = true;
+  CHECK_EQ(fetch_once(&fetch, ok("\"v3\"")), FetchFailed);
+  CHECK(strcmp(fetch.etag, "\"v2\"") == 0);
+}
+
+static void test_backoff() {
+  WeatherFetch fetch;
+  start(&fetch);
+  CHECK_EQ(weather_fetch_next(&fetch, fetch_once(&fetch, ok("\"v1\""))),
+           INTERVAL_S);
+
+  HttpCannedResponse unreachable = status(0);
+  unreachable.connect_fails = true;
+  HttpCannedResponse truncated = ok("\"v2\"", "{\"current\":{");
+  const HttpCannedResponse failures[] = {unreachable, status(500),
+                                         status(404), truncated};
+  uint32_t expected_s = FETCH_BACKOFF_MIN_S;
+  for (const HttpCannedResponse &failure : failures) {
+    CHECK_EQ(weather_fetch_next(&fetch, fetch_once(&fetch, failure)),
+             expected_s);
+    CHECK(fetch.schedule.backing_off);
+    expected_s *= 2;
+  }
+  // Failed requests stay conditional on the last good response
+  const char *etag = http_host_request_header(last_request(), "If-None-Match");
+  CHECK(etag && strcmp(etag, "\"v1\"") == 0);
+
+  // A 304 ends the backoff like new content does
+  CHECK_EQ(weather_fetch_next(&fetch, fetch_once(&fetch, status(304))),
+           INTERVAL_S);
+  CHECK(!fetch.schedule.backing_off);
+  CHECK_EQ(weather_fetch_next(&fetch, fetch_once(&fetch, status(503))),
+           FETCH_BACKOFF_MIN_S);
+}
+
+int main() {
+  test_round_trip();
+  test_redirect();
+  test_bad_bodies();
+  test_backoff();
+  return check_result();
+}
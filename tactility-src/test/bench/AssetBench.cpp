@@ -0,0 +1,163 @@
+#include "Bench.h"
+
+#include "RleDecoder.h"
+#include "RleEncoder.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if BENCH_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+// Loading a dial background: the RLE files convert_images.py writes, decoded
+// straight into the draw buffer, against a PNG of the same image. The PNG
+// side is zlib inflate of Sub-filtered RGBA rows (what PNG stores), the
+// unfilter, and the RGBA to RGB565 conversion the display needs, fed from the
+// same 512 byte reads. Both are checked to reproduce the image.
+
+constexpr size_t READ_SIZE = 512;
+
+// Flat background, a bezel ring, tick marks and a shaded center, all with
+// anti-aliased edges: runs where a real dial has them, literals at edges
+static std::vector<uint8_t> make_dial(int size) {
+  std::vector<uint8_t> rgba((size_t)size * (size_t)size * 4);
+  float center = (float)size / 2;
+  for (int y = 0; y < size; y++) {
+    for (int x = 0; x < size; x++) {
+      float dx = (float)x + 0.5f - center;
+      float dy = (float)y + 0.5f - center;
+      float r = sqrtf(dx * dx + dy * dy) / center;
+      float ring = fminf(fmaxf(1 - fabsf(r - 0.95f) * 40, 0), 1);
+      float angle = atan2f(dy, dx) * 30 / (float)M_PI;
+      float tick = (r > 0.78f && r < 0.88f)
+                       ? fminf(fmaxf(1 - fabsf(angle - roundf(angle)) * 8, 0),
+                               1)
+                       : 0;
+      float shade = r < 0.3f ? (0.3f - r) * 2 : 0;
+      float light = fmaxf(fmaxf(ring, tick), shade);
+      uint8_t *pixel = &rgba[((size_t)y * (size_t)size + (size_t)x) * 4];
+      pixel[0] = (uint8_t)(20 + light * 220);
+      pixel[1] = (uint8_t)(24 + light * 200);
+      pixel[2] = (uint8_t)(32 + light * 160);
+      pixel[3] = 255;
+    }
+  }
+  return rgba;
+}
+
+static bool rle_load(const std::vector<uint8_t> &file, uint8_t *out,
+                     size_t size) {
+  RleDecoder decoder;
+  rle_decoder_init(&decoder, out, size, 2);
+  for (size_t offset = 0; offset < file.size(); offset += READ_SIZE) {
+    size_t length =
+        file.size() - offset < READ_SIZE ? file.size() - offset : READ_SIZE;
+    rle_decode(&decoder, file.data() + offset, length);
+  }
+  return rle_decoder_complete(&decoder);
+}
+
+#if BENCH_HAVE_ZLIB
+static std::vector<uint8_t> png_encode(const std::vector<uint8_t> &rgba,
+                                       int size) {
+  size_t row = (size_t)size * 4;
+  std::vector<uint8_t> filtered;
+  for (int y = 0; y < size; y++) {
+    const uint8_t *line = &rgba[(size_t)y * row];
+    filtered.push_back(1); // Sub
+    for (size_t i = 0; i < row; i++) {
+      filtered.push_back((uint8_t)(line[i] - (i >= 4 ? line[i - 4] : 0)));
+    }
+  }
+  uLongf length = compressBound((uLong)filtered.size());
+  std::vector<uint8_t> out(length);
+  compress2(out.data(), &length, filtered.data(), (uLong)filtered.size(), 9);
+  out.resize(length);
+  return out;
+}
+
+// Inflates the whole filtered image first, as PNG decoders that hand out a
+// full RGBA image do, then unfilters and converts
+static bool png_load(const std::vector<uint8_t> &file, int size,
+                     std::vector<uint8_t> *scratch, uint8_t *out) {
+  size_t row = (size_t)size * 4;
+  scratch->resize((row + 1) * (size_t)size);
+  z_stream stream = {};
+  inflateInit(&stream);
+  stream.next_out = scratch->data();
+  stream.avail_out = (uInt)scratch->size();
+  int result = Z_OK;
+  for (size_t offset = 0; offset < file.size() && result == Z_OK;
+       offset += READ_SIZE) {
+    size_t length =
+        file.size() - offset < READ_SIZE ? file.size() - offset : READ_SIZE;
+    stream.next_in = const_cast<uint8_t *>(file.data() + offset);
+    stream.avail_in = (uInt)length;
+    result = inflate(&stream, Z_NO_FLUSH);
+  }
+  inflateEnd(&stream);
+  if (result != Z_STREAM_END) {
+    return false;
+  }
+  for (int y = 0; y < size; y++) {
+    uint8_t *line = &(*scratch)[(size_t)y * (row + 1) + 1];
+    for (size_t i = 4; i < row; i++) {
+      line[i] = (uint8_t)(line[i] + line[i - 4]);
+    }
+    rgb565_pack(line, (size_t)size, 4, out + (size_t)y * (size_t)size * 2);
+  }
+  return true;
+}
+#endif
+
+static void bench_dial(int size) {
+  auto pixels = (size_t)size * (size_t)size;
+  std::vector<uint8_t> rgba = make_dial(size);
+  std::vector<uint8_t> plane(pixels * 2);
+  rgb565_pack(rgba.data(), pixels, 4, plane.data());
+  std::vector<uint8_t> out(plane.size());
+
+  std::vector<uint8_t> rle = rle_encode(plane.data(), plane.size(), 2);
+  if (!rle_load(rle, out.data(), out.size()) || out != plane) {
+    fprintf(stderr, "RLE round trip failed\n");
+    return;
+  }
+  char name[64];
+  snprintf(name, sizeof(name), "rle %dpx (%zu -> %zu bytes)", size,
+           rle.size(), plane.size());
+  bench_report("assets", name, bench_ns(500, [&](uint32_t) {
+                 rle_load(rle, out.data(), out.size());
+                 bench_keep(out.data());
+               }));
+  printf("%-12s %-40s %10zu bytes\n", "assets", "  rle peak RAM",
+         plane.size() + READ_SIZE);
+
+#if BENCH_HAVE_ZLIB
+  std::vector<uint8_t> png = png_encode(rgba, size);
+  std::vector<uint8_t> scratch;
+  std::fill(out.begin(), out.end(), 0);
+  if (!png_load(png, size, &scratch, out.data()) || out != plane) {
+    fprintf(stderr, "PNG round trip failed\n");
+    return;
+  }
+  snprintf(name, sizeof(name), "png %dpx (%zu -> %zu bytes)", size,
+           png.size(), plane.size());
+  bench_report("assets", name, bench_ns(100, [&](uint32_t) {
+                 png_load(png, size, &scratch, out.data());
+                 bench_keep(out.data());
+               }));
+  // zlib's inflate state is about 7 KB plus the 32 KB window
+  printf("%-12s %-40s %10zu bytes\n", "assets", "  png peak RAM",
+         plane.size() + scratch.size() + 7 * 1024 + 32 * 1024 + READ_SIZE);
+#else
+  printf("%-12s %-40s\n", "assets", "png: zlib not found, skipped");
+#endif
+}
+
+void bench_assets() {
+  bench_dial(240);
+  bench_dial(480);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+// Minimal timing harness for the host benchmarks. Host numbers are only good
+// for comparing approaches; the ESP32 is roughly 10-20x slower per operation.
+
+// Set by --quick: fewer iterations, for the smoke test
+extern bool bench_quick;
+
+// Keeps the compiler from dropping work whose result is unused
+inline void bench_keep(const void *pointer) {
+  asm volatile("" : : "g"(pointer) : "memory");
+}
+
+// Average nanoseconds per call of `fn` over `iterations` calls
+template <typename Fn> double bench_ns(uint32_t iterations, Fn &&fn) {
+  if (bench_quick) {
+    iterations = iterations / 100 + 1;
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < iterations; i++) {
+    fn(i);
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / iterations;
+}
+
+void bench_report(const char *group, const char *name, double ns);
+
+void bench_core();
+void bench_raster();
+void bench_ics();
+void bench_assets();
+void bench_locale();
+void bench_sleep();
+void bench_faces();
+void bench_power();
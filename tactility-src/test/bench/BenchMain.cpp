@@ -0,0 +1,33 @@
+#include "Bench.h"
+
+#include <cstdio>
+#include <cstring>
+
+bool bench_quick = false;
+
+void bench_report(const char *group, const char *name, double ns) {
+  if (ns >= 1e6) {
+    printf("%-12s %-40s %10.2f ms\n", group, name, ns / 1e6);
+  } else if (ns >= 1e4) {
+    printf("%-12s %-40s %10.2f us\n", group, name, ns / 1e3);
+  } else {
+    printf("%-12s %-40s %10.1f ns\n", group, name, ns);
+  }
+}
+
+int main(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--quick") == 0) {
+      bench_quick = true;
+    }
+  }
+  bench_core();
+  bench_raster();
+  bench_ics();
+  bench_assets();
+  bench_locale();
+  bench_sleep();
+  bench_faces();
+  bench_power();
+  return 0;
+}
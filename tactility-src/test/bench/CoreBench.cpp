@@ -0,0 +1,56 @@
+#include "Bench.h"
+
+#include "ClockCore.h"
+
+// Per-second work of the faces: what ClockFrame precomputes on the other core
+// and what the LVGL task falls back to when no frame matches
+
+static struct tm time_at(uint32_t second) {
+  struct tm timeinfo = {};
+  timeinfo.tm_year = 126;
+  timeinfo.tm_mon = 9;
+  timeinfo.tm_mday = 17;
+  timeinfo.tm_wday = 6;
+  timeinfo.tm_yday = 289;
+  timeinfo.tm_hour = (int)(second / 3600 % 24);
+  timeinfo.tm_min = (int)(second / 60 % 60);
+  timeinfo.tm_sec = (int)(second % 60);
+  return timeinfo;
+}
+
+void bench_core() {
+  const LocaleInfo *locale = locale_default();
+
+  bench_report("core", "clock_core_hands", bench_ns(1000000, [](uint32_t i) {
+                 ClockHands hands;
+                 clock_core_hands(&hands, time_at(i));
+                 bench_keep(&hands);
+               }));
+
+  ClockHands hands;
+  clock_core_hands(&hands, time_at(37230));
+  bench_report("core", "clock_core_hand_end x3",
+               bench_ns(1000000, [&hands](uint32_t i) {
+                 auto length = (int32_t)(60 + (i & 63));
+                 ClockPoint points[3];
+                 for (int hand = 0; hand < 3; hand++) {
+                   points[hand] = clock_core_hand_end(hands, (ClockHand)hand,
+                                                      120, 120, length);
+                 }
+                 bench_keep(points);
+               }));
+
+  bench_report("core", "clock_core_texts",
+               bench_ns(200000, [locale](uint32_t i) {
+                 ClockTexts texts;
+                 clock_core_texts(&texts, time_at(i), locale);
+                 bench_keep(&texts);
+               }));
+
+  bench_report("core", "clock_core_sizes", bench_ns(200000, [](uint32_t i) {
+                 ClockSizes sizes;
+                 clock_core_sizes(&sizes, (int32_t)(240 + (i & 255)),
+                                  (int32_t)(240 + (i & 127)));
+                 bench_keep(&sizes);
+               }));
+}
@@ -0,0 +1,88 @@
+#include "Bench.h"
+
+#include "ClockWidget.h"
+#include "FaceHost.h"
+#include "LvglHost.h"
+
+#include <cstdio>
+#include <vector>
+
+// What each face costs per second against the analog face, on the host LVGL
+// stand-in (see lvgl/lvgl.h). "tick" is the face's own update: formatting,
+// widget changes and layout. "tick + redraw" adds redrawing the areas the
+// tick invalidated, as LVGL does on the device; the stand-in's renderer is
+// not LVGL's, so it ranks the faces' drawing by cost rather than predicting
+// frame times.
+
+constexpr time_t BENCH_TIME = 1710028727; // 2024-03-09 23:58:47 UTC
+constexpr int32_t WIDTH = 320;
+constexpr int32_t HEIGHT = 218;
+
+// Analog first, as the baseline
+constexpr int FACE_ORDER[ClockFaceCount] = {
+    ClockFaceAnalog, ClockFaceBinary,        ClockFaceWords,
+    ClockFaceDigital, ClockFaceAnalogTapered, ClockFaceNight,
+    ClockFaceDashboard,
+};
+
+static lv_obj_t *create_container() {
+  lv_obj_t *screen = lv_host_screen_create(WIDTH, HEIGHT);
+  lv_obj_t *container = lv_obj_create(screen);
+  lv_obj_set_size(container, WIDTH, HEIGHT);
+  lv_obj_set_style_border_width(container, 0, 0);
+  lv_obj_set_style_pad_all(container, 0, 0);
+  lv_obj_set_layout(container, LV_LAYOUT_FLEX);
+  lv_obj_set_flex_flow(container, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_flex_align(container, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER,
+                        LV_FLEX_ALIGN_CENTER);
+  return container;
+}
+
+static void bench_face(int face, const ClockFaceSettings &settings) {
+  const char *face_name = clock_faces[face].name;
+  char name[64];
+  lv_obj_t *container = create_container();
+  clock_tick_set_fixed_time(BENCH_TIME);
+
+  snprintf(name, sizeof(name), "%s, create", face_name);
+  bench_report("faces", name, bench_ns(2000, [&](uint32_t) {
+                 lv_obj_t *widget =
+                     clock_widget_create(container, face, settings);
+                 lv_obj_update_layout(container);
+                 lv_obj_delete(widget);
+               }));
+
+  clock_widget_create(container, face, settings);
+  lv_obj_update_layout(container);
+  snprintf(name, sizeof(name), "%s, tick", face_name);
+  bench_report("faces", name, bench_ns(20000, [&](uint32_t i) {
+                 clock_tick_set_fixed_time(BENCH_TIME + (time_t)i);
+                 face_host_tick();
+                 lv_obj_update_layout(container);
+               }));
+
+  std::vector<uint8_t> pixels((size_t)WIDTH * HEIGHT * 3);
+  snprintf(name, sizeof(name), "%s, tick + redraw", face_name);
+  bench_report("faces", name, bench_ns(500, [&](uint32_t i) {
+                 clock_tick_set_fixed_time(BENCH_TIME + (time_t)i);
+                 face_host_tick();
+                 lv_host_render(pixels.data());
+                 bench_keep(pixels.data());
+               }));
+
+  lv_host_screen_delete();
+}
+
+void bench_faces() {
+  ClockFaceSettings settings = {};
+  settings.ui_scale = UiScaleDefault;
+  settings.locale = locale_default();
+  for (DashboardZone &zone : settings.dashboard_zones) {
+    snprintf(zone.name, sizeof(zone.name), "UTC");
+    zone_rule_fixed(&zone.rule, 0);
+  }
+  face_host_set_24_hour(true);
+  for (int face : FACE_ORDER) {
+    bench_face(face, settings);
+  }
+}
@@ -0,0 +1,73 @@
+#include "Bench.h"
+
+#include "IcsParser.h"
+
+#include <cstdio>
+#include <string>
+
+// A multi-megabyte calendar fed in the calendar service's 512 byte chunks:
+// years of history, recurring events and long folded descriptions, as
+// exported by a busy shared calendar
+
+constexpr size_t CHUNK_SIZE = 512;
+constexpr int EVENT_COUNT = 16000;
+
+static std::string make_calendar() {
+  std::string text = "BEGIN:VCALENDAR\r\nVERSION:2.0\r\n";
+  char line[160];
+  for (int i = 0; i < EVENT_COUNT; i++) {
+    int year = 2016 + i % 11;
+    int month = 1 + i % 12;
+    int day = 1 + i % 28;
+    text += "BEGIN:VEVENT\r\n";
+    snprintf(line, sizeof(line),
+             "UID:%08d-busy-shared-calendar@example.com\r\n"
+             "DTSTART:%04d%02d%02dT%02d%02d00Z\r\n",
+             i, year, month, day, 8 + i % 10, (i % 4) * 15);
+    text += line;
+    snprintf(line, sizeof(line), "SUMMARY:Meeting %d about topic %d\r\n", i,
+             i % 97);
+    text += line;
+    if (i % 5 == 0) {
+      text += "RRULE:FREQ=WEEKLY;INTERVAL=1;COUNT=52\r\n";
+    }
+    text += "DESCRIPTION:Agenda: review the open items from last time and "
+            "agree\r\n on owners for the follow-ups. Dial-in details and "
+            "the room are\r\n in the invitation; notes go to the shared "
+            "folder afterwards.\r\n";
+    text += "BEGIN:VALARM\r\nTRIGGER:-PT10M\r\nACTION:DISPLAY\r\n"
+            "END:VALARM\r\nEND:VEVENT\r\n";
+  }
+  text += "END:VCALENDAR\r\n";
+  return text;
+}
+
+void bench_ics() {
+  std::string text = make_calendar();
+  static IcsParser parser;
+  static CalendarIndex index;
+  // 2026-10-17 UTC, 30 days ahead
+  const time_t window_start = 1792195200;
+  const time_t window_end = window_start + 30 * 24 * 60 * 60;
+
+  double ns = bench_ns(5, [&](uint32_t) {
+    calendar_index_clear(&index);
+    ics_parser_init(&parser, &index, window_start, window_end);
+    for (size_t offset = 0; offset < text.size(); offset += CHUNK_SIZE) {
+      size_t length = text.size() - offset < CHUNK_SIZE ? text.size() - offset
+                                                        : CHUNK_SIZE;
+      ics_parser_feed(&parser, text.data() + offset, length);
+    }
+    ics_parser_finish(&parser);
+    bench_keep(&index);
+  });
+
+  char name[64];
+  snprintf(name, sizeof(name), "parse %.1f MB, %d events",
+           (double)text.size() / 1e6, EVENT_COUNT);
+  bench_report("ics", name, ns);
+  bench_report("ics", "per event", ns / EVENT_COUNT);
+  printf("%-12s %-40s %10.1f MB/s\n", "ics", "throughput",
+         (double)text.size() / (ns / 1e9) / 1e6);
+  printf("%-12s %-40s %10d\n", "ics", "occurrences indexed", index.count);
+}
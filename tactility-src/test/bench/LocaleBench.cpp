@@ -0,0 +1,75 @@
+#include "Bench.h"
+
+#include "Locale.h"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+// locale_format() against the C library's strftime() on the patterns the
+// faces format every second or minute. English in the "C" locale, so both
+// must produce the same text.
+
+struct Pattern {
+  const char *name;
+  const char *format;
+};
+
+static const Pattern patterns[] = {
+    {"date long", "%A, %B %d, %Y"},
+    {"date short", "%m/%d/%Y"},
+    {"weekday day", "%a %d"},
+    {"time 24h", "%H:%M:%S"},
+    {"time 12h", "%I:%M %p"},
+};
+
+static struct tm time_at(uint32_t i) {
+  struct tm timeinfo = {};
+  timeinfo.tm_year = 126;
+  timeinfo.tm_mon = (int)(i % 12);
+  timeinfo.tm_mday = (int)(1 + i % 28);
+  timeinfo.tm_wday = (int)(i % 7);
+  timeinfo.tm_hour = (int)(i % 24);
+  timeinfo.tm_min = (int)(i % 60);
+  timeinfo.tm_sec = (int)(i * 7 % 60);
+  return timeinfo;
+}
+
+void bench_locale() {
+  const LocaleInfo *locale = locale_find("en");
+  if (!locale) {
+    fprintf(stderr, "English locale not built in\n");
+    return;
+  }
+  for (const Pattern &pattern : patterns) {
+    for (uint32_t i = 0; i < 24; i++) {
+      char ours[64];
+      char theirs[64];
+      struct tm timeinfo = time_at(i);
+      locale_format(ours, sizeof(ours), pattern.format, locale, timeinfo);
+      strftime(theirs, sizeof(theirs), pattern.format, &timeinfo);
+      if (strcmp(ours, theirs) != 0) {
+        fprintf(stderr, "%s: \"%s\" but strftime gives \"%s\"\n",
+                pattern.name, ours, theirs);
+        return;
+      }
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "locale_format %s", pattern.name);
+    bench_report("locale", name, bench_ns(500000, [&](uint32_t i) {
+                   char out[64];
+                   struct tm timeinfo = time_at(i);
+                   locale_format(out, sizeof(out), pattern.format, locale,
+                                 timeinfo);
+                   bench_keep(out);
+                 }));
+    snprintf(name, sizeof(name), "strftime %s", pattern.name);
+    bench_report("locale", name, bench_ns(500000, [&](uint32_t i) {
+                   char out[64];
+                   struct tm timeinfo = time_at(i);
+                   strftime(out, sizeof(out), pattern.format, &timeinfo);
+                   bench_keep(out);
+                 }));
+  }
+}
@@ -0,0 +1,104 @@
+#include "Bench.h"
+
+#include "ClockWidget.h"
+#include "FaceHost.h"
+#include "LvglHost.h"
+#include "PowerBudget.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// Estimated battery drain of each face, from a simulated hour on the host
+// LVGL stand-in run through the device's power model (PowerBudget.h). Every
+// tick wakes the device once, runs the face's update and redraws what it
+// invalidated; the measured host time, scaled to the ESP32, is the busy time
+// and the redrawn pixels as RGB565 are the flushed bytes. The on-device
+// PowerBudget log measures the same on real hardware and is the cross-check.
+//
+// The modes are the quality governor's settings: ticking every second with
+// seconds shown, every second without them, and every minute without them
+// (see apply_quality() in Clock.cpp).
+
+constexpr time_t BENCH_TIME = 1710028727; // 2024-03-09 23:58:47 UTC
+constexpr int32_t WIDTH = 320;
+constexpr int32_t HEIGHT = 218;
+constexpr int SIMULATED_S = 60 * 60;
+// Host time to ESP32 time, from the middle of Bench.h's 10-20x
+constexpr double DEVICE_SLOWDOWN = 15;
+constexpr uint32_t BYTES_PER_PIXEL = 2; // RGB565 panel
+
+struct PowerMode {
+  const char *name;
+  uint32_t interval_s;
+  bool hide_seconds;
+};
+
+constexpr PowerMode POWER_MODES[] = {
+    {"seconds", 1, false},
+    {"no seconds", 1, true},
+    {"minutes", 60, true},
+};
+
+static PowerUsage simulate(int face, const PowerMode &mode,
+                           ClockFaceSettings settings) {
+  settings.hide_seconds = mode.hide_seconds;
+  lv_obj_t *screen = lv_host_screen_create(WIDTH, HEIGHT);
+  lv_obj_t *container = lv_obj_create(screen);
+  lv_obj_set_size(container, WIDTH, HEIGHT);
+  lv_obj_set_style_border_width(container, 0, 0);
+  lv_obj_set_style_pad_all(container, 0, 0);
+  clock_tick_set_fixed_time(BENCH_TIME);
+  clock_widget_create(container, face, settings);
+  std::vector<uint8_t> pixels((size_t)WIDTH * HEIGHT * 3);
+  lv_host_render(pixels.data());
+
+  // --quick simulates a minute per interval only
+  int simulated_s = bench_quick ? (int)mode.interval_s : SIMULATED_S;
+  PowerUsage usage = {};
+  usage.elapsed_us = (int64_t)simulated_s * 1000000;
+  for (int s = (int)mode.interval_s; s <= simulated_s;
+       s += (int)mode.interval_s) {
+    clock_tick_set_fixed_time(BENCH_TIME + s);
+    auto start = std::chrono::steady_clock::now();
+    face_host_tick();
+    uint32_t redrawn = lv_host_render(pixels.data());
+    std::chrono::duration<double, std::micro> host_us =
+        std::chrono::steady_clock::now() - start;
+    usage.busy_us += (int64_t)(host_us.count() * DEVICE_SLOWDOWN);
+    usage.wakeups++;
+    usage.flushed_bytes += (uint64_t)redrawn * BYTES_PER_PIXEL;
+  }
+  bench_keep(pixels.data());
+  lv_host_screen_delete();
+  return usage;
+}
+
+void bench_power() {
+  ClockFaceSettings settings = {};
+  settings.ui_scale = UiScaleDefault;
+  settings.locale = locale_default();
+  for (DashboardZone &zone : settings.dashboard_zones) {
+    snprintf(zone.name, sizeof(zone.name), "UTC");
+    zone_rule_fixed(&zone.rule, 0);
+  }
+  face_host_set_24_hour(true);
+  power_budget_configure(power_model_default());
+
+  for (int face = 0; face < ClockFaceCount; face++) {
+    for (const PowerMode &mode : POWER_MODES) {
+      PowerUsage usage = simulate(face, mode, settings);
+      double hours = (double)usage.elapsed_us / 3600e6;
+      char name[64];
+      snprintf(name, sizeof(name), "%s, %s", clock_faces[face].name,
+               mode.name);
+      printf("%-12s %-40s %7.1f mAh/day  busy %6.0f ms/h  %4.0f wakeups/h  "
+             "%7.0f KB/h\n",
+             "power", name,
+             (double)power_budget_estimate_mah_per_day(usage),
+             (double)usage.busy_us / 1000 / hours,
+             (double)usage.wakeups / hours,
+             (double)usage.flushed_bytes / 1024 / hours);
+    }
+  }
+}
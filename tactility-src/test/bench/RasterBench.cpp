@@ -0,0 +1,130 @@
+#include "Bench.h"
+
+#include "HandRasterizer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// HandRasterizer against the way LVGL's software renderer draws a wide
+// anti-aliased line: every pixel of the line's bounding box gets a coverage
+// from its distance to the line. This stands in for lv_line, which cannot be
+// built on the host; it does the same per-pixel work without LVGL's mask
+// bookkeeping, so it flatters the line side if anything.
+
+struct Line {
+  float x1, y1, x2, y2, width;
+};
+
+static void draw_line(CoverageBuffer *buffer, const Line &line) {
+  float half = line.width / 2;
+  int32_t x1 = (int32_t)floorf(fminf(line.x1, line.x2) - half - 1);
+  int32_t x2 = (int32_t)ceilf(fmaxf(line.x1, line.x2) + half + 1);
+  int32_t y1 = (int32_t)floorf(fminf(line.y1, line.y2) - half - 1);
+  int32_t y2 = (int32_t)ceilf(fmaxf(line.y1, line.y2) + half + 1);
+  x1 = x1 < 0 ? 0 : x1;
+  y1 = y1 < 0 ? 0 : y1;
+  x2 = x2 >= buffer->width ? buffer->width - 1 : x2;
+  y2 = y2 >= buffer->height ? buffer->height - 1 : y2;
+
+  float dx = line.x2 - line.x1;
+  float dy = line.y2 - line.y1;
+  float length_sq = dx * dx + dy * dy;
+  for (int32_t y = y1; y <= y2; y++) {
+    uint8_t *row = buffer->data + y * buffer->stride;
+    for (int32_t x = x1; x <= x2; x++) {
+      float px = (float)x + 0.5f - line.x1;
+      float py = (float)y + 0.5f - line.y1;
+      float t = (px * dx + py * dy) / length_sq;
+      t = t < 0 ? 0 : (t > 1 ? 1 : t);
+      float ex = px - t * dx;
+      float ey = py - t * dy;
+      float coverage = half + 0.5f - sqrtf(ex * ex + ey * ey);
+      if (coverage > 0) {
+        auto value = (uint8_t)(coverage >= 1 ? 255 : coverage * 255);
+        if (value > row[x]) {
+          row[x] = value;
+        }
+      }
+    }
+  }
+}
+
+static HandShape shape(float size, float length, float tail, float tip,
+                       float base, float tail_width) {
+  return {size * length, size * tail, size * tip, size * base,
+          size * tail_width, 0, 0};
+}
+
+// Hour, minute and second hands of a `size` pixel dial at 10:08:37, as the
+// tapered face draws them and as plain lines of the analog face's widths
+static void bench_dial(int32_t size) {
+  std::vector<uint8_t> pixels((size_t)size * (size_t)size);
+  CoverageBuffer buffer = {pixels.data(), size, size, size};
+  RasterRect all = {0, 0, size - 1, size - 1};
+  auto center = (float)size / 2;
+  auto scale = (float)size;
+
+  HandShape shapes[3] = {
+      shape(scale, 0.25f, 0.06f, 0.012f, 0.05f, 0.03f),
+      shape(scale, 0.35f, 0.08f, 0.008f, 0.036f, 0.02f),
+      shape(scale, 0.4f, 0.16f, 0.004f, 0.012f, 0.012f),
+  };
+  shapes[2].counterweight_radius = scale * 0.03f;
+  shapes[2].counterweight_offset = scale * 0.12f;
+  const float degrees[3] = {304.0f - 90, 48.0f - 90, 222.0f - 90};
+  const float widths[3] = {6, 4, 2};
+
+  char name[64];
+  snprintf(name, sizeof(name), "tapered hands, %dpx dial", (int)size);
+  bench_report("raster", name, bench_ns(2000, [&](uint32_t) {
+                 raster_clear(&buffer, all);
+                 for (int hand = 0; hand < 3; hand++) {
+                   float radians = degrees[hand] * (float)M_PI / 180.0f;
+                   RasterPolygon polygons[2];
+                   int count = raster_build_hand(shapes[hand], center, center,
+                                                 cosf(radians), sinf(radians),
+                                                 polygons);
+                   for (int i = 0; i < count; i++) {
+                     raster_fill_polygon(&buffer, polygons[i], all);
+                   }
+                 }
+                 bench_keep(pixels.data());
+               }));
+
+  snprintf(name, sizeof(name), "distance-field lines, %dpx dial", (int)size);
+  bench_report("raster", name, bench_ns(2000, [&](uint32_t) {
+                 raster_clear(&buffer, all);
+                 for (int hand = 0; hand < 3; hand++) {
+                   float radians = degrees[hand] * (float)M_PI / 180.0f;
+                   Line line = {center, center,
+                                center + shapes[hand].length * cosf(radians),
+                                center + shapes[hand].length * sinf(radians),
+                                widths[hand]};
+                   draw_line(&buffer, line);
+                 }
+                 bench_keep(pixels.data());
+               }));
+
+  // What a seconds update costs now that the layer is cut to the hand
+  float radians = degrees[2] * (float)M_PI / 180.0f;
+  RasterPolygon polygons[2];
+  int count = raster_build_hand(shapes[2], center, center, cosf(radians),
+                                sinf(radians), polygons);
+  RasterRect bounds = raster_rect_union(raster_polygon_bounds(polygons[0]),
+                                        raster_polygon_bounds(polygons[1]));
+  snprintf(name, sizeof(name), "second hand, %dx%d box",
+           (int)(bounds.x2 - bounds.x1 + 1), (int)(bounds.y2 - bounds.y1 + 1));
+  bench_report("raster", name, bench_ns(5000, [&](uint32_t) {
+                 raster_clear(&buffer, bounds);
+                 for (int i = 0; i < count; i++) {
+                   raster_fill_polygon(&buffer, polygons[i], bounds);
+                 }
+                 bench_keep(pixels.data());
+               }));
+}
+
+void bench_raster() {
+  bench_dial(240);
+  bench_dial(480);
+}
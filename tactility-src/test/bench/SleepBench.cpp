@@ -0,0 +1,78 @@
+#include "Bench.h"
+
+#include "ClockCore.h"
+#include "SleepSchedule.h"
+
+#include <cstdio>
+
+// CPU-awake time of a night with the panel blanked: the clock ticking every
+// second (screen_off_s = 0) against pausing once ScreenSleep decides the
+// panel is off (screen_off_s = 60). Wakeups come from the real sleep
+// schedule; each is charged the measured host cost of its work. Rendering
+// and flushing only happen awake and are left out, so the awake side is a
+// lower bound.
+
+constexpr uint32_t NIGHT_MS = 8 * 60 * 60 * 1000;
+constexpr uint32_t TIMEOUT_MS = 60 * 1000;
+
+struct NightWakeups {
+  uint32_t ticks;  // Clock tick and frame precompute, once a second each
+  uint32_t checks; // ScreenSleep's timer
+};
+
+// The last input is at 0 and none follows
+static NightWakeups simulate_night(uint32_t timeout_ms) {
+  NightWakeups wakeups = {0, 0};
+  bool asleep = false;
+  uint32_t next_check_ms = timeout_ms;
+  for (uint32_t now_ms = 1000; now_ms <= NIGHT_MS; now_ms += 1000) {
+    if (timeout_ms && now_ms >= next_check_ms) {
+      SleepCheck check = sleep_schedule_check(timeout_ms, now_ms);
+      asleep = check.asleep;
+      next_check_ms = now_ms + check.next_check_ms;
+      wakeups.checks++;
+    }
+    if (!asleep) {
+      wakeups.ticks += 2;
+    }
+  }
+  return wakeups;
+}
+
+void bench_sleep() {
+  const LocaleInfo *locale = locale_default();
+  // Per second while updating: the frame's hands and texts
+  double tick_ns = bench_ns(200000, [locale](uint32_t i) {
+    struct tm timeinfo = {};
+    timeinfo.tm_year = 126;
+    timeinfo.tm_mday = 17;
+    timeinfo.tm_hour = (int)(i / 3600 % 24);
+    timeinfo.tm_min = (int)(i / 60 % 60);
+    timeinfo.tm_sec = (int)(i % 60);
+    ClockHands hands;
+    ClockTexts texts;
+    clock_core_hands(&hands, timeinfo);
+    clock_core_texts(&texts, timeinfo, locale);
+    bench_keep(&hands);
+    bench_keep(&texts);
+  });
+  double check_ns = bench_ns(1000000, [](uint32_t i) {
+    SleepCheck check = sleep_schedule_check(TIMEOUT_MS, i * 1000);
+    bench_keep(&check);
+  });
+  bench_report("sleep", "per-second frame work", tick_ns);
+  bench_report("sleep", "sleep check", check_ns);
+
+  const uint32_t timeouts[2] = {0, TIMEOUT_MS};
+  const char *names[2] = {"8 h night, always updating",
+                          "8 h night, screen_off_s = 60"};
+  for (int i = 0; i < 2; i++) {
+    NightWakeups wakeups = simulate_night(timeouts[i]);
+    // Half of the tick wakeups do the frame work, the other half apply it
+    double busy_ns =
+        (double)wakeups.ticks / 2 * tick_ns + (double)wakeups.checks * check_ns;
+    bench_report("sleep", names[i], busy_ns);
+    printf("%-12s %-40s %10u\n", "sleep", "  wakeups",
+           (unsigned)(wakeups.ticks + wakeups.checks));
+  }
+}
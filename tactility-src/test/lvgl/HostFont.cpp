@@ -0,0 +1,300 @@
+// Generated by generate_font.py from Pillow's built-in font; do not edit.
+
+#include "lvgl.h"
+
+static const uint8_t bitmap[] = {
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1A, 0x00,
+    0x1C, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x0B, 0x1B, 0x00, 0x00,
+    0x0B, 0x0B, 0x00, 0x00, 0x2A, 0x39, 0x00, 0x08, 0xCD, 0xCC, 0x70, 0x00, 0x93, 0xA2, 0x00, 0x1D,
+    0xED, 0xED, 0x30, 0x01, 0xB1, 0xA0, 0x00, 0x04, 0x84, 0x70, 0x00, 0x07, 0x57, 0x40, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x05, 0xDF, 0xD8, 0x00, 0x1E, 0x7F, 0x1B, 0x80, 0x3F, 0x4F, 0x03, 0x60, 0x1E,
+    0xAF, 0x00, 0x00, 0x03, 0xCF, 0xE8, 0x10, 0x00, 0x3F, 0x4C, 0xA0, 0x56, 0x3F, 0x04, 0xE0, 0x7E,
+    0x4F, 0x08, 0xB0, 0x1A, 0xEF, 0xD9, 0x10, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xDD, 0x50, 0x1A, 0x00,
+    0x2F, 0x25, 0xE0, 0x84, 0x00, 0x2F, 0x36, 0xE3, 0xA0, 0x00, 0x06, 0xDC, 0x5C, 0x20, 0x00, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0xD1, 0x8C, 0x50, 0x00, 0x0B, 0x52, 0xF5, 0xE0, 0x00, 0x5C,
+    0x02, 0xF5, 0xE0, 0x01, 0xE3, 0x00, 0xAE, 0x70, 0x02, 0xAC, 0xDD, 0x00, 0x00, 0x0D, 0x70, 0x00,
+    0x00, 0x00, 0x2F, 0x10, 0x01, 0x50, 0x00, 0x0D, 0x60, 0x03, 0xF0, 0x00, 0x02, 0xDF, 0xDD, 0xFD,
+    0x30, 0x0C, 0x91, 0x03, 0xF0, 0x00, 0x2F, 0x10, 0x03, 0xF0, 0x00, 0x1E, 0x60, 0x03, 0xF0, 0x00,
+    0x04, 0xBD, 0xDD, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x94, 0x03, 0xC0, 0x0A,
+    0x70, 0x0E, 0x30, 0x2F, 0x10, 0x3F, 0x00, 0x2F, 0x10, 0x0E, 0x30, 0x0A, 0x70, 0x03, 0xC0, 0x00,
+    0x94, 0x76, 0x00, 0x1D, 0x10, 0x0A, 0x70, 0x06, 0xB0, 0x04, 0xE0, 0x03, 0xF0, 0x04, 0xE0, 0x06,
+    0xB0, 0x0A, 0x70, 0x1D, 0x10, 0x76, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x23, 0x3F, 0x04, 0x00, 0x28,
+    0xBF, 0xA7, 0x10, 0x01, 0xC6, 0xA0, 0x00, 0x08, 0x50, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0xDF, 0xDD, 0x50, 0x00,
+    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0xB0, 0x0A, 0x70, 0x1E, 0x10, 0x7D, 0xD2, 0x1A,
+    0x1C, 0x00, 0x00, 0xB0, 0x00, 0x05, 0x70, 0x00, 0x0A, 0x20, 0x00, 0x1B, 0x00, 0x00, 0x57, 0x00,
+    0x00, 0xA2, 0x00, 0x01, 0xB0, 0x00, 0x06, 0x60, 0x00, 0x0B, 0x10, 0x00, 0x06, 0x00, 0x00, 0x01,
+    0xAE, 0xD8, 0x00, 0x09, 0xB0, 0x1D, 0x60, 0x0E, 0x40, 0x07, 0xC0, 0x2F, 0x10, 0x04, 0xE0, 0x3F,
+    0x00, 0x03, 0xF0, 0x2F, 0x10, 0x04, 0xE0, 0x0E, 0x40, 0x07, 0xC0, 0x09, 0xB0, 0x1D, 0x60, 0x01,
+    0xAD, 0xD8, 0x00, 0x04, 0xCF, 0x00, 0x8D, 0x8F, 0x00, 0x51, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x8D,
+    0xDB, 0x20, 0x08, 0xB0, 0x09, 0xC0, 0x0C, 0x40, 0x04, 0xF0, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00,
+    0x4E, 0x30, 0x00, 0x04, 0xE4, 0x00, 0x00, 0x4E, 0x40, 0x00, 0x04, 0xE3, 0x00, 0x00, 0x2F, 0xED,
+    0xDD, 0xC0, 0x00, 0x9D, 0xDB, 0x30, 0x09, 0xA0, 0x08, 0xD0, 0x09, 0x20, 0x04, 0xE0, 0x00, 0x00,
+    0x1B, 0x70, 0x00, 0x07, 0xFD, 0x30, 0x00, 0x00, 0x19, 0xC0, 0x3A, 0x00, 0x04, 0xE0, 0x1E, 0x60,
+    0x09, 0xA0, 0x03, 0xCD, 0xD9, 0x10, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x04, 0xEF, 0x00, 0x00, 0x1D,
+    0x6F, 0x00, 0x00, 0xA8, 0x3F, 0x00, 0x06, 0xC0, 0x3F, 0x00, 0x2E, 0x30, 0x3F, 0x00, 0x9E, 0xDD,
+    0xDF, 0xD2, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xED, 0xDD, 0x80, 0x09, 0x60,
+    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0D, 0x8C, 0xD9, 0x10, 0x0F, 0x80, 0x1B, 0x90, 0x02, 0x00,
+    0x04, 0xE0, 0x19, 0x00, 0x04, 0xE0, 0x0D, 0x70, 0x1B, 0x90, 0x03, 0xBD, 0xD8, 0x00, 0x00, 0x7D,
+    0xDA, 0x10, 0x06, 0xB1, 0x0A, 0x90, 0x0D, 0x40, 0x02, 0x70, 0x1F, 0x6C, 0xD9, 0x10, 0x3F, 0x90,
+    0x1B, 0x90, 0x3F, 0x20, 0x04, 0xE0, 0x1F, 0x10, 0x04, 0xE0, 0x0A, 0x80, 0x1B, 0x80, 0x01, 0xAD,
+    0xD8, 0x00, 0x4D, 0xDD, 0xDE, 0xE0, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x4E, 0x10, 0x00, 0x00,
+    0xC6, 0x00, 0x00, 0x05, 0xD0, 0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0xD5,
+    0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x03, 0xBD, 0xDA, 0x20, 0x0E, 0x60, 0x09, 0xC0, 0x2F, 0x10,
+    0x04, 0xF0, 0x0D, 0x70, 0x1A, 0x80, 0x04, 0xFE, 0xFD, 0x30, 0x0E, 0x70, 0x0A, 0xC0, 0x2F, 0x10,
+    0x04, 0xF0, 0x0E, 0x60, 0x09, 0xB0, 0x03, 0xBD, 0xDA, 0x10, 0x01, 0xAD, 0xD9, 0x00, 0x0C, 0x80,
+    0x1B, 0x80, 0x2F, 0x10, 0x04, 0xD0, 0x2F, 0x20, 0x04, 0xF0, 0x0C, 0x90, 0x1B, 0xF0, 0x02, 0xAD,
+    0xB7, 0xE0, 0x18, 0x10, 0x07, 0xA0, 0x0C, 0x70, 0x1D, 0x30, 0x02, 0xBD, 0xC5, 0x00, 0x1D, 0x1A,
+    0x00, 0x00, 0x00, 0x1A, 0x1C, 0x01, 0xD0, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xA0, 0x09, 0x60, 0x0D, 0x10, 0x00, 0x00, 0x30, 0x00, 0x2A, 0xA0, 0x29, 0xA3, 0x00,
+    0xE4, 0x00, 0x00, 0x4B, 0x81, 0x00, 0x00, 0x5C, 0x80, 0x00, 0x00, 0x50, 0xCD, 0xDD, 0xD6, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xDD, 0xD6, 0x30, 0x00, 0x00, 0xBA, 0x20, 0x00, 0x03, 0xB9,
+    0x20, 0x00, 0x04, 0xE0, 0x01, 0x8B, 0x40, 0x8C, 0x50, 0x00, 0x50, 0x00, 0x00, 0x04, 0xCD, 0xC3,
+    0x0E, 0x50, 0x7D, 0x18, 0x00, 0x4F, 0x00, 0x00, 0x9A, 0x00, 0x04, 0xD1, 0x00, 0x0B, 0x20, 0x00,
+    0x04, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x02, 0x8C, 0xDC, 0x81, 0x00, 0x00, 0x6E,
+    0x71, 0x02, 0xAD, 0x10, 0x04, 0xE3, 0x9D, 0xB8, 0x4B, 0x90, 0x0C, 0x78, 0xA0, 0x9F, 0x36, 0xE0,
+    0x1F, 0x3F, 0x30, 0x7F, 0x04, 0xF0, 0x3F, 0x3F, 0x10, 0xAC, 0x05, 0xD0, 0x1F, 0x4F, 0x33, 0xFA,
+    0x1C, 0x60, 0x0C, 0x96, 0xBA, 0x5C, 0xB5, 0x00, 0x03, 0xE8, 0x20, 0x14, 0x80, 0x00, 0x00, 0x29,
+    0xDD, 0xC8, 0x20, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x0E, 0x99, 0x00, 0x00, 0x00, 0x5C,
+    0x3E, 0x00, 0x00, 0x00, 0xA7, 0x0D, 0x50, 0x00, 0x01, 0xE2, 0x08, 0xA0, 0x00, 0x06, 0xFD, 0xDE,
+    0xE1, 0x00, 0x0B, 0x60, 0x00, 0xD5, 0x00, 0x1F, 0x10, 0x00, 0x8A, 0x00, 0x7B, 0x00, 0x00, 0x3F,
+    0x10, 0x3F, 0xDD, 0xDB, 0x30, 0x3F, 0x00, 0x08, 0xD0, 0x3F, 0x00, 0x04, 0xF0, 0x3F, 0x00, 0x09,
+    0x80, 0x3F, 0xDD, 0xFD, 0x40, 0x3F, 0x00, 0x19, 0xD0, 0x3F, 0x00, 0x04, 0xF0, 0x3F, 0x00, 0x08,
+    0xB0, 0x3F, 0xDD, 0xDA, 0x20, 0x00, 0x3B, 0xDD, 0xB3, 0x00, 0x03, 0xE4, 0x00, 0x5E, 0x20, 0x0C,
+    0x70, 0x00, 0x09, 0x80, 0x1F, 0x20, 0x00, 0x00, 0x10, 0x3F, 0x10, 0x00, 0x00, 0x00, 0x2F, 0x20,
+    0x00, 0x00, 0x10, 0x0D, 0x70, 0x00, 0x0B, 0x70, 0x05, 0xE4, 0x00, 0x6E, 0x10, 0x00, 0x4C, 0xDD,
+    0xA2, 0x00, 0x3F, 0xDD, 0xDA, 0x20, 0x3F, 0x00, 0x06, 0xE2, 0x3F, 0x00, 0x00, 0x9A, 0x3F, 0x00,
+    0x00, 0x5D, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x5D, 0x3F, 0x00, 0x00, 0xA9, 0x3F, 0x00,
+    0x07, 0xD2, 0x3F, 0xDD, 0xDA, 0x20, 0x3F, 0xDD, 0xDD, 0x90, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xDD, 0xDD, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xDD, 0xDD, 0xB0, 0x3F, 0xDD, 0xDD, 0x90, 0x3F, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xDD, 0xDD, 0x30, 0x3F, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2A,
+    0xDD, 0xD8, 0x00, 0x03, 0xE5, 0x00, 0x2D, 0xA0, 0x0C, 0x80, 0x00, 0x04, 0xB1, 0x1F, 0x20, 0x00,
+    0x00, 0x00, 0x3F, 0x10, 0x07, 0xDD, 0xE0, 0x2F, 0x20, 0x00, 0x04, 0xF0, 0x0C, 0x80, 0x00, 0x08,
+    0xF0, 0x04, 0xE5, 0x00, 0x5C, 0xF0, 0x00, 0x4B, 0xDD, 0x94, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F,
+    0xDD, 0xDD, 0xDF, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00,
+    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x00,
+    0x3F, 0x00, 0x3F, 0x10, 0x3F, 0x00, 0x0E, 0x50, 0x8C, 0x00, 0x04, 0xCD, 0xC3, 0x00, 0x3F, 0x00,
+    0x02, 0xD5, 0x3F, 0x00, 0x1D, 0x60, 0x3F, 0x01, 0xC7, 0x00, 0x3F, 0x1B, 0x80, 0x00, 0x3F, 0xBD,
+    0x00, 0x00, 0x3F, 0x9C, 0x90, 0x00, 0x3F, 0x02, 0xE7, 0x00, 0x3F, 0x00, 0x4F, 0x40, 0x3F, 0x00,
+    0x07, 0xE3, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x00, 0x3F, 0xEE, 0xEE, 0xC0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD4, 0x00, 0x06,
+    0xDF, 0x00, 0x3F, 0x89, 0x00, 0x0B, 0x8F, 0x00, 0x3F, 0x3E, 0x00, 0x1E, 0x4F, 0x00, 0x3F, 0x0D,
+    0x40, 0x6A, 0x3F, 0x00, 0x3F, 0x08, 0x90, 0xB5, 0x3F, 0x00, 0x3F, 0x03, 0xE1, 0xE0, 0x3F, 0x00,
+    0x3F, 0x00, 0xCA, 0x90, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x3F, 0xD0, 0x00, 0x3F,
+    0x00, 0x3F, 0xC6, 0x00, 0x3F, 0x00, 0x3F, 0x4E, 0x10, 0x3F, 0x00, 0x3F, 0x0B, 0x70, 0x3F, 0x00,
+    0x3F, 0x03, 0xE1, 0x3F, 0x00, 0x3F, 0x00, 0xA8, 0x3F, 0x00, 0x3F, 0x00, 0x2E, 0x4F, 0x00, 0x3F,
+    0x00, 0x09, 0xCF, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x4C, 0xDE, 0xB3, 0x00, 0x05, 0xE4,
+    0x00, 0x6E, 0x20, 0x0D, 0x70, 0x00, 0x0A, 0xA0, 0x2F, 0x20, 0x00, 0x05, 0xE0, 0x3F, 0x10, 0x00,
+    0x04, 0xF0, 0x2F, 0x20, 0x00, 0x05, 0xE0, 0x0D, 0x70, 0x00, 0x0A, 0xA0, 0x05, 0xE4, 0x00, 0x6E,
+    0x20, 0x00, 0x4C, 0xDE, 0xB3, 0x00, 0x3F, 0xDD, 0xDB, 0x20, 0x3F, 0x00, 0x08, 0xC0, 0x3F, 0x00,
+    0x04, 0xF0, 0x3F, 0x00, 0x09, 0xB0, 0x3F, 0xDD, 0xDA, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xDD, 0xB2, 0x00, 0x05,
+    0xE4, 0x00, 0x6E, 0x20, 0x0D, 0x70, 0x00, 0x0A, 0xA0, 0x2F, 0x20, 0x00, 0x05, 0xE0, 0x3F, 0x10,
+    0x00, 0x04, 0xF0, 0x2F, 0x20, 0x00, 0x05, 0xE0, 0x0D, 0x70, 0x00, 0x0A, 0x90, 0x05, 0xE4, 0x00,
+    0x6D, 0x10, 0x00, 0x4C, 0xDE, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x02, 0x40, 0x3F, 0xDD, 0xDB, 0x30,
+    0x3F, 0x00, 0x08, 0xC0, 0x3F, 0x00, 0x04, 0xF0, 0x3F, 0x00, 0x09, 0xA0, 0x3F, 0xDD, 0xEC, 0x00,
+    0x3F, 0x00, 0x1D, 0x50, 0x3F, 0x00, 0x08, 0x80, 0x3F, 0x00, 0x06, 0xA0, 0x3F, 0x00, 0x03, 0xE0,
+    0x03, 0xBC, 0xD9, 0x10, 0x0E, 0x40, 0x1B, 0x80, 0x2F, 0x10, 0x03, 0x70, 0x0D, 0xC5, 0x10, 0x00,
+    0x01, 0x8C, 0xFA, 0x10, 0x00, 0x00, 0x2B, 0xB0, 0x57, 0x00, 0x04, 0xE0, 0x3E, 0x40, 0x09, 0xB0,
+    0x04, 0xCD, 0xD9, 0x10, 0x5D, 0xDD, 0xFD, 0xDD, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
+    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
+    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
+    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x2F,
+    0x20, 0x00, 0x5E, 0x00, 0x0B, 0xA1, 0x01, 0xC9, 0x00, 0x01, 0x9D, 0xDD, 0x80, 0x00, 0x6C, 0x00,
+    0x00, 0x2F, 0x10, 0x1F, 0x20, 0x00, 0x7A, 0x00, 0x0B, 0x70, 0x00, 0xC5, 0x00, 0x06, 0xC0, 0x02,
+    0xE1, 0x00, 0x01, 0xF2, 0x07, 0x90, 0x00, 0x00, 0xA6, 0x0C, 0x40, 0x00, 0x00, 0x5B, 0x2D, 0x00,
+    0x00, 0x00, 0x1E, 0x98, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0x00, 0x00, 0x8B, 0x00, 0x08, 0xF3, 0x00,
+    0x1F, 0x20, 0x4E, 0x00, 0x0C, 0xD7, 0x00, 0x4D, 0x00, 0x0F, 0x30, 0x1E, 0x6B, 0x00, 0x89, 0x00,
+    0x0B, 0x70, 0x5A, 0x2E, 0x00, 0xC5, 0x00, 0x07, 0xA0, 0x96, 0x0D, 0x31, 0xE1, 0x00, 0x03, 0xE0,
+    0xD2, 0x09, 0x74, 0xB0, 0x00, 0x00, 0xE4, 0xD0, 0x05, 0xB8, 0x70, 0x00, 0x00, 0xAB, 0x90, 0x01,
+    0xEC, 0x30, 0x00, 0x00, 0x6F, 0x50, 0x00, 0xCE, 0x00, 0x00, 0x2E, 0x30, 0x00, 0xA9, 0x00, 0x07,
+    0xC0, 0x05, 0xD1, 0x00, 0x00, 0xC7, 0x1D, 0x30, 0x00, 0x00, 0x2E, 0xB7, 0x00, 0x00, 0x00, 0x0A,
+    0xF1, 0x00, 0x00, 0x00, 0x3D, 0xA9, 0x00, 0x00, 0x01, 0xD4, 0x1D, 0x50, 0x00, 0x09, 0x90, 0x04,
+    0xE2, 0x00, 0x5D, 0x10, 0x00, 0x8B, 0x00, 0x2E, 0x30, 0x00, 0x5D, 0x00, 0x08, 0xC0, 0x00, 0xD5,
+    0x00, 0x01, 0xD6, 0x07, 0xB0, 0x00, 0x00, 0x5E, 0x2E, 0x30, 0x00, 0x00, 0x0B, 0xE9, 0x00, 0x00,
+    0x00, 0x04, 0xF1, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
+    0x03, 0xF0, 0x00, 0x00, 0x8D, 0xDD, 0xDF, 0x70, 0x00, 0x00, 0x3E, 0x10, 0x00, 0x01, 0xD5, 0x00,
+    0x00, 0x0A, 0x90, 0x00, 0x00, 0x5D, 0x10, 0x00, 0x02, 0xE3, 0x00, 0x00, 0x0C, 0x70, 0x00, 0x00,
+    0x8B, 0x00, 0x00, 0x00, 0xFD, 0xDD, 0xDD, 0x70, 0x3E, 0xD5, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0xD5, 0x0C, 0x00,
+    0x00, 0x08, 0x40, 0x00, 0x03, 0x90, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x84, 0x00, 0x00, 0x39, 0x00,
+    0x00, 0x0C, 0x00, 0x00, 0x07, 0x50, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x60, 0x7D, 0xE0, 0x03, 0xF0,
+    0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
+    0x7D, 0xE0, 0x00, 0xD7, 0x00, 0x05, 0x7B, 0x00, 0x0B, 0x17, 0x50, 0x49, 0x01, 0xC0, 0xB2, 0x00,
+    0x94, 0x4D, 0xDD, 0xDB, 0x25, 0x00, 0x0A, 0x20, 0x02, 0xBD, 0xD5, 0x00, 0x0B, 0x70, 0x5D, 0x00,
+    0x03, 0x11, 0x5F, 0x00, 0x06, 0xDA, 0xBF, 0x00, 0x1F, 0x30, 0x4F, 0x00, 0x2F, 0x20, 0x9F, 0x00,
+    0x08, 0xED, 0x8F, 0x20, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0xD9, 0x10,
+    0x3F, 0x90, 0x1C, 0x80, 0x3F, 0x20, 0x05, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x20, 0x05, 0xD0,
+    0x3F, 0x90, 0x1C, 0x70, 0x3F, 0x8D, 0xD8, 0x00, 0x01, 0x8D, 0xD9, 0x10, 0x09, 0xA0, 0x0A, 0x90,
+    0x1F, 0x20, 0x02, 0x50, 0x2F, 0x10, 0x00, 0x00, 0x1F, 0x20, 0x02, 0x40, 0x0B, 0xA0, 0x0A, 0x80,
+    0x01, 0xAD, 0xD9, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x9D, 0xD8, 0xF0,
+    0x0A, 0xA0, 0x1B, 0xF0, 0x1F, 0x20, 0x05, 0xF0, 0x2F, 0x10, 0x03, 0xF0, 0x1F, 0x20, 0x05, 0xF0,
+    0x0B, 0x90, 0x1B, 0xF0, 0x02, 0xBD, 0xC7, 0xF0, 0x01, 0x9D, 0xD7, 0x00, 0x09, 0x90, 0x1C, 0x50,
+    0x1F, 0x20, 0x06, 0xA0, 0x2F, 0xDD, 0xDD, 0xB0, 0x1F, 0x10, 0x02, 0x30, 0x0B, 0x80, 0x1C, 0x60,
+    0x01, 0xAD, 0xD7, 0x00, 0x03, 0x74, 0x1E, 0x73, 0x3F, 0x00, 0xDF, 0xD6, 0x3F, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0x9D, 0xD8, 0xF0, 0x0A, 0xA0, 0x1B, 0xF0,
+    0x1F, 0x20, 0x05, 0xF0, 0x2F, 0x10, 0x03, 0xF0, 0x1F, 0x20, 0x05, 0xF0, 0x0B, 0x90, 0x1B, 0xF0,
+    0x02, 0xBD, 0xC7, 0xF0, 0x0B, 0x20, 0x05, 0xE0, 0x0A, 0x90, 0x1B, 0x90, 0x01, 0xAD, 0xD9, 0x10,
+    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x5C, 0xDC, 0x30, 0x3F, 0xA1, 0x08, 0xD0,
+    0x3F, 0x30, 0x03, 0xF0, 0x3F, 0x10, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0,
+    0x3F, 0x00, 0x03, 0xF0, 0x1A, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
+    0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x05, 0xE0, 0x2F, 0x80, 0x3F, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x4E, 0x30, 0x3F, 0x03, 0xE4, 0x00, 0x3F, 0x2D,
+    0x40, 0x00, 0x3F, 0xDB, 0x00, 0x00, 0x3F, 0x5D, 0x80, 0x00, 0x3F, 0x02, 0xE6, 0x00, 0x3F, 0x00,
+    0x4F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
+    0x3F, 0x10, 0x1D, 0xB0, 0x3F, 0x8D, 0xD4, 0x8D, 0xD4, 0x00, 0x3F, 0x70, 0x7E, 0x70, 0x7D, 0x00,
+    0x3F, 0x20, 0x3F, 0x20, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x5C,
+    0xDC, 0x30, 0x3F, 0xA1, 0x08, 0xD0, 0x3F, 0x30, 0x03, 0xF0, 0x3F, 0x10, 0x03, 0xF0, 0x3F, 0x00,
+    0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x8D, 0xDC, 0x60, 0x09, 0xB1,
+    0x02, 0xD6, 0x1F, 0x30, 0x00, 0x6D, 0x2F, 0x10, 0x00, 0x4F, 0x1F, 0x30, 0x00, 0x6D, 0x09, 0xB1,
+    0x02, 0xD6, 0x00, 0x8D, 0xDC, 0x60, 0x3F, 0x6C, 0xD9, 0x10, 0x3F, 0x90, 0x1C, 0x80, 0x3F, 0x20,
+    0x05, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x20, 0x05, 0xD0, 0x3F, 0x90, 0x1C, 0x70, 0x3F, 0x8D,
+    0xD8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x9D,
+    0xD8, 0xF0, 0x0A, 0xA0, 0x1B, 0xF0, 0x1F, 0x20, 0x05, 0xF0, 0x2F, 0x10, 0x03, 0xF0, 0x1F, 0x20,
+    0x05, 0xF0, 0x0B, 0x90, 0x1B, 0xF0, 0x02, 0xBD, 0xC7, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
+    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x7D, 0x10, 0x3F, 0x90, 0x00, 0x3F, 0x20, 0x00, 0x3F,
+    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0xDD, 0xB2, 0x2F, 0x20,
+    0x9B, 0x1F, 0x71, 0x01, 0x04, 0xBE, 0xA2, 0x12, 0x01, 0x9D, 0x4E, 0x20, 0x5E, 0x07, 0xDD, 0xC4,
+    0x02, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x2D, 0xFD, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
+    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF1, 0x00, 0x01, 0xCE, 0x30, 0x3F, 0x00, 0x03, 0xF0, 0x3F,
+    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x04, 0xF0, 0x3F, 0x10, 0x06, 0xF0, 0x1F,
+    0x60, 0x1C, 0xF0, 0x05, 0xDD, 0xC7, 0xF0, 0xC6, 0x00, 0x0B, 0x60, 0x6B, 0x00, 0x1E, 0x10, 0x1F,
+    0x20, 0x6A, 0x00, 0x0A, 0x70, 0xB4, 0x00, 0x05, 0xC1, 0xD0, 0x00, 0x00, 0xE8, 0x80, 0x00, 0x00,
+    0x8F, 0x30, 0x00, 0xD6, 0x00, 0xBE, 0x00, 0x3E, 0x00, 0x8B, 0x00, 0xDD, 0x30, 0x7A, 0x00, 0x3E,
+    0x03, 0xB9, 0x70, 0xB5, 0x00, 0x0D, 0x47, 0x75, 0xB1, 0xE1, 0x00, 0x09, 0x8B, 0x31, 0xE5, 0xB0,
+    0x00, 0x04, 0xCD, 0x00, 0xCC, 0x60, 0x00, 0x00, 0xEA, 0x00, 0x8F, 0x10, 0x00, 0x0A, 0xA0, 0x08,
+    0xB0, 0x01, 0xD4, 0x3E, 0x20, 0x00, 0x4D, 0xC5, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x5C, 0xC6,
+    0x00, 0x02, 0xE3, 0x3E, 0x20, 0x0B, 0x80, 0x08, 0xB0, 0xC7, 0x00, 0x0C, 0x60, 0x7B, 0x00, 0x2F,
+    0x10, 0x1F, 0x10, 0x6A, 0x00, 0x0B, 0x60, 0xB5, 0x00, 0x06, 0xB1, 0xE0, 0x00, 0x01, 0xE7, 0x90,
+    0x00, 0x00, 0xAE, 0x30, 0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x3D, 0x90, 0x00,
+    0x00, 0x9D, 0xDD, 0xF7, 0x00, 0x05, 0xE1, 0x00, 0x3E, 0x40, 0x01, 0xD7, 0x00, 0x0A, 0xA0, 0x00,
+    0x7D, 0x10, 0x00, 0xFE, 0xDD, 0xD7, 0x0A, 0xB0, 0x3F, 0x10, 0x3F, 0x00, 0x3F, 0x00, 0x5E, 0x00,
+    0xE6, 0x00, 0x5E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x10, 0x0A, 0xB0, 0x3F, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
+    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x1D, 0x80, 0x04, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x02, 0xF2,
+    0x00, 0x9B, 0x02, 0xF2, 0x03, 0xF0, 0x03, 0xF0, 0x04, 0xF0, 0x1D, 0x80, 0x8D, 0x93, 0x56, 0xA0,
+    0x5B, 0xB2, 0x00, 0x03, 0x8B, 0xEF, 0xFF, 0xC9, 0x50, 0x00, 0x05, 0xBF, 0xFF, 0xFE, 0xEF, 0xFF,
+    0xFC, 0x70, 0xBF, 0xFD, 0x84, 0x21, 0x12, 0x47, 0xCF, 0xFD, 0xFD, 0x60, 0x00, 0x01, 0x10, 0x00,
+    0x04, 0xBF, 0x91, 0x00, 0x59, 0xDE, 0xED, 0xA6, 0x10, 0x07, 0x00, 0x4C, 0xFF, 0xFE, 0xEF, 0xFF,
+    0xE7, 0x00, 0x08, 0xFF, 0xC7, 0x31, 0x12, 0x6B, 0xFF, 0xA2, 0x0A, 0xF6, 0x00, 0x01, 0x10, 0x00,
+    0x4E, 0xD2, 0x00, 0x20, 0x06, 0xBE, 0xEC, 0x81, 0x02, 0x10, 0x00, 0x01, 0xBF, 0xFE, 0xEF, 0xFD,
+    0x30, 0x00, 0x00, 0x01, 0xAD, 0x51, 0x14, 0xBC, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB1, 0x00,
+    0x00, 0x00,
+};
+
+// Codepoint, bitmap offset, advance, box width and height, box offset
+static const lv_host_glyph_t glyphs[] = {
+    {32, 0, 3, 0, 0, 0, 0},
+    {33, 0, 3, 3, 9, 0, 4},
+    {34, 18, 5, 5, 3, 0, 4},
+    {35, 27, 8, 7, 9, 0, 4},
+    {36, 63, 8, 7, 11, 0, 3},
+    {37, 107, 10, 9, 9, 0, 4},
+    {38, 152, 9, 9, 9, 0, 4},
+    {39, 197, 3, 3, 3, 0, 4},
+    {40, 203, 4, 4, 11, 0, 3},
+    {41, 225, 4, 3, 11, 0, 3},
+    {42, 247, 7, 7, 6, 0, 7},
+    {43, 271, 8, 7, 6, 1, 6},
+    {44, 295, 3, 3, 3, -1, 12},
+    {45, 301, 4, 4, 1, 0, 9},
+    {46, 303, 3, 2, 2, 0, 11},
+    {47, 305, 4, 5, 10, -1, 4},
+    {48, 335, 8, 8, 9, 0, 4},
+    {49, 371, 8, 5, 9, 1, 4},
+    {50, 398, 8, 7, 9, 0, 4},
+    {51, 434, 8, 7, 9, 0, 4},
+    {52, 470, 8, 8, 9, 0, 4},
+    {53, 506, 8, 7, 9, 0, 4},
+    {54, 542, 8, 7, 9, 0, 4},
+    {55, 578, 8, 7, 9, 0, 4},
+    {56, 614, 8, 7, 9, 0, 4},
+    {57, 650, 8, 7, 9, 0, 4},
+    {58, 686, 3, 2, 7, 0, 6},
+    {59, 693, 3, 3, 9, -1, 6},
+    {60, 711, 7, 5, 7, 1, 6},
+    {61, 732, 8, 6, 4, 1, 7},
+    {62, 744, 7, 5, 7, 1, 6},
+    {63, 765, 7, 6, 9, 0, 4},
+    {64, 792, 12, 11, 10, 0, 4},
+    {65, 852, 8, 9, 9, 0, 4},
+    {66, 897, 8, 7, 9, 0, 4},
+    {67, 933, 9, 9, 9, 0, 4},
+    {68, 978, 9, 8, 9, 0, 4},
+    {69, 1014, 7, 7, 9, 0, 4},
+    {70, 1050, 7, 7, 9, 0, 4},
+    {71, 1086, 10, 10, 9, 0, 4},
+    {72, 1131, 9, 9, 9, 0, 4},
+    {73, 1176, 3, 3, 9, 0, 4},
+    {74, 1194, 7, 7, 9, 0, 4},
+    {75, 1230, 8, 8, 9, 0, 4},
+    {76, 1266, 7, 7, 9, 0, 4},
+    {77, 1302, 11, 11, 9, 0, 4},
+    {78, 1356, 9, 9, 9, 0, 4},
+    {79, 1401, 10, 9, 9, 0, 4},
+    {80, 1446, 8, 7, 9, 0, 4},
+    {81, 1482, 10, 9, 10, 0, 4},
+    {82, 1532, 8, 8, 9, 0, 4},
+    {83, 1568, 8, 7, 9, 0, 4},
+    {84, 1604, 8, 9, 9, 0, 4},
+    {85, 1649, 9, 9, 9, 0, 4},
+    {86, 1694, 8, 9, 9, 0, 4},
+    {87, 1739, 12, 13, 9, 0, 4},
+    {88, 1802, 8, 9, 9, 0, 4},
+    {89, 1847, 8, 9, 9, 0, 4},
+    {90, 1892, 8, 7, 9, 1, 4},
+    {91, 1928, 4, 4, 11, 0, 3},
+    {92, 1950, 4, 5, 10, -1, 4},
+    {93, 1980, 4, 4, 11, 0, 3},
+    {94, 2002, 8, 6, 5, 1, 5},
+    {95, 2017, 7, 6, 1, 0, 13},
+    {96, 2020, 4, 3, 2, 0, 4},
+    {97, 2024, 7, 7, 7, 0, 6},
+    {98, 2052, 8, 7, 9, 0, 4},
+    {99, 2088, 7, 7, 7, 0, 6},
+    {100, 2116, 8, 8, 9, 0, 4},
+    {101, 2152, 7, 7, 7, 0, 6},
+    {102, 2180, 4, 4, 10, 0, 3},
+    {103, 2200, 8, 8, 10, 0, 6},
+    {104, 2240, 8, 8, 9, 0, 4},
+    {105, 2276, 3, 3, 9, 0, 4},
+    {106, 2294, 3, 4, 12, -1, 4},
+    {107, 2318, 7, 7, 9, 0, 4},
+    {108, 2354, 3, 3, 9, 0, 4},
+    {109, 2372, 11, 11, 7, 0, 6},
+    {110, 2414, 8, 8, 7, 0, 6},
+    {111, 2442, 9, 8, 7, 0, 6},
+    {112, 2470, 8, 7, 10, 0, 6},
+    {113, 2510, 8, 8, 10, 0, 6},
+    {114, 2550, 4, 5, 7, 0, 6},
+    {115, 2571, 7, 6, 7, 0, 6},
+    {116, 2592, 4, 5, 9, -1, 4},
+    {117, 2619, 8, 8, 7, 0, 6},
+    {118, 2647, 7, 7, 7, 0, 6},
+    {119, 2675, 10, 11, 7, 0, 6},
+    {120, 2717, 6, 8, 7, -1, 6},
+    {121, 2745, 7, 7, 10, 0, 6},
+    {122, 2785, 7, 6, 7, 1, 6},
+    {123, 2806, 4, 3, 11, 1, 3},
+    {124, 2828, 3, 3, 13, 0, 3},
+    {125, 2854, 4, 4, 11, -1, 3},
+    {126, 2876, 8, 6, 2, 1, 8},
+    {61931, 2882, 16, 16, 16, 0, 0},
+};
+
+const lv_font_t lv_host_font = {
+    16, 3, glyphs,
+    sizeof(glyphs) / sizeof(glyphs[0]), bitmap,
+};
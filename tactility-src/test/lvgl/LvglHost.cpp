@@ -0,0 +1,1715 @@
+#include "LvglHost.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <new>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Sizes from LVGL's default theme at its default 130 DPI on a small display
+constexpr int32_t DEFAULT_SIZE = 130;
+constexpr int32_t THEME_RADIUS = 7;
+constexpr int32_t THEME_BORDER_WIDTH = 2;
+constexpr int32_t THEME_PAD = 13;
+constexpr int32_t THEME_PAD_SMALL = 10;
+constexpr uint32_t COLOR_SCREEN = 0x15171A;
+constexpr uint32_t COLOR_CARD = 0x282B30;
+constexpr uint32_t COLOR_GREY = 0x2F3237;
+constexpr uint32_t COLOR_TEXT = 0xEEEEEE;
+constexpr uint32_t COLOR_PRIMARY = 0x2196F3;
+constexpr uint8_t IMAGE_HEADER_MAGIC = 0x19;
+// LVGL's heap; the tapered face's largest layers fit several times over
+constexpr size_t MEM_POOL_SIZE = 1024 * 1024;
+constexpr size_t MEM_ALIGN = 8;
+// Invalidated areas kept before the whole screen counts as invalid, as
+// LV_INV_BUF_SIZE
+constexpr size_t MAX_DIRTY_AREAS = 32;
+// Passes of layout and LV_EVENT_SIZE_CHANGED before giving up on settling
+constexpr int LAYOUT_PASSES = 4;
+
+enum StyleProp : uint32_t {
+  PropBgColor = 1u << 0,
+  PropBgOpa = 1u << 1,
+  PropRadius = 1u << 2,
+  PropBorderWidth = 1u << 3,
+  PropBorderColor = 1u << 4,
+  PropBorderOpa = 1u << 5,
+  PropBorderPost = 1u << 6,
+  PropPadLeft = 1u << 7,
+  PropPadRight = 1u << 8,
+  PropPadTop = 1u << 9,
+  PropPadBottom = 1u << 10,
+  PropPadRow = 1u << 11,
+  PropPadColumn = 1u << 12,
+  PropLineWidth = 1u << 13,
+  PropLineColor = 1u << 14,
+  PropLineOpa = 1u << 15,
+  PropLineRounded = 1u << 16,
+  PropTextColor = 1u << 17,
+  PropTextFont = 1u << 18,
+  PropTextAlign = 1u << 19,
+  PropRecolor = 1u << 20,
+  PropRecolorOpa = 1u << 21,
+  PropLayout = 1u << 22,
+  PropFlexFlow = 1u << 23,
+  PropFlexMain = 1u << 24,
+  PropFlexCross = 1u << 25,
+};
+
+// Inherited from the parent when not set, as in LVGL
+constexpr uint32_t INHERITED_PROPS = PropTextColor | PropTextFont |
+                                     PropTextAlign;
+
+struct HostStyle {
+  uint32_t set;
+  lv_color_t bg_color;
+  lv_opa_t bg_opa;
+  int32_t radius;
+  int32_t border_width;
+  lv_color_t border_color;
+  lv_opa_t border_opa;
+  bool border_post;
+  int32_t pad_left;
+  int32_t pad_right;
+  int32_t pad_top;
+  int32_t pad_bottom;
+  int32_t pad_row;
+  int32_t pad_column;
+  int32_t line_width;
+  lv_color_t line_color;
+  lv_opa_t line_opa;
+  bool line_rounded;
+  lv_color_t text_color;
+  const lv_font_t *text_font;
+  lv_text_align_t text_align;
+  lv_color_t recolor;
+  lv_opa_t recolor_opa;
+  uint32_t layout;
+  lv_flex_flow_t flex_flow;
+  lv_flex_align_t flex_main;
+  lv_flex_align_t flex_cross;
+};
+
+enum ObjType { ObjScreen, ObjBase, ObjButton, ObjLabel, ObjLine, ObjImage };
+
+struct HostEvent {
+  lv_event_cb_t callback;
+  lv_event_code_t code;
+  void *user_data;
+};
+
+struct lv_obj_t {
+  ObjType type;
+  lv_obj_t *parent;
+  std::vector<lv_obj_t *> children;
+  uint32_t flags;
+  lv_state_t state;
+  bool deleting;
+  void *user_data;
+  std::vector<HostEvent> events;
+  HostStyle local[2]; // Default and LV_STATE_CHECKED
+  HostStyle theme;
+
+  // Requested geometry; sizes may be LV_PCT() or LV_SIZE_CONTENT
+  int32_t x;
+  int32_t y;
+  int32_t width;
+  int32_t height;
+  lv_align_t align;
+  // Resolved by the layout
+  int32_t measured_width;
+  int32_t measured_height;
+  lv_area_t coords;
+  int32_t notified_width; // Size LV_EVENT_SIZE_CHANGED was last sent for
+  int32_t notified_height;
+
+  char *text; // From lv_malloc(), as LVGL keeps label texts
+  const char *static_text;
+  const lv_point_precise_t *points;
+  uint32_t point_count;
+  const void *src;
+  uint32_t scale;
+  int32_t rotation;
+  lv_point_t pivot;
+  bool pivot_set;
+};
+
+struct lv_event_t {
+  lv_event_code_t code;
+  lv_obj_t *target;
+  void *user_data;
+  lv_layer_t *layer;
+};
+
+struct lv_layer_t {
+  uint8_t *pixels;
+  int32_t width;
+  int32_t height;
+  lv_area_t clip;
+};
+
+// Objects, label texts and lv_malloc() share one pool handed out first fit,
+// with free neighbours merged, like LVGL's builtin allocator, so a face's
+// allocations fragment it as they would LVGL's heap. Offsets into the pool
+// key both maps.
+alignas(max_align_t) static uint8_t mem_pool[MEM_POOL_SIZE];
+static std::map<size_t, size_t> free_blocks = {{0, MEM_POOL_SIZE}};
+static std::unordered_map<size_t, size_t> used_blocks;
+static size_t mem_max_used = 0;
+
+static std::unordered_set<const lv_obj_t *> live_objects;
+static lv_obj_t *screen = nullptr;
+static bool in_layout = false;
+// Areas to redraw on the next render, in screen coordinates
+static std::vector<lv_area_t> dirty_areas;
+static bool dirty_all = false;
+
+static void invalidate_object(const lv_obj_t *obj);
+
+// Styles
+
+static HostStyle &style_for(lv_obj_t *obj, lv_style_selector_t selector) {
+  return obj->local[(selector & LV_STATE_CHECKED) ? 1 : 0];
+}
+
+template <typename T>
+static T style_get(const lv_obj_t *obj, StyleProp prop, T HostStyle::*member,
+                   T fallback) {
+  for (const lv_obj_t *current = obj; current; current = current->parent) {
+    if ((current->state & LV_STATE_CHECKED) && (current->local[1].set & prop)) {
+      return current->local[1].*member;
+    }
+    if (current->local[0].set & prop) {
+      return current->local[0].*member;
+    }
+    if (current->theme.set & prop) {
+      return current->theme.*member;
+    }
+    if (!(prop & INHERITED_PROPS)) {
+      break;
+    }
+  }
+  return fallback;
+}
+
+#define STYLE_SETTER(name, type, prop, member)                                 \
+  void lv_obj_set_style_##name(lv_obj_t *obj, type value,                      \
+                               lv_style_selector_t selector) {                 \
+    HostStyle &style = style_for(obj, selector);                               \
+    style.member = value;                                                      \
+    style.set |= prop;                                                         \
+    invalidate_object(obj);                                                    \
+  }
+
+STYLE_SETTER(bg_color, lv_color_t, PropBgColor, bg_color)
+STYLE_SETTER(bg_opa, lv_opa_t, PropBgOpa, bg_opa)
+STYLE_SETTER(radius, int32_t, PropRadius, radius)
+STYLE_SETTER(border_width, int32_t, PropBorderWidth, border_width)
+STYLE_SETTER(border_color, lv_color_t, PropBorderColor, border_color)
+STYLE_SETTER(border_opa, lv_opa_t, PropBorderOpa, border_opa)
+STYLE_SETTER(line_width, int32_t, PropLineWidth, line_width)
+STYLE_SETTER(line_color, lv_color_t, PropLineColor, line_color)
+STYLE_SETTER(line_opa, lv_opa_t, PropLineOpa, line_opa)
+STYLE_SETTER(line_rounded, bool, PropLineRounded, line_rounded)
+STYLE_SETTER(text_color, lv_color_t, PropTextColor, text_color)
+STYLE_SETTER(text_font, const lv_font_t *, PropTextFont, text_font)
+STYLE_SETTER(text_align, lv_text_align_t, PropTextAlign, text_align)
+STYLE_SETTER(image_recolor, lv_color_t, PropRecolor, recolor)
+STYLE_SETTER(image_recolor_opa, lv_opa_t, PropRecolorOpa, recolor_opa)
+
+static void set_pads(HostStyle *style, int32_t horizontal, int32_t vertical) {
+  style->pad_left = style->pad_right = horizontal;
+  style->pad_top = style->pad_bottom = vertical;
+  style->set |= PropPadLeft | PropPadRight | PropPadTop | PropPadBottom;
+}
+
+void lv_obj_set_style_pad_all(lv_obj_t *obj, int32_t value,
+                              lv_style_selector_t selector) {
+  set_pads(&style_for(obj, selector), value, value);
+  invalidate_object(obj);
+}
+
+void lv_obj_remove_style_all(lv_obj_t *obj) {
+  obj->local[0] = {};
+  obj->local[1] = {};
+  obj->theme = {};
+  invalidate_object(obj);
+}
+
+void lv_obj_set_layout(lv_obj_t *obj, uint32_t layout) {
+  obj->local[0].layout = layout;
+  obj->local[0].set |= PropLayout;
+  invalidate_object(obj);
+}
+
+void lv_obj_set_flex_flow(lv_obj_t *obj, lv_flex_flow_t flow) {
+  obj->local[0].flex_flow = flow;
+  obj->local[0].set |= PropFlexFlow;
+  invalidate_object(obj);
+}
+
+void lv_obj_set_flex_align(lv_obj_t *obj, lv_flex_align_t main_place,
+                           lv_flex_align_t cross_place,
+                           lv_flex_align_t track_place) {
+  obj->local[0].flex_main = main_place;
+  obj->local[0].flex_cross = cross_place;
+  obj->local[0].set |= PropFlexMain | PropFlexCross;
+  invalidate_object(obj);
+}
+
+static int32_t border_width(const lv_obj_t *obj) {
+  return style_get(obj, PropBorderWidth, &HostStyle::border_width, 0);
+}
+
+static int32_t line_width(const lv_obj_t *obj) {
+  return style_get(obj, PropLineWidth, &HostStyle::line_width, 1);
+}
+
+static const lv_font_t *text_font(const lv_obj_t *obj) {
+  return style_get(obj, PropTextFont, &HostStyle::text_font,
+                   lv_font_get_default());
+}
+
+// Padding plus border, the space between the edge and the content
+static int32_t space_left(const lv_obj_t *obj) {
+  return style_get(obj, PropPadLeft, &HostStyle::pad_left, 0) +
+         border_width(obj);
+}
+
+static int32_t space_right(const lv_obj_t *obj) {
+  return style_get(obj, PropPadRight, &HostStyle::pad_right, 0) +
+         border_width(obj);
+}
+
+static int32_t space_top(const lv_obj_t *obj) {
+  return style_get(obj, PropPadTop, &HostStyle::pad_top, 0) +
+         border_width(obj);
+}
+
+static int32_t space_bottom(const lv_obj_t *obj) {
+  return style_get(obj, PropPadBottom, &HostStyle::pad_bottom, 0) +
+         border_width(obj);
+}
+
+static bool is_flex(const lv_obj_t *obj) {
+  return style_get(obj, PropLayout, &HostStyle::layout,
+                   (uint32_t)LV_LAYOUT_NONE) == LV_LAYOUT_FLEX;
+}
+
+static bool intersect(lv_area_t *result, const lv_area_t &a,
+                      const lv_area_t &b);
+
+// Invalidation. As in LVGL, changing what an object shows invalidates the
+// area it draws in, moving it invalidates the old and the new area, and a
+// render only redraws the invalid areas.
+
+static int32_t area_size(const lv_area_t &area) {
+  return lv_area_get_width(&area) * lv_area_get_height(&area);
+}
+
+static bool is_transformed(const lv_obj_t *obj) {
+  return obj->type == ObjImage &&
+         (obj->scale != LV_SCALE_NONE || obj->rotation != 0);
+}
+
+// The object's box, plus what lines and transformed images draw beyond it
+static lv_area_t draw_area(const lv_obj_t *obj) {
+  int32_t extra = obj->type == ObjLine ? line_width(obj) : 0;
+  if (is_transformed(obj)) {
+    // Turning around a pivot inside the box moves no pixel further out than
+    // the box's diagonal
+    extra = 2 * LV_MAX(lv_obj_get_width(obj), lv_obj_get_height(obj)) *
+            (int32_t)LV_MAX(obj->scale, (uint32_t)LV_SCALE_NONE) /
+            LV_SCALE_NONE;
+  }
+  return {obj->coords.x1 - extra, obj->coords.y1 - extra,
+          obj->coords.x2 + extra, obj->coords.y2 + extra};
+}
+
+static void invalidate_area(const lv_obj_t *obj, lv_area_t area) {
+  if (!screen || dirty_all) {
+    return;
+  }
+  // Nothing shows of hidden objects or outside the parents
+  for (const lv_obj_t *current = obj; current; current = current->parent) {
+    if (current->flags & LV_OBJ_FLAG_HIDDEN) {
+      return;
+    }
+    if (current != obj && !intersect(&area, area, current->coords)) {
+      return;
+    }
+  }
+  if (!intersect(&area, area, screen->coords)) {
+    return;
+  }
+  for (const lv_area_t &dirty : dirty_areas) {
+    if (area.x1 >= dirty.x1 && area.y1 >= dirty.y1 && area.x2 <= dirty.x2 &&
+        area.y2 <= dirty.y2) {
+      return;
+    }
+  }
+  if (dirty_areas.size() == MAX_DIRTY_AREAS) {
+    dirty_all = true;
+    return;
+  }
+  dirty_areas.push_back(area);
+}
+
+static void invalidate_object(const lv_obj_t *obj) {
+  invalidate_area(obj, draw_area(obj));
+}
+
+// Merges areas whose bounding box is smaller than the two, as LVGL does
+static void join_dirty_areas() {
+  bool joined = true;
+  while (joined) {
+    joined = false;
+    for (size_t i = 0; i < dirty_areas.size() && !joined; i++) {
+      for (size_t j = i + 1; j < dirty_areas.size(); j++) {
+        const lv_area_t &a = dirty_areas[i];
+        const lv_area_t &b = dirty_areas[j];
+        lv_area_t box = {LV_MIN(a.x1, b.x1), LV_MIN(a.y1, b.y1),
+                         LV_MAX(a.x2, b.x2), LV_MAX(a.y2, b.y2)};
+        if (area_size(box) < area_size(a) + area_size(b)) {
+          dirty_areas[i] = box;
+          dirty_areas.erase(dirty_areas.begin() + (ptrdiff_t)j);
+          joined = true;
+          break;
+        }
+      }
+    }
+  }
+}
+
+// Object tree
+
+static void apply_theme(lv_obj_t *obj) {
+  HostStyle &theme = obj->theme;
+  switch (obj->type) {
+  case ObjScreen:
+    theme.bg_color = lv_color_hex(COLOR_SCREEN);
+    theme.bg_opa = LV_OPA_COVER;
+    theme.text_color = lv_color_hex(COLOR_TEXT);
+    theme.set = PropBgColor | PropBgOpa | PropTextColor;
+    break;
+  case ObjBase:
+    theme.bg_color = lv_color_hex(COLOR_CARD);
+    theme.bg_opa = LV_OPA_COVER;
+    theme.radius = THEME_RADIUS;
+    theme.border_width = THEME_BORDER_WIDTH;
+    theme.border_color = lv_color_hex(COLOR_GREY);
+    theme.border_post = true;
+    theme.text_color = lv_color_hex(COLOR_TEXT);
+    theme.pad_row = theme.pad_column = THEME_PAD_SMALL;
+    theme.set = PropBgColor | PropBgOpa | PropRadius | PropBorderWidth |
+                PropBorderColor | PropBorderPost | PropTextColor | PropPadRow |
+                PropPadColumn;
+    set_pads(&theme, THEME_PAD, THEME_PAD);
+    break;
+  case ObjButton:
+    theme.bg_color = lv_color_hex(COLOR_PRIMARY);
+    theme.bg_opa = LV_OPA_COVER;
+    theme.radius = THEME_RADIUS;
+    theme.text_color = lv_color_hex(0xFFFFFF);
+    theme.set = PropBgColor | PropBgOpa | PropRadius | PropTextColor;
+    set_pads(&theme, THEME_PAD, THEME_PAD_SMALL);
+    break;
+  default:
+    break;
+  }
+}
+
+static lv_obj_t *create(lv_obj_t *parent, ObjType type) {
+  void *memory = lv_malloc(sizeof(lv_obj_t));
+  if (!memory) {
+    fprintf(stderr, "LVGL heap exhausted\n");
+    abort();
+  }
+  auto *obj = new (memory) lv_obj_t();
+  obj->type = parent ? type : ObjScreen;
+  obj->parent = parent;
+  obj->align = LV_ALIGN_DEFAULT;
+  obj->scale = LV_SCALE_NONE;
+  // No area until laid out
+  obj->coords = {0, 0, -1, -1};
+  if (obj->type == ObjBase || obj->type == ObjScreen) {
+    obj->width = obj->height = DEFAULT_SIZE;
+  } else {
+    obj->width = obj->height = LV_SIZE_CONTENT;
+  }
+  if (obj->type == ObjBase || obj->type == ObjButton) {
+    obj->flags = LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE;
+  }
+  apply_theme(obj);
+  if (parent) {
+    parent->children.push_back(obj);
+  }
+  live_objects.insert(obj);
+  return obj;
+}
+
+lv_obj_t *lv_obj_create(lv_obj_t *parent) { return create(parent, ObjBase); }
+
+lv_obj_t *lv_button_create(lv_obj_t *parent) {
+  return create(parent, ObjButton);
+}
+
+lv_obj_t *lv_label_create(lv_obj_t *parent) {
+  lv_obj_t *obj = create(parent, ObjLabel);
+  lv_label_set_text(obj, "Text");
+  return obj;
+}
+
+lv_obj_t *lv_line_create(lv_obj_t *parent) { return create(parent, ObjLine); }
+
+lv_obj_t *lv_image_create(lv_obj_t *parent) {
+  return create(parent, ObjImage);
+}
+
+static void send_event(lv_obj_t *obj, lv_event_code_t code,
+                       lv_layer_t *layer) {
+  lv_event_t event = {code, obj, nullptr, layer};
+  // Callbacks may add events or delete the object
+  std::vector<HostEvent> events = obj->events;
+  for (const HostEvent &entry : events) {
+    if (entry.code != code && entry.code != LV_EVENT_ALL) {
+      continue;
+    }
+    event.user_data = entry.user_data;
+    entry.callback(&event);
+    if (!lv_obj_is_valid(obj)) {
+      return;
+    }
+  }
+}
+
+// As in LVGL: the object hears LV_EVENT_DELETE before its children go
+static void delete_object(lv_obj_t *obj) {
+  if (obj->deleting) {
+    return;
+  }
+  obj->deleting = true;
+  send_event(obj, LV_EVENT_DELETE, nullptr);
+  invalidate_object(obj);
+  while (!obj->children.empty()) {
+    delete_object(obj->children.front());
+  }
+  if (obj->parent) {
+    auto &siblings = obj->parent->children;
+    siblings.erase(std::find(siblings.begin(), siblings.end(), obj));
+  }
+  if (obj == screen) {
+    screen = nullptr;
+    dirty_areas.clear();
+    dirty_all = false;
+  }
+  live_objects.erase(obj);
+  lv_free(obj->text);
+  obj->~lv_obj_t();
+  lv_free(obj);
+}
+
+void lv_obj_delete(lv_obj_t *obj) { delete_object(obj); }
+
+void lv_obj_clean(lv_obj_t *obj) {
+  while (!obj->children.empty()) {
+    delete_object(obj->children.front());
+  }
+}
+
+bool lv_obj_is_valid(const lv_obj_t *obj) {
+  return live_objects.count(obj) != 0;
+}
+
+lv_obj_t *lv_obj_get_parent(const lv_obj_t *obj) { return obj->parent; }
+
+void lv_obj_move_background(lv_obj_t *obj) {
+  auto &siblings = obj->parent->children;
+  siblings.erase(std::find(siblings.begin(), siblings.end(), obj));
+  siblings.insert(siblings.begin(), obj);
+  invalidate_object(obj);
+}
+
+void lv_obj_set_user_data(lv_obj_t *obj, void *user_data) {
+  obj->user_data = user_data;
+}
+
+void *lv_obj_get_user_data(lv_obj_t *obj) { return obj->user_data; }
+
+void lv_obj_add_flag(lv_obj_t *obj, lv_obj_flag_t flag) {
+  if (flag & LV_OBJ_FLAG_HIDDEN && !(obj->flags & LV_OBJ_FLAG_HIDDEN)) {
+    invalidate_object(obj);
+  }
+  obj->flags |= (uint32_t)flag;
+}
+
+void lv_obj_clear_flag(lv_obj_t *obj, lv_obj_flag_t flag) {
+  bool shown = flag & LV_OBJ_FLAG_HIDDEN && obj->flags & LV_OBJ_FLAG_HIDDEN;
+  obj->flags &= ~(uint32_t)flag;
+  if (shown) {
+    invalidate_object(obj);
+  }
+}
+
+bool lv_obj_has_flag(const lv_obj_t *obj, lv_obj_flag_t flag) {
+  return (obj->flags & (uint32_t)flag) == (uint32_t)flag;
+}
+
+static void set_state(lv_obj_t *obj, lv_state_t state) {
+  if (state != obj->state) {
+    obj->state = state;
+    invalidate_object(obj);
+  }
+}
+
+void lv_obj_add_state(lv_obj_t *obj, lv_state_t state) {
+  set_state(obj, (lv_state_t)(obj->state | state));
+}
+
+void lv_obj_clear_state(lv_obj_t *obj, lv_state_t state) {
+  set_state(obj, (lv_state_t)(obj->state & ~state));
+}
+
+void lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t event_cb,
+                         lv_event_code_t filter, void *user_data) {
+  obj->events.push_back({event_cb, filter, user_data});
+}
+
+void *lv_event_get_user_data(lv_event_t *e) { return e->user_data; }
+
+void *lv_event_get_target(lv_event_t *e) { return e->target; }
+
+lv_layer_t *lv_event_get_layer(lv_event_t *e) { return e->layer; }
+
+void lv_obj_invalidate(const lv_obj_t *obj) { invalidate_object(obj); }
+
+void lv_obj_invalidate_area(const lv_obj_t *obj, const lv_area_t *area) {
+  invalidate_area(obj, *area);
+}
+
+// Widgets
+
+void lv_label_set_text(lv_obj_t *obj, const char *text) {
+  text = text ? text : "";
+  size_t size = strlen(text) + 1;
+  auto *copy = static_cast<char *>(lv_malloc(size));
+  if (copy) {
+    memcpy(copy, text, size);
+  }
+  lv_free(obj->text);
+  obj->text = copy;
+  obj->static_text = nullptr;
+  invalidate_object(obj);
+}
+
+void lv_label_set_text_static(lv_obj_t *obj, const char *text) {
+  lv_free(obj->text);
+  obj->text = nullptr;
+  obj->static_text = text;
+  invalidate_object(obj);
+}
+
+static const char *label_text(const lv_obj_t *obj) {
+  if (obj->static_text) {
+    return obj->static_text;
+  }
+  return obj->text ? obj->text : "";
+}
+
+void lv_line_set_points(lv_obj_t *obj, const lv_point_precise_t points[],
+                        uint32_t point_num) {
+  obj->points = points;
+  obj->point_count = point_num;
+  invalidate_object(obj);
+}
+
+void lv_image_set_src(lv_obj_t *obj, const void *src) {
+  if (src != obj->src) {
+    obj->src = src;
+    invalidate_object(obj);
+  }
+}
+
+const void *lv_image_get_src(lv_obj_t *obj) { return obj->src; }
+
+// Transforms invalidate where the image was and where it is now
+void lv_image_set_scale(lv_obj_t *obj, uint32_t zoom) {
+  if (zoom != obj->scale) {
+    invalidate_object(obj);
+    obj->scale = zoom;
+    invalidate_object(obj);
+  }
+}
+
+void lv_image_set_rotation(lv_obj_t *obj, int32_t angle) {
+  if (angle != obj->rotation) {
+    invalidate_object(obj);
+    obj->rotation = angle;
+    invalidate_object(obj);
+  }
+}
+
+void lv_image_set_pivot(lv_obj_t *obj, int32_t x, int32_t y) {
+  invalidate_object(obj);
+  obj->pivot = {x, y};
+  obj->pivot_set = true;
+  invalidate_object(obj);
+}
+
+void lv_image_cache_drop(const void *src) {}
+
+static const lv_image_dsc_t *image_source(const lv_obj_t *obj) {
+  auto *source = static_cast<const lv_image_dsc_t *>(obj->src);
+  if (!source || source->header.magic != IMAGE_HEADER_MAGIC ||
+      !source->data) {
+    return nullptr;
+  }
+  return source;
+}
+
+// Draw buffers
+
+static uint32_t bytes_per_pixel(lv_color_format_t cf) {
+  return cf == LV_COLOR_FORMAT_A8 ? 1 : 2;
+}
+
+uint32_t lv_draw_buf_width_to_stride(uint32_t w, lv_color_format_t cf) {
+  return w * bytes_per_pixel(cf);
+}
+
+void *lv_draw_buf_align(void *buf, lv_color_format_t cf) {
+  auto address = reinterpret_cast<uintptr_t>(buf);
+  address = (address + LV_DRAW_BUF_ALIGN - 1) & ~(uintptr_t)(LV_DRAW_BUF_ALIGN - 1);
+  return reinterpret_cast<void *>(address);
+}
+
+lv_result_t lv_draw_buf_init(lv_draw_buf_t *draw_buf, uint32_t w, uint32_t h,
+                             lv_color_format_t cf, uint32_t stride, void *data,
+                             uint32_t data_size) {
+  if (stride == 0) {
+    stride = lv_draw_buf_width_to_stride(w, cf);
+  }
+  if (stride * h > data_size) {
+    return LV_RESULT_INVALID;
+  }
+  *draw_buf = {};
+  draw_buf->header.magic = IMAGE_HEADER_MAGIC;
+  // Masked to the header's bit fields
+  draw_buf->header.cf = (uint32_t)cf & 0xFFu;
+  draw_buf->header.w = w & 0xFFFFu;
+  draw_buf->header.h = h & 0xFFFFu;
+  draw_buf->header.stride = stride & 0xFFFFu;
+  draw_buf->data = static_cast<uint8_t *>(data);
+  draw_buf->unaligned_data = data;
+  draw_buf->data_size = data_size;
+  return LV_RESULT_OK;
+}
+
+void lv_draw_buf_clear(lv_draw_buf_t *draw_buf, const lv_area_t *area) {
+  uint32_t stride = draw_buf->header.stride;
+  if (!area) {
+    memset(draw_buf->data, 0, stride * draw_buf->header.h);
+    return;
+  }
+  uint32_t bytes = bytes_per_pixel((lv_color_format_t)draw_buf->header.cf);
+  for (int32_t y = area->y1; y <= area->y2; y++) {
+    memset(draw_buf->data + (uint32_t)y * stride + (uint32_t)area->x1 * bytes,
+           0, (uint32_t)lv_area_get_width(area) * bytes);
+  }
+}
+
+// Fonts, colors, memory and areas
+
+const lv_font_t *lv_font_get_default() { return &lv_host_font; }
+
+int32_t lv_font_get_line_height(const lv_font_t *font) {
+  return font->line_height;
+}
+
+lv_color_t lv_color_hex(uint32_t c) {
+  return {(uint8_t)(c & 0xFF), (uint8_t)((c >> 8) & 0xFF),
+          (uint8_t)((c >> 16) & 0xFF)};
+}
+
+lv_color_t lv_palette_main(lv_palette_t palette) {
+  return lv_color_hex(0x9E9E9E);
+}
+
+static size_t free_total() {
+  size_t total = 0;
+  for (const auto &block : free_blocks) {
+    total += block.second;
+  }
+  return total;
+}
+
+void *lv_malloc(size_t size) {
+  size = (LV_MAX(size, (size_t)1) + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
+  for (auto block = free_blocks.begin(); block != free_blocks.end(); ++block) {
+    if (block->second < size) {
+      continue;
+    }
+    size_t offset = block->first;
+    size_t remaining = block->second - size;
+    free_blocks.erase(block);
+    if (remaining) {
+      free_blocks[offset + size] = remaining;
+    }
+    used_blocks[offset] = size;
+    mem_max_used = LV_MAX(mem_max_used, MEM_POOL_SIZE - free_total());
+    return mem_pool + offset;
+  }
+  return nullptr;
+}
+
+void lv_free(void *data) {
+  if (!data) {
+    return;
+  }
+  auto offset = (size_t)(static_cast<uint8_t *>(data) - mem_pool);
+  auto used = used_blocks.find(offset);
+  if (used == used_blocks.end()) {
+    fprintf(stderr, "lv_free() of a block not from lv_malloc()\n");
+    abort();
+  }
+  size_t size = used->second;
+  used_blocks.erase(used);
+
+  auto next = free_blocks.lower_bound(offset);
+  if (next != free_blocks.end() && next->first == offset + size) {
+    size += next->second;
+    next = free_blocks.erase(next);
+  }
+  if (next != free_blocks.begin()) {
+    auto previous = std::prev(next);
+    if (previous->first + previous->second == offset) {
+      previous->second += size;
+      return;
+    }
+  }
+  free_blocks[offset] = size;
+}
+
+void lv_mem_monitor(lv_mem_monitor_t *monitor) {
+  *monitor = {};
+  monitor->total_size = MEM_POOL_SIZE;
+  for (const auto &block : free_blocks) {
+    monitor->free_cnt++;
+    monitor->free_size += block.second;
+    monitor->free_biggest_size = LV_MAX(monitor->free_biggest_size, block.second);
+  }
+  monitor->used_cnt = used_blocks.size();
+  monitor->max_used = mem_max_used;
+  size_t used = MEM_POOL_SIZE - monitor->free_size;
+  monitor->used_pct = (uint8_t)(used * 100 / MEM_POOL_SIZE);
+  monitor->frag_pct =
+      monitor->free_size
+          ? (uint8_t)(100 - monitor->free_biggest_size * 100 / monitor->free_size)
+          : 0;
+}
+
+int32_t lv_area_get_width(const lv_area_t *area) {
+  return area->x2 - area->x1 + 1;
+}
+
+int32_t lv_area_get_height(const lv_area_t *area) {
+  return area->y2 - area->y1 + 1;
+}
+
+bool lv_area_is_point_on(const lv_area_t *area, const lv_point_t *point,
+                         int32_t radius) {
+  return point->x >= area->x1 && point->x <= area->x2 &&
+         point->y >= area->y1 && point->y <= area->y2;
+}
+
+static bool intersect(lv_area_t *result, const lv_area_t &a,
+                      const lv_area_t &b) {
+  *result = {LV_MAX(a.x1, b.x1), LV_MAX(a.y1, b.y1), LV_MIN(a.x2, b.x2),
+             LV_MIN(a.y2, b.y2)};
+  return result->x1 <= result->x2 && result->y1 <= result->y2;
+}
+
+// Text
+
+static uint32_t next_codepoint(const char **text) {
+  auto *bytes = reinterpret_cast<const uint8_t *>(*text);
+  uint32_t codepoint = bytes[0];
+  int length = 1;
+  if (codepoint >= 0xF0) {
+    codepoint &= 0x07;
+    length = 4;
+  } else if (codepoint >= 0xE0) {
+    codepoint &= 0x0F;
+    length = 3;
+  } else if (codepoint >= 0xC0) {
+    codepoint &= 0x1F;
+    length = 2;
+  }
+  for (int i = 1; i < length && bytes[i]; i++) {
+    codepoint = codepoint << 6 | (bytes[i] & 0x3Fu);
+  }
+  *text += length;
+  return codepoint;
+}
+
+static const lv_host_glyph_t *find_glyph(const lv_font_t *font,
+                                         uint32_t codepoint) {
+  const lv_host_glyph_t *end = font->glyphs + font->glyph_count;
+  const lv_host_glyph_t *glyph = std::lower_bound(
+      font->glyphs, end, codepoint,
+      [](const lv_host_glyph_t &entry, uint32_t value) {
+        return entry.codepoint < value;
+      });
+  return glyph != end && glyph->codepoint == codepoint ? glyph : nullptr;
+}
+
+// Missing glyphs are drawn as an outlined box this wide
+static int32_t missing_advance(const lv_font_t *font) {
+  return font->line_height / 2;
+}
+
+static int32_t line_width_of(const lv_font_t *font, const char *begin,
+                             const char *end) {
+  int32_t width = 0;
+  while (begin < end) {
+    const lv_host_glyph_t *glyph = find_glyph(font, next_codepoint(&begin));
+    width += glyph ? glyph->advance : missing_advance(font);
+  }
+  return width;
+}
+
+static void text_size(const lv_font_t *font, const char *text, int32_t *width,
+                      int32_t *height) {
+  *width = 0;
+  int lines = 1;
+  const char *line = text;
+  for (;;) {
+    const char *end = strchr(line, '\n');
+    const char *line_end = end ? end : line + strlen(line);
+    *width = LV_MAX(*width, line_width_of(font, line, line_end));
+    if (!end) {
+      break;
+    }
+    line = end + 1;
+    lines++;
+  }
+  *height = lines * font->line_height;
+}
+
+// Layout
+
+static void self_size(const lv_obj_t *obj, int32_t *width, int32_t *height) {
+  *width = *height = 0;
+  switch (obj->type) {
+  case ObjLabel:
+    text_size(text_font(obj), label_text(obj), width, height);
+    break;
+  case ObjLine:
+    for (uint32_t i = 0; i < obj->point_count; i++) {
+      *width = LV_MAX(*width, (int32_t)obj->points[i].x);
+      *height = LV_MAX(*height, (int32_t)obj->points[i].y);
+    }
+    *width += line_width(obj);
+    *height += line_width(obj);
+    break;
+  case ObjImage:
+    if (const lv_image_dsc_t *source = image_source(obj)) {
+      *width = (int32_t)source->header.w;
+      *height = (int32_t)source->header.h;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+static bool is_flex_item(const lv_obj_t *obj) {
+  return !(obj->flags & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING |
+                         LV_OBJ_FLAG_IGNORE_LAYOUT));
+}
+
+static bool flex_is_column(const lv_obj_t *obj) {
+  return style_get(obj, PropFlexFlow, &HostStyle::flex_flow,
+                   LV_FLEX_FLOW_ROW) == LV_FLEX_FLOW_COLUMN;
+}
+
+static int32_t resolve_size(int32_t spec, int32_t available) {
+  if (LV_COORD_IS_PCT(spec)) {
+    return available * LV_COORD_GET_PCT(spec) / 100;
+  }
+  return spec;
+}
+
+// Sizes every object from the content box its parent offers
+static void measure(lv_obj_t *obj, int32_t available_width,
+                    int32_t available_height) {
+  bool content_width = obj->width == LV_SIZE_CONTENT;
+  bool content_height = obj->height == LV_SIZE_CONTENT;
+  int32_t width = content_width ? 0 : resolve_size(obj->width, available_width);
+  int32_t height =
+      content_height ? 0 : resolve_size(obj->height, available_height);
+  int32_t horizontal_space = space_left(obj) + space_right(obj);
+  int32_t vertical_space = space_top(obj) + space_bottom(obj);
+
+  int32_t inner_width = LV_MAX(width - horizontal_space, 0);
+  int32_t inner_height = LV_MAX(height - vertical_space, 0);
+  for (lv_obj_t *child : obj->children) {
+    measure(child, inner_width, inner_height);
+  }
+
+  if (content_width || content_height) {
+    int32_t self_width;
+    int32_t self_height;
+    self_size(obj, &self_width, &self_height);
+    int32_t children_width = 0;
+    int32_t children_height = 0;
+    if (is_flex(obj)) {
+      bool column = flex_is_column(obj);
+      int32_t gap = column ? style_get(obj, PropPadRow, &HostStyle::pad_row, 0)
+                           : style_get(obj, PropPadColumn,
+                                       &HostStyle::pad_column, 0);
+      int items = 0;
+      for (const lv_obj_t *child : obj->children) {
+        if (!is_flex_item(child)) {
+          continue;
+        }
+        if (column) {
+          children_width = LV_MAX(children_width, child->measured_width);
+          children_height += child->measured_height;
+        } else {
+          children_width += child->measured_width;
+          children_height = LV_MAX(children_height, child->measured_height);
+        }
+        items++;
+      }
+      if (items > 1) {
+        (column ? children_height : children_width) += gap * (items - 1);
+      }
+    } else {
+      for (const lv_obj_t *child : obj->children) {
+        if (child->align <= LV_ALIGN_TOP_LEFT) {
+          children_width =
+              LV_MAX(children_width, child->x + child->measured_width);
+          children_height =
+              LV_MAX(children_height, child->y + child->measured_height);
+        } else {
+          children_width = LV_MAX(children_width, child->measured_width);
+          children_height = LV_MAX(children_height, child->measured_height);
+        }
+      }
+    }
+    if (content_width) {
+      width = LV_MAX(self_width, children_width) + horizontal_space;
+    }
+    if (content_height) {
+      height = LV_MAX(self_height, children_height) + vertical_space;
+    }
+  }
+  obj->measured_width = width;
+  obj->measured_height = height;
+}
+
+static void place(lv_obj_t *obj, int32_t x, int32_t y);
+
+static void place_aligned(lv_obj_t *child, int32_t content_x,
+                          int32_t content_y, int32_t content_width,
+                          int32_t content_height) {
+  int32_t free_x = content_width - child->measured_width;
+  int32_t free_y = content_height - child->measured_height;
+  int32_t x = child->x;
+  int32_t y = child->y;
+  switch (child->align) {
+  case LV_ALIGN_TOP_MID:
+    x += free_x / 2;
+    break;
+  case LV_ALIGN_TOP_RIGHT:
+    x += free_x;
+    break;
+  case LV_ALIGN_BOTTOM_LEFT:
+    y += free_y;
+    break;
+  case LV_ALIGN_BOTTOM_MID:
+    x += free_x / 2;
+    y += free_y;
+    break;
+  case LV_ALIGN_BOTTOM_RIGHT:
+    x += free_x;
+    y += free_y;
+    break;
+  case LV_ALIGN_LEFT_MID:
+    y += free_y / 2;
+    break;
+  case LV_ALIGN_RIGHT_MID:
+    x += free_x;
+    y += free_y / 2;
+    break;
+  case LV_ALIGN_CENTER:
+    x += free_x / 2;
+    y += free_y / 2;
+    break;
+  default:
+    break;
+  }
+  place(child, content_x + x, content_y + y);
+}
+
+// Flex ignores the items' own positions, as LVGL's does; no wrapping
+static void place_flex(lv_obj_t *obj, int32_t content_x, int32_t content_y,
+                       int32_t content_width, int32_t content_height) {
+  bool column = flex_is_column(obj);
+  int32_t gap = column
+                    ? style_get(obj, PropPadRow, &HostStyle::pad_row, 0)
+                    : style_get(obj, PropPadColumn, &HostStyle::pad_column, 0);
+  lv_flex_align_t main_place = style_get(obj, PropFlexMain,
+                                         &HostStyle::flex_main,
+                                         LV_FLEX_ALIGN_START);
+  lv_flex_align_t cross_place = style_get(obj, PropFlexCross,
+                                          &HostStyle::flex_cross,
+                                          LV_FLEX_ALIGN_START);
+  int32_t total = 0;
+  int items = 0;
+  for (const lv_obj_t *child : obj->children) {
+    if (is_flex_item(child)) {
+      total += column ? child->measured_height : child->measured_width;
+      items++;
+    }
+  }
+  total += items > 1 ? gap * (items - 1) : 0;
+
+  int32_t main_size = column ? content_height : content_width;
+  int32_t cross_size = column ? content_width : content_height;
+  int32_t position = 0;
+  if (main_place == LV_FLEX_ALIGN_CENTER) {
+    position = (main_size - total) / 2;
+  } else if (main_place == LV_FLEX_ALIGN_END) {
+    position = main_size - total;
+  }
+  for (lv_obj_t *child : obj->children) {
+    if (!is_flex_item(child)) {
+      place_aligned(child, content_x, content_y, content_width,
+                    content_height);
+      continue;
+    }
+    int32_t child_main = column ? child->measured_height : child->measured_width;
+    int32_t child_cross = column ? child->measured_width : child->measured_height;
+    int32_t cross = 0;
+    if (cross_place == LV_FLEX_ALIGN_CENTER) {
+      cross = (cross_size - child_cross) / 2;
+    } else if (cross_place == LV_FLEX_ALIGN_END) {
+      cross = cross_size - child_cross;
+    }
+    if (column) {
+      place(child, content_x + cross, content_y + position);
+    } else {
+      place(child, content_x + position, content_y + cross);
+    }
+    position += child_main + gap;
+  }
+}
+
+static void place(lv_obj_t *obj, int32_t x, int32_t y) {
+  lv_area_t coords = {x, y, x + obj->measured_width - 1,
+                      y + obj->measured_height - 1};
+  if (memcmp(&coords, &obj->coords, sizeof(coords)) != 0) {
+    invalidate_object(obj);
+    obj->coords = coords;
+    invalidate_object(obj);
+  }
+  int32_t content_x = x + space_left(obj);
+  int32_t content_y = y + space_top(obj);
+  int32_t content_width =
+      obj->measured_width - space_left(obj) - space_right(obj);
+  int32_t content_height =
+      obj->measured_height - space_top(obj) - space_bottom(obj);
+  if (is_flex(obj)) {
+    place_flex(obj, content_x, content_y, content_width, content_height);
+    return;
+  }
+  for (lv_obj_t *child : obj->children) {
+    place_aligned(child, content_x, content_y, content_width, content_height);
+  }
+}
+
+static void collect_resized(lv_obj_t *obj, std::vector<lv_obj_t *> *resized) {
+  int32_t width = lv_area_get_width(&obj->coords);
+  int32_t height = lv_area_get_height(&obj->coords);
+  if (width != obj->notified_width || height != obj->notified_height) {
+    obj->notified_width = width;
+    obj->notified_height = height;
+    resized->push_back(obj);
+  }
+  for (lv_obj_t *child : obj->children) {
+    collect_resized(child, resized);
+  }
+}
+
+// Repeats until LV_EVENT_SIZE_CHANGED handlers stop changing sizes. Calls
+// from within a handler only refresh the coordinates.
+void lv_obj_update_layout(const lv_obj_t *obj) {
+  if (!screen) {
+    return;
+  }
+  if (in_layout) {
+    measure(screen, screen->width, screen->height);
+    place(screen, 0, 0);
+    return;
+  }
+  in_layout = true;
+  for (int pass = 0; pass < LAYOUT_PASSES && screen; pass++) {
+    measure(screen, screen->width, screen->height);
+    place(screen, 0, 0);
+    std::vector<lv_obj_t *> resized;
+    collect_resized(screen, &resized);
+    if (resized.empty()) {
+      break;
+    }
+    for (lv_obj_t *target : resized) {
+      if (lv_obj_is_valid(target)) {
+        send_event(target, LV_EVENT_SIZE_CHANGED, nullptr);
+      }
+    }
+  }
+  in_layout = false;
+}
+
+void lv_obj_set_pos(lv_obj_t *obj, int32_t x, int32_t y) {
+  obj->x = x;
+  obj->y = y;
+  obj->align = LV_ALIGN_DEFAULT;
+}
+
+void lv_obj_set_size(lv_obj_t *obj, int32_t width, int32_t height) {
+  obj->width = width;
+  obj->height = height;
+}
+
+void lv_obj_align(lv_obj_t *obj, lv_align_t align, int32_t x_ofs,
+                  int32_t y_ofs) {
+  obj->align = align;
+  obj->x = x_ofs;
+  obj->y = y_ofs;
+}
+
+void lv_obj_center(lv_obj_t *obj) { lv_obj_align(obj, LV_ALIGN_CENTER, 0, 0); }
+
+// Resolved once against the base's current position, as LVGL does
+void lv_obj_align_to(lv_obj_t *obj, const lv_obj_t *base, lv_align_t align,
+                     int32_t x_ofs, int32_t y_ofs) {
+  lv_obj_update_layout(obj);
+  int32_t width = lv_obj_get_width(obj);
+  int32_t base_width = lv_obj_get_width(base);
+  int32_t base_height = lv_obj_get_height(base);
+  int32_t x = 0;
+  int32_t y = 0;
+  switch (align) {
+  case LV_ALIGN_OUT_BOTTOM_LEFT:
+    y = base_height;
+    break;
+  case LV_ALIGN_OUT_BOTTOM_MID:
+    x = base_width / 2 - width / 2;
+    y = base_height;
+    break;
+  case LV_ALIGN_CENTER:
+    x = base_width / 2 - width / 2;
+    y = base_height / 2 - lv_obj_get_height(obj) / 2;
+    break;
+  default:
+    break;
+  }
+  const lv_obj_t *parent = obj->parent;
+  x += x_ofs + base->coords.x1 - parent->coords.x1 - space_left(parent);
+  y += y_ofs + base->coords.y1 - parent->coords.y1 - space_top(parent);
+  lv_obj_set_pos(obj, x, y);
+}
+
+int32_t lv_obj_get_width(const lv_obj_t *obj) {
+  return lv_area_get_width(&obj->coords);
+}
+
+int32_t lv_obj_get_height(const lv_obj_t *obj) {
+  return lv_area_get_height(&obj->coords);
+}
+
+void lv_obj_get_coords(const lv_obj_t *obj, lv_area_t *coords) {
+  *coords = obj->coords;
+}
+
+// Rendering. Shapes are anti-aliased by their coverage of each pixel's
+// center.
+
+static uint8_t mix(uint8_t foreground, uint8_t background, uint32_t alpha) {
+  return (uint8_t)((foreground * alpha + background * (255 - alpha) + 127) /
+                   255);
+}
+
+static lv_color_t mix_color(lv_color_t foreground, lv_color_t background,
+                            uint32_t alpha) {
+  return {mix(foreground.blue, background.blue, alpha),
+          mix(foreground.green, background.green, alpha),
+          mix(foreground.red, background.red, alpha)};
+}
+
+static void blend(const lv_layer_t *layer, int32_t x, int32_t y,
+                  lv_color_t color, uint32_t alpha) {
+  if (alpha == 0) {
+    return;
+  }
+  uint8_t *pixel =
+      layer->pixels + ((size_t)y * (size_t)layer->width + (size_t)x) * 3;
+  pixel[0] = mix(color.red, pixel[0], alpha);
+  pixel[1] = mix(color.green, pixel[1], alpha);
+  pixel[2] = mix(color.blue, pixel[2], alpha);
+}
+
+static uint32_t to_alpha(float coverage, lv_opa_t opa) {
+  coverage = coverage < 0 ? 0 : coverage > 1 ? 1 : coverage;
+  return (uint32_t)(coverage * (float)opa + 0.5f);
+}
+
+static int32_t clamp_radius(const lv_area_t &area, int32_t radius) {
+  int32_t half =
+      LV_MIN(lv_area_get_width(&area), lv_area_get_height(&area)) / 2;
+  return LV_MIN(radius, half);
+}
+
+static float rounded_rect_coverage(const lv_area_t &area, int32_t radius,
+                                   float x, float y) {
+  if (x < (float)area.x1 || x > (float)area.x2 + 1 || y < (float)area.y1 ||
+      y > (float)area.y2 + 1) {
+    return 0;
+  }
+  if (radius <= 0) {
+    return 1;
+  }
+  auto r = (float)radius;
+  float dx = std::max({(float)area.x1 + r - x, x - ((float)area.x2 + 1 - r),
+                       0.0f});
+  float dy = std::max({(float)area.y1 + r - y, y - ((float)area.y2 + 1 - r),
+                       0.0f});
+  return r - sqrtf(dx * dx + dy * dy) + 0.5f;
+}
+
+static void draw_rect(const lv_layer_t *layer, const lv_area_t &area,
+                      int32_t radius, lv_color_t bg_color, lv_opa_t bg_opa,
+                      int32_t border, lv_color_t border_color,
+                      lv_opa_t border_opa) {
+  lv_area_t clipped;
+  if (!intersect(&clipped, area, layer->clip)) {
+    return;
+  }
+  radius = clamp_radius(area, radius);
+  lv_area_t inner = {area.x1 + border, area.y1 + border, area.x2 - border,
+                     area.y2 - border};
+  bool has_inner = inner.x1 <= inner.x2 && inner.y1 <= inner.y2;
+  int32_t inner_radius = LV_MAX(radius - border, 0);
+  for (int32_t y = clipped.y1; y <= clipped.y2; y++) {
+    for (int32_t x = clipped.x1; x <= clipped.x2; x++) {
+      float px = (float)x + 0.5f;
+      float py = (float)y + 0.5f;
+      float outer = rounded_rect_coverage(area, radius, px, py);
+      if (outer <= 0) {
+        continue;
+      }
+      outer = LV_MIN(outer, 1.0f);
+      if (bg_opa) {
+        blend(layer, x, y, bg_color, to_alpha(outer, bg_opa));
+      }
+      if (border > 0 && border_opa) {
+        float inside =
+            has_inner ? LV_MIN(LV_MAX(rounded_rect_coverage(inner, inner_radius,
+                                                            px, py),
+                                      0.0f),
+                               1.0f)
+                      : 0;
+        blend(layer, x, y, border_color, to_alpha(outer - inside, border_opa));
+      }
+    }
+  }
+}
+
+// A segment between pixel centers, with round or square-cut ends
+static void draw_segment(const lv_layer_t *layer, float x1, float y1,
+                         float x2, float y2, int32_t width, bool rounded,
+                         lv_color_t color, lv_opa_t opa) {
+  float half = (float)width / 2;
+  lv_area_t bounds = {(int32_t)floorf(fminf(x1, x2) - half - 1),
+                      (int32_t)floorf(fminf(y1, y2) - half - 1),
+                      (int32_t)ceilf(fmaxf(x1, x2) + half + 1),
+                      (int32_t)ceilf(fmaxf(y1, y2) + half + 1)};
+  lv_area_t clipped;
+  if (!intersect(&clipped, bounds, layer->clip)) {
+    return;
+  }
+  float dx = x2 - x1;
+  float dy = y2 - y1;
+  float length = sqrtf(dx * dx + dy * dy);
+  if (length == 0 && !rounded) {
+    return;
+  }
+  for (int32_t y = clipped.y1; y <= clipped.y2; y++) {
+    for (int32_t x = clipped.x1; x <= clipped.x2; x++) {
+      float px = (float)x + 0.5f - (x1 + 0.5f);
+      float py = (float)y + 0.5f - (y1 + 0.5f);
+      float coverage;
+      if (length == 0) {
+        coverage = half - sqrtf(px * px + py * py) + 0.5f;
+      } else {
+        float along = (px * dx + py * dy) / length;
+        float across = fabsf(px * dy - py * dx) / length;
+        if (rounded) {
+          float t = fminf(fmaxf(along, 0), length);
+          float ex = px - dx * t / length;
+          float ey = py - dy * t / length;
+          coverage = half - sqrtf(ex * ex + ey * ey) + 0.5f;
+        } else {
+          coverage = fminf(half - across + 0.5f,
+                           fminf(along, length - along) + 0.5f);
+        }
+      }
+      blend(layer, x, y, color, to_alpha(coverage, opa));
+    }
+  }
+}
+
+static void draw_glyph(const lv_layer_t *layer, const lv_area_t &clip,
+                       const lv_font_t *font, const lv_host_glyph_t *glyph,
+                       int32_t x, int32_t y, lv_color_t color, lv_opa_t opa) {
+  int32_t row_bytes = (glyph->box_w + 1) / 2;
+  const uint8_t *bits = font->bitmap + glyph->bitmap_index;
+  for (int32_t row = 0; row < glyph->box_h; row++) {
+    int32_t py = y + glyph->ofs_y + row;
+    if (py < clip.y1 || py > clip.y2) {
+      continue;
+    }
+    for (int32_t column = 0; column < glyph->box_w; column++) {
+      int32_t px = x + glyph->ofs_x + column;
+      if (px < clip.x1 || px > clip.x2) {
+        continue;
+      }
+      uint8_t byte = bits[row * row_bytes + column / 2];
+      uint32_t value = column % 2 ? byte & 0x0Fu : byte >> 4;
+      blend(layer, px, py, color, value * 17 * opa / 255);
+    }
+  }
+}
+
+static void draw_missing_glyph(const lv_layer_t *layer, const lv_area_t &clip,
+                               const lv_font_t *font, int32_t x, int32_t y,
+                               lv_color_t color, lv_opa_t opa) {
+  int32_t width = missing_advance(font);
+  lv_area_t box = {x + 1, y + font->line_height / 4, x + width - 2,
+                   y + font->line_height - font->base_line - 1};
+  lv_layer_t clipped = *layer;
+  if (intersect(&clipped.clip, clip, layer->clip)) {
+    draw_rect(&clipped, box, 0, color, 0, 1, color, opa);
+  }
+}
+
+static void draw_text(const lv_layer_t *layer, const lv_area_t &area,
+                      const char *text, const lv_font_t *font,
+                      lv_color_t color, lv_opa_t opa, lv_text_align_t align) {
+  lv_area_t clip;
+  if (!intersect(&clip, area, layer->clip)) {
+    return;
+  }
+  int32_t y = area.y1;
+  const char *line = text;
+  for (;;) {
+    const char *end = strchr(line, '\n');
+    const char *line_end = end ? end : line + strlen(line);
+    int32_t free = lv_area_get_width(&area) - line_width_of(font, line, line_end);
+    int32_t x = area.x1;
+    if (align == LV_TEXT_ALIGN_CENTER) {
+      x += free / 2;
+    } else if (align == LV_TEXT_ALIGN_RIGHT) {
+      x += free;
+    }
+    for (const char *cursor = line; cursor < line_end;) {
+      const lv_host_glyph_t *glyph = find_glyph(font, next_codepoint(&cursor));
+      if (glyph) {
+        draw_glyph(layer, clip, font, glyph, x, y, color, opa);
+        x += glyph->advance;
+      } else {
+        draw_missing_glyph(layer, clip, font, x, y, color, opa);
+        x += missing_advance(font);
+      }
+    }
+    if (!end) {
+      break;
+    }
+    line = end + 1;
+    y += font->line_height;
+  }
+}
+
+static void sample_image(const lv_image_dsc_t *source, int32_t x, int32_t y,
+                         lv_color_t *color, uint32_t *alpha) {
+  uint32_t stride = source->header.stride;
+  const uint8_t *data = source->data;
+  switch (source->header.cf) {
+  case LV_COLOR_FORMAT_A8:
+    *color = lv_color_hex(0);
+    *alpha = data[(uint32_t)y * stride + (uint32_t)x];
+    return;
+  case LV_COLOR_FORMAT_RGB565:
+  case LV_COLOR_FORMAT_RGB565A8: {
+    const uint8_t *pixel = data + (uint32_t)y * stride + (uint32_t)x * 2;
+    auto value = (uint32_t)(pixel[0] | pixel[1] << 8);
+    *color = {(uint8_t)((value & 0x1F) * 255 / 31),
+              (uint8_t)(((value >> 5) & 0x3F) * 255 / 63),
+              (uint8_t)((value >> 11) * 255 / 31)};
+    *alpha = 255;
+    if (source->header.cf == LV_COLOR_FORMAT_RGB565A8) {
+      const uint8_t *alpha_plane = data + stride * source->header.h;
+      *alpha = alpha_plane[(uint32_t)y * (stride / 2) + (uint32_t)x];
+    }
+    return;
+  }
+  default:
+    *alpha = 0;
+    return;
+  }
+}
+
+// Scaled and rotated around the pivot with nearest-neighbour sampling
+static void draw_image(const lv_layer_t *layer, const lv_obj_t *obj) {
+  const lv_image_dsc_t *source = image_source(obj);
+  if (!source) {
+    return;
+  }
+  lv_color_t recolor =
+      style_get(obj, PropRecolor, &HostStyle::recolor, lv_color_hex(0));
+  lv_opa_t recolor_opa = style_get(obj, PropRecolorOpa,
+                                   &HostStyle::recolor_opa,
+                                   (lv_opa_t)LV_OPA_TRANSP);
+  auto width = (int32_t)source->header.w;
+  auto height = (int32_t)source->header.h;
+  lv_point_t pivot =
+      obj->pivot_set ? obj->pivot : lv_point_t{width / 2, height / 2};
+  float scale = (float)obj->scale / LV_SCALE_NONE;
+  float radians = (float)obj->rotation / 10.0f * (float)M_PI / 180.0f;
+  float cosine = cosf(radians);
+  float sine = sinf(radians);
+  float origin_x = (float)(obj->coords.x1 + pivot.x);
+  float origin_y = (float)(obj->coords.y1 + pivot.y);
+
+  // Where the corners land
+  float min_x = origin_x, max_x = origin_x, min_y = origin_y, max_y = origin_y;
+  const float corners[4][2] = {
+      {0, 0}, {(float)width, 0}, {0, (float)height}, {(float)width, (float)height}};
+  for (const auto &corner : corners) {
+    float cx = (corner[0] - (float)pivot.x) * scale;
+    float cy = (corner[1] - (float)pivot.y) * scale;
+    float x = origin_x + cx * cosine - cy * sine;
+    float y = origin_y + cx * sine + cy * cosine;
+    min_x = fminf(min_x, x);
+    max_x = fmaxf(max_x, x);
+    min_y = fminf(min_y, y);
+    max_y = fmaxf(max_y, y);
+  }
+  lv_area_t bounds = {(int32_t)floorf(min_x), (int32_t)floorf(min_y),
+                      (int32_t)ceilf(max_x), (int32_t)ceilf(max_y)};
+  lv_area_t clipped;
+  if (scale <= 0 || !intersect(&clipped, bounds, layer->clip)) {
+    return;
+  }
+  for (int32_t y = clipped.y1; y <= clipped.y2; y++) {
+    for (int32_t x = clipped.x1; x <= clipped.x2; x++) {
+      float dx = (float)x + 0.5f - origin_x;
+      float dy = (float)y + 0.5f - origin_y;
+      auto sx = (int32_t)floorf((dx * cosine + dy * sine) / scale +
+                                (float)pivot.x);
+      auto sy = (int32_t)floorf((-dx * sine + dy * cosine) / scale +
+                                (float)pivot.y);
+      if (sx < 0 || sy < 0 || sx >= width || sy >= height) {
+        continue;
+      }
+      lv_color_t color;
+      uint32_t alpha;
+      sample_image(source, sx, sy, &color, &alpha);
+      if (recolor_opa) {
+        color = mix_color(recolor, color, recolor_opa);
+      }
+      blend(layer, x, y, color, alpha);
+    }
+  }
+}
+
+static void draw_lines(const lv_layer_t *layer, const lv_obj_t *obj) {
+  int32_t width = line_width(obj);
+  lv_opa_t opa =
+      style_get(obj, PropLineOpa, &HostStyle::line_opa, (lv_opa_t)LV_OPA_COVER);
+  if (width <= 0 || opa == 0) {
+    return;
+  }
+  lv_color_t color =
+      style_get(obj, PropLineColor, &HostStyle::line_color, lv_color_hex(0));
+  bool rounded =
+      style_get(obj, PropLineRounded, &HostStyle::line_rounded, false);
+  auto x = (float)obj->coords.x1;
+  auto y = (float)obj->coords.y1;
+  for (uint32_t i = 1; i < obj->point_count; i++) {
+    const lv_point_precise_t &from = obj->points[i - 1];
+    const lv_point_precise_t &to = obj->points[i];
+    draw_segment(layer, x + from.x, y + from.y, x + to.x, y + to.y, width,
+                 rounded, color, opa);
+  }
+}
+
+static void draw_border(const lv_layer_t *layer, const lv_obj_t *obj) {
+  int32_t width = border_width(obj);
+  lv_opa_t opa = style_get(obj, PropBorderOpa, &HostStyle::border_opa,
+                           (lv_opa_t)LV_OPA_COVER);
+  if (width <= 0 || opa == 0) {
+    return;
+  }
+  draw_rect(layer, obj->coords, style_get(obj, PropRadius, &HostStyle::radius, 0),
+            lv_color_hex(0), 0, width,
+            style_get(obj, PropBorderColor, &HostStyle::border_color,
+                      lv_color_hex(0)),
+            opa);
+}
+
+static void draw_object(const lv_layer_t *parent_layer, lv_obj_t *obj) {
+  if (obj->flags & LV_OBJ_FLAG_HIDDEN) {
+    return;
+  }
+  lv_layer_t layer = *parent_layer;
+  if (!intersect(&layer.clip, draw_area(obj), parent_layer->clip)) {
+    return;
+  }
+
+  lv_opa_t bg_opa =
+      style_get(obj, PropBgOpa, &HostStyle::bg_opa, (lv_opa_t)LV_OPA_TRANSP);
+  if (bg_opa) {
+    draw_rect(&layer, obj->coords,
+              style_get(obj, PropRadius, &HostStyle::radius, 0),
+              style_get(obj, PropBgColor, &HostStyle::bg_color,
+                        lv_color_hex(0xFFFFFF)),
+              bg_opa, 0, lv_color_hex(0), 0);
+  }
+  bool border_post =
+      style_get(obj, PropBorderPost, &HostStyle::border_post, false);
+  if (!border_post) {
+    draw_border(&layer, obj);
+  }
+  switch (obj->type) {
+  case ObjLabel: {
+    lv_area_t content = {obj->coords.x1 + space_left(obj),
+                         obj->coords.y1 + space_top(obj),
+                         obj->coords.x2 - space_right(obj),
+                         obj->coords.y2 - space_bottom(obj)};
+    draw_text(&layer, content, label_text(obj), text_font(obj),
+              style_get(obj, PropTextColor, &HostStyle::text_color,
+                        lv_color_hex(0)),
+              LV_OPA_COVER,
+              style_get(obj, PropTextAlign, &HostStyle::text_align,
+                        LV_TEXT_ALIGN_AUTO));
+    break;
+  }
+  case ObjLine:
+    draw_lines(&layer, obj);
+    break;
+  case ObjImage:
+    draw_image(&layer, obj);
+    break;
+  default:
+    break;
+  }
+  send_event(obj, LV_EVENT_DRAW_MAIN, &layer);
+
+  lv_layer_t children_layer = *parent_layer;
+  if (intersect(&children_layer.clip, obj->coords, parent_layer->clip)) {
+    // Drawing may not change the tree, but copy in case a callback did
+    std::vector<lv_obj_t *> children = obj->children;
+    for (lv_obj_t *child : children) {
+      draw_object(&children_layer, child);
+    }
+  }
+  if (border_post) {
+    draw_border(&layer, obj);
+  }
+}
+
+void lv_draw_rect_dsc_init(lv_draw_rect_dsc_t *dsc) {
+  *dsc = {};
+  dsc->bg_color = lv_color_hex(0xFFFFFF);
+  dsc->bg_opa = LV_OPA_COVER;
+  dsc->border_opa = LV_OPA_COVER;
+}
+
+void lv_draw_rect(lv_layer_t *layer, const lv_draw_rect_dsc_t *dsc,
+                  const lv_area_t *coords) {
+  draw_rect(layer, *coords, dsc->radius, dsc->bg_color, dsc->bg_opa,
+            dsc->border_width, dsc->border_color, dsc->border_opa);
+}
+
+void lv_draw_label_dsc_init(lv_draw_label_dsc_t *dsc) {
+  *dsc = {};
+  dsc->font = lv_font_get_default();
+  dsc->color = lv_color_hex(0);
+  dsc->opa = LV_OPA_COVER;
+  dsc->align = LV_TEXT_ALIGN_AUTO;
+}
+
+void lv_draw_label(lv_layer_t *layer, const lv_draw_label_dsc_t *dsc,
+                   const lv_area_t *coords) {
+  if (dsc->text) {
+    draw_text(layer, *coords, dsc->text, dsc->font, dsc->color, dsc->opa,
+              dsc->align);
+  }
+}
+
+// Host display
+
+lv_obj_t *lv_host_screen_create(int32_t width, int32_t height) {
+  lv_host_screen_delete();
+  screen = create(nullptr, ObjScreen);
+  screen->width = width;
+  screen->height = height;
+  dirty_all = true;
+  lv_obj_update_layout(screen);
+  return screen;
+}
+
+void lv_host_screen_delete() {
+  if (screen) {
+    delete_object(screen);
+  }
+}
+
+lv_obj_t *lv_screen_active() { return screen; }
+
+uint32_t lv_host_render(uint8_t *pixels) {
+  if (!screen) {
+    return 0;
+  }
+  lv_obj_update_layout(screen);
+  std::vector<lv_area_t> areas;
+  if (dirty_all) {
+    areas.push_back(screen->coords);
+  } else {
+    join_dirty_areas();
+    areas = dirty_areas;
+  }
+  dirty_areas.clear();
+  dirty_all = false;
+
+  uint32_t redrawn = 0;
+  for (const lv_area_t &area : areas) {
+    for (int32_t y = area.y1; y <= area.y2; y++) {
+      memset(pixels + ((size_t)y * (size_t)screen->width + (size_t)area.x1) * 3,
+             0, (size_t)lv_area_get_width(&area) * 3);
+    }
+    lv_layer_t layer = {pixels, screen->width, screen->height, area};
+    draw_object(&layer, screen);
+    redrawn += (uint32_t)area_size(area);
+  }
+  return redrawn;
+}
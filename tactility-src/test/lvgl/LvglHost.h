@@ -0,0 +1,20 @@
+#pragma once
+
+#include "lvgl.h"
+
+// The host display behind the LVGL stand-in in lvgl.h: one screen, styled
+// like LVGL's default dark theme, that is laid out and rendered on demand
+
+// Replaces any previous screen; returns the new one
+lv_obj_t *lv_host_screen_create(int32_t width, int32_t height);
+
+// Deletes the screen and everything on it, sending LV_EVENT_DELETE as usual
+void lv_host_screen_delete();
+
+lv_obj_t *lv_screen_active();
+
+// Lays out the screen and renders it into `pixels`: width x height RGB888
+// triplets, top row first. Like LVGL, only redraws what was invalidated since
+// the last render, so pass the same pixels every time. Returns how many
+// pixels were redrawn, the whole screen after lv_host_screen_create().
+uint32_t lv_host_render(uint8_t *pixels);
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Generate HostFont.cpp, the default font of the host LVGL stand-in.
+
+Glyphs are rasterized from Pillow's built-in font (Aileron) at a 16 px line
+height, the height of LVGL's default Montserrat 14, and stored at 4 bits per
+pixel like LVGL's own fonts. The text therefore has the right size and weight
+on the golden frames, but not Montserrat's exact shapes. Printable ASCII is
+covered, plus LV_SYMBOL_WIFI, drawn here as three arcs and a dot.
+
+Usage: python generate_font.py (from test/lvgl)
+"""
+
+import os
+
+from PIL import Image, ImageDraw, ImageFont
+
+OUTPUT = "HostFont.cpp"
+FONT_SIZE = 13
+SYMBOL_WIFI = 0xF1EB
+SUPERSAMPLE = 4
+
+
+def render_char(font, ascent, line_height, character):
+    advance = round(font.getlength(character))
+    width = advance + 8
+    image = Image.new("L", (width, line_height + 8))
+    draw = ImageDraw.Draw(image)
+    draw.text((4, 4 + ascent), character, font=font, fill=255, anchor="ls")
+    box = image.getbbox()
+    if not box:
+        return advance, 0, 0, image.crop((0, 0, 0, 0))
+    return advance, box[0] - 4, box[1] - 4, image.crop(box)
+
+
+def render_wifi(line_height):
+    size = line_height * SUPERSAMPLE
+    image = Image.new("L", (size, size))
+    draw = ImageDraw.Draw(image)
+    center_x = size // 2
+    center_y = size - 2 * SUPERSAMPLE
+    stroke = 2 * SUPERSAMPLE
+    for radius in (6, 10, 14):
+        r = radius * SUPERSAMPLE
+        draw.arc((center_x - r, center_y - r, center_x + r, center_y + r),
+                 225, 315, fill=255, width=stroke)
+    dot = int(1.5 * SUPERSAMPLE)
+    draw.ellipse((center_x - dot, center_y - dot, center_x + dot,
+                  center_y + dot), fill=255)
+    image = image.resize((line_height, line_height), Image.LANCZOS)
+    box = image.getbbox()
+    return line_height, box[0], box[1], image.crop(box)
+
+
+def pack_4bpp(image):
+    width, height = image.size
+    pixels = image.tobytes()
+    nibbles = [(value * 15 + 127) // 255 for value in pixels]
+    data = bytearray()
+    for row in range(height):
+        line = nibbles[row * width:(row + 1) * width]
+        if len(line) % 2:
+            line.append(0)
+        for i in range(0, len(line), 2):
+            data.append(line[i] << 4 | line[i + 1])
+    return data
+
+
+def main():
+    font = ImageFont.load_default(size=FONT_SIZE)
+    ascent, descent = font.getmetrics()
+    line_height = ascent + descent
+
+    glyphs = []
+    for code in range(0x20, 0x7F):
+        glyphs.append((code,) + render_char(font, ascent, line_height,
+                                            chr(code)))
+    glyphs.append((SYMBOL_WIFI,) + render_wifi(line_height))
+
+    bitmap = bytearray()
+    entries = []
+    for code, advance, offset_x, offset_y, image in glyphs:
+        entries.append((code, len(bitmap), advance, image.size[0],
+                        image.size[1], offset_x, offset_y))
+        bitmap += pack_4bpp(image)
+
+    with open(OUTPUT, "w", encoding="utf-8") as file:
+        file.write("// Generated by generate_font.py from Pillow's built-in "
+                   "font; do not edit.\n\n")
+        file.write('#include "lvgl.h"\n\n')
+        file.write("static const uint8_t bitmap[] = {\n")
+        for i in range(0, len(bitmap), 16):
+            row = ", ".join(f"0x{value:02X}" for value in bitmap[i:i + 16])
+            file.write(f"    {row},\n")
+        file.write("};\n\n")
+        file.write("// Codepoint, bitmap offset, advance, box width and "
+                   "height, box offset\n")
+        file.write("static const lv_host_glyph_t glyphs[] = {\n")
+        for entry in entries:
+            file.write("    {" + ", ".join(str(value) for value in entry) +
+                       "},\n")
+        file.write("};\n\n")
+        file.write("const lv_font_t lv_host_font = {\n")
+        file.write(f"    {line_height}, {descent}, glyphs,\n")
+        file.write("    sizeof(glyphs) / sizeof(glyphs[0]), bitmap,\n")
+        file.write("};\n")
+    print(f"{OUTPUT}: {len(entries)} glyphs, {len(bitmap)} bitmap bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,333 @@
+#pragma once
+
+// Host stand-in for the part of LVGL 9 the clock faces use, so faces can be
+// created, laid out and rendered in host tests and benchmarks without a
+// display. Objects, styles, flex layout and events follow LVGL's semantics;
+// rendering is a simple anti-aliased software renderer (see LvglHost.h), so
+// frames resemble the device's but are not pixel-identical to LVGL's.
+
+#include <cstddef>
+#include <cstdint>
+
+typedef int32_t lv_coord_t;
+typedef uint8_t lv_opa_t;
+typedef uint16_t lv_state_t;
+typedef uint32_t lv_style_selector_t;
+typedef float lv_value_precise_t;
+
+typedef struct lv_obj_t lv_obj_t;
+typedef struct lv_event_t lv_event_t;
+typedef struct lv_layer_t lv_layer_t;
+typedef struct lv_display_t lv_display_t;
+
+typedef struct {
+  int32_t x1, y1, x2, y2;
+} lv_area_t;
+
+typedef struct {
+  int32_t x, y;
+} lv_point_t;
+
+typedef struct {
+  lv_value_precise_t x, y;
+} lv_point_precise_t;
+
+typedef struct {
+  uint8_t blue, green, red;
+} lv_color_t;
+
+// One glyph of a host font; the box is 4 bits per pixel, rows byte-aligned
+typedef struct {
+  uint32_t codepoint;
+  uint32_t bitmap_index;
+  uint8_t advance;
+  uint8_t box_w;
+  uint8_t box_h;
+  int8_t ofs_x;
+  int8_t ofs_y; // From the top of the line
+} lv_host_glyph_t;
+
+typedef struct {
+  int32_t line_height;
+  int32_t base_line;
+  const lv_host_glyph_t *glyphs; // Sorted by codepoint
+  uint32_t glyph_count;
+  const uint8_t *bitmap;
+} lv_font_t;
+
+typedef enum {
+  LV_COLOR_FORMAT_UNKNOWN = 0x00,
+  LV_COLOR_FORMAT_A8 = 0x0E,
+  LV_COLOR_FORMAT_RGB565 = 0x12,
+  LV_COLOR_FORMAT_RGB565A8 = 0x14,
+  LV_COLOR_FORMAT_NATIVE = LV_COLOR_FORMAT_RGB565,
+} lv_color_format_t;
+
+typedef struct {
+  uint32_t magic : 8;
+  uint32_t cf : 8;
+  uint32_t flags : 16;
+  uint32_t w : 16;
+  uint32_t h : 16;
+  uint32_t stride : 16;
+  uint32_t reserved_2 : 16;
+} lv_image_header_t;
+
+typedef struct {
+  lv_image_header_t header;
+  uint32_t data_size;
+  uint8_t *data;
+  void *unaligned_data;
+  const void *handlers;
+} lv_draw_buf_t;
+
+typedef struct {
+  lv_image_header_t header;
+  uint32_t data_size;
+  const uint8_t *data;
+  const void *reserved;
+} lv_image_dsc_t;
+
+typedef enum {
+  LV_EVENT_ALL = 0,
+  LV_EVENT_CLICKED,
+  LV_EVENT_SIZE_CHANGED,
+  LV_EVENT_DELETE,
+  LV_EVENT_DRAW_MAIN,
+} lv_event_code_t;
+
+typedef void (*lv_event_cb_t)(lv_event_t *e);
+
+typedef enum {
+  LV_OBJ_FLAG_HIDDEN = 1 << 0,
+  LV_OBJ_FLAG_CLICKABLE = 1 << 1,
+  LV_OBJ_FLAG_SCROLLABLE = 1 << 4,
+  LV_OBJ_FLAG_IGNORE_LAYOUT = 1 << 18,
+  LV_OBJ_FLAG_FLOATING = 1 << 19,
+} lv_obj_flag_t;
+
+#define LV_STATE_DEFAULT 0x0000
+#define LV_STATE_CHECKED 0x0001
+
+typedef enum {
+  LV_ALIGN_DEFAULT = 0,
+  LV_ALIGN_TOP_LEFT,
+  LV_ALIGN_TOP_MID,
+  LV_ALIGN_TOP_RIGHT,
+  LV_ALIGN_BOTTOM_LEFT,
+  LV_ALIGN_BOTTOM_MID,
+  LV_ALIGN_BOTTOM_RIGHT,
+  LV_ALIGN_LEFT_MID,
+  LV_ALIGN_RIGHT_MID,
+  LV_ALIGN_CENTER,
+  LV_ALIGN_OUT_BOTTOM_LEFT,
+  LV_ALIGN_OUT_BOTTOM_MID,
+} lv_align_t;
+
+typedef enum {
+  LV_TEXT_ALIGN_AUTO,
+  LV_TEXT_ALIGN_LEFT,
+  LV_TEXT_ALIGN_CENTER,
+  LV_TEXT_ALIGN_RIGHT,
+} lv_text_align_t;
+
+typedef enum { LV_LAYOUT_NONE = 0, LV_LAYOUT_FLEX } lv_layout_t;
+typedef enum { LV_FLEX_FLOW_ROW = 0, LV_FLEX_FLOW_COLUMN } lv_flex_flow_t;
+typedef enum {
+  LV_FLEX_ALIGN_START,
+  LV_FLEX_ALIGN_END,
+  LV_FLEX_ALIGN_CENTER,
+} lv_flex_align_t;
+
+typedef enum { LV_PALETTE_GREY } lv_palette_t;
+
+typedef enum { LV_RESULT_INVALID = 0, LV_RESULT_OK } lv_result_t;
+
+#define LV_OPA_TRANSP 0
+#define LV_OPA_10 25
+#define LV_OPA_20 51
+#define LV_OPA_30 76
+#define LV_OPA_40 102
+#define LV_OPA_50 127
+#define LV_OPA_60 153
+#define LV_OPA_70 178
+#define LV_OPA_80 204
+#define LV_OPA_90 229
+#define LV_OPA_COVER 255
+
+// Special coordinates, tagged as in LVGL
+#define LV_COORD_TYPE_SPEC (1 << 29)
+#define LV_COORD_MAX ((1 << 29) - 1)
+#define LV_COORD_IS_SPEC(x) (((x) & LV_COORD_TYPE_SPEC) != 0)
+#define LV_PCT(x) (LV_COORD_TYPE_SPEC | (x))
+#define LV_COORD_IS_PCT(x) (LV_COORD_IS_SPEC(x) && ((x) & 0xFFFF) <= 1000)
+#define LV_COORD_GET_PCT(x) ((x) & 0xFFFF)
+#define LV_SIZE_CONTENT (LV_COORD_TYPE_SPEC | 2001)
+#define LV_RADIUS_CIRCLE 0x7FFF
+#define LV_SCALE_NONE 256
+#define LV_DRAW_BUF_ALIGN 4
+
+#define LV_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define LV_MAX(a, b) ((a) > (b) ? (a) : (b))
+
+#define LV_SYMBOL_WIFI "\xEF\x87\xAB"
+
+typedef struct {
+  lv_color_t bg_color;
+  lv_opa_t bg_opa;
+  int32_t radius;
+  int32_t border_width;
+  lv_color_t border_color;
+  lv_opa_t border_opa;
+} lv_draw_rect_dsc_t;
+
+typedef struct {
+  const char *text;
+  const lv_font_t *font;
+  lv_color_t color;
+  lv_opa_t opa;
+  lv_text_align_t align;
+} lv_draw_label_dsc_t;
+
+// Objects
+lv_obj_t *lv_obj_create(lv_obj_t *parent);
+lv_obj_t *lv_label_create(lv_obj_t *parent);
+lv_obj_t *lv_line_create(lv_obj_t *parent);
+lv_obj_t *lv_image_create(lv_obj_t *parent);
+lv_obj_t *lv_button_create(lv_obj_t *parent);
+#define lv_btn_create lv_button_create
+
+void lv_obj_delete(lv_obj_t *obj);
+void lv_obj_clean(lv_obj_t *obj);
+bool lv_obj_is_valid(const lv_obj_t *obj);
+lv_obj_t *lv_obj_get_parent(const lv_obj_t *obj);
+void lv_obj_move_background(lv_obj_t *obj);
+void lv_obj_set_user_data(lv_obj_t *obj, void *user_data);
+void *lv_obj_get_user_data(lv_obj_t *obj);
+
+void lv_obj_add_flag(lv_obj_t *obj, lv_obj_flag_t flag);
+void lv_obj_clear_flag(lv_obj_t *obj, lv_obj_flag_t flag);
+bool lv_obj_has_flag(const lv_obj_t *obj, lv_obj_flag_t flag);
+void lv_obj_add_state(lv_obj_t *obj, lv_state_t state);
+void lv_obj_clear_state(lv_obj_t *obj, lv_state_t state);
+
+// Position and size
+void lv_obj_set_pos(lv_obj_t *obj, int32_t x, int32_t y);
+void lv_obj_set_size(lv_obj_t *obj, int32_t width, int32_t height);
+void lv_obj_align(lv_obj_t *obj, lv_align_t align, int32_t x_ofs,
+                  int32_t y_ofs);
+void lv_obj_align_to(lv_obj_t *obj, const lv_obj_t *base, lv_align_t align,
+                     int32_t x_ofs, int32_t y_ofs);
+void lv_obj_center(lv_obj_t *obj);
+void lv_obj_update_layout(const lv_obj_t *obj);
+int32_t lv_obj_get_width(const lv_obj_t *obj);
+int32_t lv_obj_get_height(const lv_obj_t *obj);
+void lv_obj_get_coords(const lv_obj_t *obj, lv_area_t *coords);
+void lv_obj_set_layout(lv_obj_t *obj, uint32_t layout);
+void lv_obj_set_flex_flow(lv_obj_t *obj, lv_flex_flow_t flow);
+void lv_obj_set_flex_align(lv_obj_t *obj, lv_flex_align_t main_place,
+                           lv_flex_align_t cross_place,
+                           lv_flex_align_t track_place);
+
+// Mark areas for the next lv_host_render() to redraw
+void lv_obj_invalidate(const lv_obj_t *obj);
+void lv_obj_invalidate_area(const lv_obj_t *obj, const lv_area_t *area);
+
+// Local styles; the selector is a state, e.g. 0 or LV_STATE_CHECKED
+void lv_obj_remove_style_all(lv_obj_t *obj);
+void lv_obj_set_style_bg_color(lv_obj_t *obj, lv_color_t value,
+                               lv_style_selector_t selector);
+void lv_obj_set_style_bg_opa(lv_obj_t *obj, lv_opa_t value,
+                             lv_style_selector_t selector);
+void lv_obj_set_style_radius(lv_obj_t *obj, int32_t value,
+                             lv_style_selector_t selector);
+void lv_obj_set_style_border_width(lv_obj_t *obj, int32_t value,
+                                   lv_style_selector_t selector);
+void lv_obj_set_style_border_color(lv_obj_t *obj, lv_color_t value,
+                                   lv_style_selector_t selector);
+void lv_obj_set_style_border_opa(lv_obj_t *obj, lv_opa_t value,
+                                 lv_style_selector_t selector);
+void lv_obj_set_style_pad_all(lv_obj_t *obj, int32_t value,
+                              lv_style_selector_t selector);
+void lv_obj_set_style_line_width(lv_obj_t *obj, int32_t value,
+                                 lv_style_selector_t selector);
+void lv_obj_set_style_line_color(lv_obj_t *obj, lv_color_t value,
+                                 lv_style_selector_t selector);
+void lv_obj_set_style_line_opa(lv_obj_t *obj, lv_opa_t value,
+                               lv_style_selector_t selector);
+void lv_obj_set_style_line_rounded(lv_obj_t *obj, bool value,
+                                   lv_style_selector_t selector);
+void lv_obj_set_style_text_color(lv_obj_t *obj, lv_color_t value,
+                                 lv_style_selector_t selector);
+void lv_obj_set_style_text_font(lv_obj_t *obj, const lv_font_t *value,
+                                lv_style_selector_t selector);
+void lv_obj_set_style_text_align(lv_obj_t *obj, lv_text_align_t value,
+                                 lv_style_selector_t selector);
+void lv_obj_set_style_image_recolor(lv_obj_t *obj, lv_color_t value,
+                                    lv_style_selector_t selector);
+void lv_obj_set_style_image_recolor_opa(lv_obj_t *obj, lv_opa_t value,
+                                        lv_style_selector_t selector);
+
+// Events
+void lv_obj_add_event_cb(lv_obj_t *obj, lv_event_cb_t event_cb,
+                         lv_event_code_t filter, void *user_data);
+void *lv_event_get_user_data(lv_event_t *e);
+void *lv_event_get_target(lv_event_t *e);
+lv_layer_t *lv_event_get_layer(lv_event_t *e);
+
+// Widgets
+void lv_label_set_text(lv_obj_t *obj, const char *text);
+void lv_label_set_text_static(lv_obj_t *obj, const char *text);
+void lv_line_set_points(lv_obj_t *obj, const lv_point_precise_t points[],
+                        uint32_t point_num);
+void lv_image_set_src(lv_obj_t *obj, const void *src);
+const void *lv_image_get_src(lv_obj_t *obj);
+void lv_image_set_scale(lv_obj_t *obj, uint32_t zoom);
+void lv_image_set_rotation(lv_obj_t *obj, int32_t angle);
+void lv_image_set_pivot(lv_obj_t *obj, int32_t x, int32_t y);
+void lv_image_cache_drop(const void *src);
+
+// Draw buffers
+lv_result_t lv_draw_buf_init(lv_draw_buf_t *draw_buf, uint32_t w, uint32_t h,
+                             lv_color_format_t cf, uint32_t stride, void *data,
+                             uint32_t data_size);
+void lv_draw_buf_clear(lv_draw_buf_t *draw_buf, const lv_area_t *area);
+uint32_t lv_draw_buf_width_to_stride(uint32_t w, lv_color_format_t cf);
+void *lv_draw_buf_align(void *buf, lv_color_format_t cf);
+
+// Drawing from LV_EVENT_DRAW_MAIN
+void lv_draw_rect_dsc_init(lv_draw_rect_dsc_t *dsc);
+void lv_draw_rect(lv_layer_t *layer, const lv_draw_rect_dsc_t *dsc,
+                  const lv_area_t *coords);
+void lv_draw_label_dsc_init(lv_draw_label_dsc_t *dsc);
+void lv_draw_label(lv_layer_t *layer, const lv_draw_label_dsc_t *dsc,
+                   const lv_area_t *coords);
+
+// Fonts, colors, memory and areas
+extern const lv_font_t lv_host_font;
+const lv_font_t *lv_font_get_default();
+int32_t lv_font_get_line_height(const lv_font_t *font);
+
+lv_color_t lv_color_hex(uint32_t c);
+lv_color_t lv_palette_main(lv_palette_t palette);
+
+void *lv_malloc(size_t size);
+void lv_free(void *data);
+
+typedef struct {
+  size_t total_size;
+  size_t free_cnt;
+  size_t free_size;
+  size_t free_biggest_size;
+  size_t used_cnt;
+  size_t max_used;
+  uint8_t used_pct;
+  uint8_t frag_pct;
+} lv_mem_monitor_t;
+
+void lv_mem_monitor(lv_mem_monitor_t *monitor);
+
+int32_t lv_area_get_width(const lv_area_t *area);
+int32_t lv_area_get_height(const lv_area_t *area);
+bool lv_area_is_point_on(const lv_area_t *area, const lv_point_t *point,
+                         int32_t radius);
@@ -0,0 +1,8 @@
+#pragma once
+
+// Host stand-in for the certificate bundle; the canned responses in
+// HttpHost.h need no TLS
+
+#include "esp_err.h"
+
+esp_err_t esp_crt_bundle_attach(void *conf);
@@ -0,0 +1,10 @@
+#pragma once
+
+// Host stand-in for ESP-IDF error codes
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+const char *esp_err_to_name(esp_err_t code);
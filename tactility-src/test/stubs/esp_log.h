@@ -0,0 +1,23 @@
+#pragma once
+
+// Host stand-in for ESP-IDF logging: everything goes to stderr
+
+#include <cstdio>
+
+#define ESP_HOST_LOG(level, tag, format, ...)                                  \
+  fprintf(stderr, level " (%s) " format "\n", tag, ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, format, ...) ESP_HOST_LOG("E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) ESP_HOST_LOG("W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) ESP_HOST_LOG("I", tag, format, ##__VA_ARGS__)
+// Debug output is compiled out, but its arguments still count as used
+#define ESP_LOGD(tag, format, ...)                                             \
+  do {                                                                         \
+    if (0)                                                                     \
+      ESP_HOST_LOG("D", tag, format, ##__VA_ARGS__);                           \
+  } while (0)
+#define ESP_LOGV(tag, format, ...)                                             \
+  do {                                                                         \
+    if (0)                                                                     \
+      ESP_HOST_LOG("V", tag, format, ##__VA_ARGS__);                           \
+  } while (0)
@@ -0,0 +1,8 @@
+#pragma once
+
+// Host stand-in for the ESP-IDF timer: microseconds since boot; see
+// FaceHost.h
+
+#include <cstdint>
+
+int64_t esp_timer_get_time();
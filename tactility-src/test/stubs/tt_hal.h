@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in for the Tactility HAL: only the UI scale the layouts take
+
+typedef enum { UiScaleSmallest, UiScaleDefault } UiScale;
@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in for Tactility's time settings; see FaceHost.h
+
+bool tt_timezone_is_format_24_hour();